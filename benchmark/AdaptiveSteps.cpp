@@ -0,0 +1,171 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   AdaptiveSteps.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Adaptive step benchmark
+//!
+//! Compares searches with fixed lattice steps to searches that take long
+//! steps in open space.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    struct Configuration {
+        const char *name;
+        r2d2::SearchSettings settings;
+    };
+
+    double get_seconds(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - since).count();
+    }
+
+    double get_length(r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length() / r2d2::Length::METER;
+            from = to;
+        }
+        return length;
+    }
+
+    /**
+     * every query has its own goal, so no kept search is reused
+     */
+    void run(const char *name, r2d2::Scenario &scenario,
+             const Configuration &configuration) {
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{scenario.map};
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+        // only the searches are measured, not the connectivity index
+        r2d2::PrecomputationBundle bundle;
+        pathFinder.save_precomputation(bundle);
+
+        std::vector<double> latencies;
+        int found = 0;
+        long expanded = 0;
+        double length = 0, reference = 0;
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            std::vector<r2d2::Coordinate> path;
+            int nodes = 0;
+            std::chrono::steady_clock::time_point start{
+                    std::chrono::steady_clock::now()};
+            bool success = pathFinder.get_path_to_coordinate(
+                    query.start, query.goal, path,
+                    r2d2::CancellationToken::never(), configuration.settings,
+                    &nodes);
+            latencies.push_back(get_seconds(start) * 1e3);
+            expanded += nodes;
+            if (success) {
+                found++;
+                length += get_length(query.start, path);
+                reference += query.referenceCost / r2d2::Length::METER;
+            }
+        }
+        double mean = 0;
+        for (double latency : latencies) {
+            mean += latency;
+        }
+        std::size_t count = std::max<std::size_t>(1, latencies.size());
+        mean /= count;
+        std::sort(latencies.begin(), latencies.end());
+        double p95 = latencies.empty() ? 0 :
+                     latencies[latencies.size() * 95 / 100];
+
+        std::cout << std::setw(8) << name << std::setw(14)
+                  << configuration.name << std::setw(7) << found
+                  << std::setw(11) << double(expanded) / count
+                  << std::setw(10) << mean << std::setw(10) << p95
+                  << std::setw(12) << length / std::max(reference, 1e-9)
+                  << std::endl;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 32;
+
+    const Configuration configurations[] = {
+            {"fixed 1/2", r2d2::SearchSettings{
+                    r2d2::CollisionChecking::EAGER, .5}},
+            {"fixed 1", r2d2::SearchSettings{}},
+            {"fixed 2", r2d2::SearchSettings{
+                    r2d2::CollisionChecking::EAGER, 2}},
+            {"adapt 1/2-4", r2d2::SearchSettings{
+                    r2d2::CollisionChecking::EAGER, .5, 1, 8}},
+            {"adapt 1-4", r2d2::SearchSettings{
+                    r2d2::CollisionChecking::EAGER, 1, 1, 4}}};
+
+    std::cout << std::fixed << std::setprecision(2) << std::setw(8) << "map"
+              << std::setw(14) << "steps" << std::setw(7) << "found"
+              << std::setw(11) << "nodes/q"
+              << std::setw(10) << "mean ms" << std::setw(10) << "p95 ms"
+              << std::setw(12) << "length/ref" << std::endl;
+    struct {
+        const char *name;
+        r2d2::ScenarioKind kind;
+        double density;
+    } maps[] = {{"open", r2d2::ScenarioKind::RANDOM, 0},
+                {"random", r2d2::ScenarioKind::RANDOM, .2},
+                {"rooms", r2d2::ScenarioKind::ROOMS, 0},
+                {"maze", r2d2::ScenarioKind::MAZE, 0},
+                {"caves", r2d2::ScenarioKind::CAVES, .45}};
+    for (const auto &map : maps) {
+        r2d2::Scenario scenario{r2d2::ScenarioGenerator{
+                map.kind, size, size, 42, map.density}.make_scenario(
+                queryCount)};
+        for (const Configuration &configuration : configurations) {
+            run(map.name, scenario, configuration);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,159 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   BatchedMap.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Batched box query benchmark
+//!
+//! Compares the latency of lattice searches on a grid map with and without
+//! batched box queries.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../source/include/VersionedMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * map that hides the batching of another map, so every box is a
+     * separate call, but keeps its version
+     */
+    class SingleQueryMap : public r2d2::ReadOnlyMap,
+                           public r2d2::VersionedMap {
+    public:
+        SingleQueryMap(r2d2::ReadOnlyMap &map) : map(map) {
+        }
+
+        virtual const r2d2::BoxInfo get_box_info(const r2d2::Box box) override {
+            return map.get_box_info(box);
+        }
+
+        virtual const r2d2::Box get_map_bounding_box() override {
+            return map.get_map_bounding_box();
+        }
+
+        virtual uint64_t get_map_version() const override {
+            return r2d2::VersionedMap::get_version_of(map);
+        }
+
+    private:
+        r2d2::ReadOnlyMap &map;
+    };
+
+    double run(r2d2::ReadOnlyMap &map, const r2d2::Scenario &scenario,
+               int &found) {
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+        // only the searches are measured, not the connectivity index
+        r2d2::PrecomputationBundle bundle;
+        pathFinder.save_precomputation(bundle);
+
+        found = 0;
+        std::chrono::steady_clock::time_point start{
+                std::chrono::steady_clock::now()};
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            std::vector<r2d2::Coordinate> path;
+            found += pathFinder.get_path_to_coordinate(query.start,
+                                                       query.goal, path);
+        }
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count() * 1e3 /
+               std::max<std::size_t>(1, scenario.queries.size());
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 32;
+
+    std::cout << std::fixed << std::setprecision(2) << std::setw(10) << "map"
+              << std::setw(8) << "cell" << std::setw(8) << "found"
+              << std::setw(14) << "single ms" << std::setw(14)
+              << "batched ms" << std::endl;
+    for (r2d2::ScenarioKind kind : {r2d2::ScenarioKind::RANDOM,
+                                    r2d2::ScenarioKind::ROOMS,
+                                    r2d2::ScenarioKind::CAVES,
+                                    r2d2::ScenarioKind::WAREHOUSE}) {
+        r2d2::Scenario scenario{r2d2::ScenarioGenerator{
+                kind, size, size, 42,
+                kind == r2d2::ScenarioKind::CAVES ? .45 : .2}.make_scenario(
+                queryCount)};
+        // the same map with cells of a quarter meter, so a box of the
+        // robot covers several cells
+        r2d2::Scenario fine{r2d2::GridMap{}, scenario.queries};
+        std::vector<uint8_t> cells(std::size_t(size) * size * 16);
+        for (int y = 0; y < size * 4; y++) {
+            for (int x = 0; x < size * 4; x++) {
+                cells[std::size_t(y) * size * 4 + x] =
+                        scenario.map.get_cell(x / 4, y / 4);
+            }
+        }
+        fine.map.assign(scenario.map.get_origin(), .25 * r2d2::Length::METER,
+                        size * 4, size * 4, std::move(cells));
+
+        for (r2d2::Scenario *current : {&scenario, &fine}) {
+            SingleQueryMap single{current->map};
+            int found;
+            // the modes take turns, the fastest of three runs is reported
+            double singleTime = 1e9, batchedTime = 1e9;
+            for (int i = 0; i < 3; i++) {
+                singleTime = std::min(singleTime,
+                                      run(single, *current, found));
+                batchedTime = std::min(batchedTime,
+                                       run(current->map, *current, found));
+            }
+            std::cout << std::setw(10) << r2d2::get_scenario_kind_name(kind)
+                      << std::setw(8)
+                      << current->map.get_cell_size() / r2d2::Length::METER
+                      << std::setw(8) << found << std::setw(14) << singleTime
+                      << std::setw(14) << batchedTime << std::endl;
+        }
+    }
+    return 0;
+}
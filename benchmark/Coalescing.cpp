@@ -0,0 +1,211 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   Coalescing.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Coalescing benchmark
+//!
+//! Measures the throughput of concurrent queries that often repeat each
+//! other, with and without coalescing.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/CoalescingPathFinder.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    //! the memory for kept searches of the pathfinders in kept mode
+    const std::size_t keptBudget = std::size_t(256) << 20;
+
+    /**
+     * lets threads start a round together, like subsystems that react to
+     * the same event
+     */
+    class Barrier {
+    public:
+        Barrier(int count) : count{count}, waiting{0}, round{0} {
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> lock{mutex};
+            int current = round;
+            if (++waiting == count) {
+                waiting = 0;
+                round++;
+                changed.notify_all();
+            } else {
+                changed.wait(lock, [this, current]() {
+                    return round != current;
+                });
+            }
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable changed;
+        const int count;
+        int waiting;
+        int round;
+    };
+
+    /**
+     * answers queries with settings whose searches are not kept, so
+     * equivalent queries search again
+     */
+    class AdaptivePathFinder : public r2d2::PathFinder {
+    public:
+        AdaptivePathFinder(SharedObject<r2d2::ReadOnlyMap> &map, r2d2::Box box,
+                           r2d2::AStarPathFinder &pathFinder) :
+                PathFinder{map, box}, pathFinder(pathFinder) {
+        }
+
+        virtual bool get_path_to_coordinate(
+                r2d2::Coordinate start, r2d2::Coordinate goal,
+                std::vector<r2d2::Coordinate> &path) override {
+            return pathFinder.get_path_to_coordinate(
+                    start, goal, path, r2d2::CancellationToken::never(),
+                    r2d2::SearchSettings{r2d2::CollisionChecking::EAGER, 1, 1,
+                                         4});
+        }
+
+    private:
+        r2d2::AStarPathFinder &pathFinder;
+    };
+
+    /**
+     * every round, each group of threads asks the same query
+     */
+    double run(r2d2::PathFinder &pathFinder, const r2d2::Scenario &scenario,
+               int threadCount, int groupSize, int rounds) {
+        Barrier barrier{threadCount};
+        std::chrono::steady_clock::time_point begin{
+                std::chrono::steady_clock::now()};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([&, t]() {
+                for (int round = 0; round < rounds; round++) {
+                    barrier.wait();
+                    const r2d2::ScenarioQuery &query{scenario.queries[
+                            std::size_t(round * threadCount + t / groupSize) %
+                            scenario.queries.size()]};
+                    std::vector<r2d2::Coordinate> path;
+                    pathFinder.get_path_to_coordinate(query.start,
+                                                      query.goal, path);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin).count();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    int threadCount = argc > 2 ? std::atoi(argv[2]) : 6;
+    int rounds = argc > 3 ? std::atoi(argv[3]) : 20;
+    std::cout << std::fixed << std::setprecision(2) << std::setw(8) << "map"
+              << std::setw(10) << "search" << std::setw(8) << "group"
+              << std::setw(14) << "direct q/s"
+              << std::setw(16) << "coalesced q/s" << std::setw(10)
+              << "searches" << std::setw(8) << "dedup" << std::setw(9)
+              << "largest" << std::endl;
+    for (r2d2::ScenarioKind kind : {r2d2::ScenarioKind::ROOMS,
+                                    r2d2::ScenarioKind::CAVES}) {
+        r2d2::Scenario scenario{r2d2::ScenarioGenerator{
+                kind, size, size, 42,
+                kind == r2d2::ScenarioKind::CAVES ? .45 : 0}.make_scenario(
+                std::size_t(threadCount * rounds))};
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{scenario.map};
+        r2d2::PrecomputationBundle bundle;
+        for (int groupSize = 1; groupSize <= threadCount; groupSize *= 2) {
+            for (bool kept : {true, false}) {
+                // fresh pathfinders, so no kept search is reused between runs
+                r2d2::AStarPathFinder direct{sharedMap, {{}, robotBox}};
+                direct.save_precomputation(bundle);
+                direct.set_kept_search_budget(kept ? keptBudget : 0);
+                AdaptivePathFinder directAdaptive{sharedMap, {{}, robotBox},
+                                                  direct};
+                double directTime = run(
+                        kept ? static_cast<r2d2::PathFinder &>(direct) :
+                        directAdaptive, scenario, threadCount, groupSize,
+                        rounds);
+
+                r2d2::AStarPathFinder wrapped{sharedMap, {{}, robotBox}};
+                wrapped.save_precomputation(bundle);
+                wrapped.set_kept_search_budget(kept ? keptBudget : 0);
+                AdaptivePathFinder wrappedAdaptive{sharedMap, {{}, robotBox},
+                                                   wrapped};
+                r2d2::CoalescingPathFinder coalescing{
+                        sharedMap, {{}, robotBox},
+                        kept ? static_cast<r2d2::PathFinder &>(wrapped) :
+                        wrappedAdaptive, wrapped.get_map_access()};
+                double coalescedTime = run(coalescing, scenario, threadCount,
+                                           groupSize, rounds);
+                r2d2::CoalescingStatistics statistics{
+                        coalescing.get_statistics()};
+
+                double queries = double(threadCount * rounds);
+                std::cout << std::setw(8)
+                          << r2d2::get_scenario_kind_name(kind)
+                          << std::setw(10) << (kept ? "kept" : "adaptive")
+                          << std::setw(8) << groupSize << std::setw(14)
+                          << queries / directTime << std::setw(16)
+                          << queries / coalescedTime << std::setw(10)
+                          << statistics.searches << std::setw(8)
+                          << statistics.get_dedup_rate() << std::setw(9)
+                          << statistics.largestGroup << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CollisionChecking.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Collision checking benchmark
+//!
+//! Compares the map queries and latency of eager and lazy collision checking
+//! across obstacle densities.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../source/include/VersionedMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * map that counts the box queries made on another map, and has its
+     * version
+     */
+    class CountingMap : public r2d2::ReadOnlyMap, public r2d2::VersionedMap {
+    public:
+        CountingMap(r2d2::ReadOnlyMap &map) : map(map), count{0} {
+        }
+
+        virtual const r2d2::BoxInfo get_box_info(const r2d2::Box box) override {
+            count++;
+            return map.get_box_info(box);
+        }
+
+        virtual const r2d2::Box get_map_bounding_box() override {
+            return map.get_map_bounding_box();
+        }
+
+        virtual uint64_t get_map_version() const override {
+            return r2d2::VersionedMap::get_version_of(map);
+        }
+
+        r2d2::ReadOnlyMap &map;
+        long count;
+    };
+
+    double get_seconds(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - since).count();
+    }
+
+    void run(const char *name, r2d2::Scenario &scenario,
+             r2d2::CollisionChecking mode) {
+        CountingMap counting{scenario.map};
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{counting};
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+        pathFinder.set_collision_checking(mode);
+        // only the searches are measured, not the connectivity index
+        r2d2::PrecomputationBundle bundle;
+        pathFinder.save_precomputation(bundle);
+        counting.count = 0;
+
+        std::vector<double> latencies;
+        int found = 0;
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            std::vector<r2d2::Coordinate> path;
+            std::chrono::steady_clock::time_point start{
+                    std::chrono::steady_clock::now()};
+            found += pathFinder.get_path_to_coordinate(query.start,
+                                                       query.goal, path);
+            latencies.push_back(get_seconds(start) * 1e3);
+        }
+        double mean = 0;
+        for (double latency : latencies) {
+            mean += latency;
+        }
+        mean /= std::max<std::size_t>(1, latencies.size());
+        std::sort(latencies.begin(), latencies.end());
+        double p95 = latencies.empty() ? 0 :
+                     latencies[latencies.size() * 95 / 100];
+
+        std::cout << std::setw(12) << name << std::setw(8)
+                  << (mode == r2d2::CollisionChecking::LAZY ? "lazy" : "eager")
+                  << std::setw(8) << found << std::setw(16)
+                  << double(counting.count) /
+                     std::max<std::size_t>(1, latencies.size())
+                  << std::setw(12) << mean << std::setw(12) << p95
+                  << std::endl;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 32;
+
+    std::cout << std::fixed << std::setprecision(1) << std::setw(12) << "map"
+              << std::setw(8) << "mode" << std::setw(8) << "found"
+              << std::setw(16) << "boxes/query" << std::setw(12) << "mean ms"
+              << std::setw(12) << "p95 ms" << std::endl;
+    struct {
+        const char *name;
+        r2d2::ScenarioKind kind;
+        double density;
+    } maps[] = {{"random 0%", r2d2::ScenarioKind::RANDOM, 0},
+                {"random 10%", r2d2::ScenarioKind::RANDOM, .1},
+                {"random 20%", r2d2::ScenarioKind::RANDOM, .2},
+                {"random 30%", r2d2::ScenarioKind::RANDOM, .3},
+                {"caves", r2d2::ScenarioKind::CAVES, .45},
+                {"rooms", r2d2::ScenarioKind::ROOMS, 0}};
+    for (const auto &map : maps) {
+        r2d2::Scenario scenario{r2d2::ScenarioGenerator{
+                map.kind, size, size, 42, map.density}.make_scenario(
+                queryCount)};
+        // every query has its own goal, so no kept search is reused
+        run(map.name, scenario, r2d2::CollisionChecking::EAGER);
+        run(map.name, scenario, r2d2::CollisionChecking::LAZY);
+    }
+    return 0;
+}
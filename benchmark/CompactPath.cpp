@@ -0,0 +1,133 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CompactPath.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Compact path benchmark
+//!
+//! Measures the memory of the paths of a fleet stored as compact paths
+//! instead of coordinate vectors, and the time to encode and decode them.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/CompactPath.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    double get_seconds(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - since).count();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    // the active and cached paths of a fleet
+    int pathCount = argc > 2 ? std::atoi(argv[2]) : 2000;
+    std::cout << std::fixed << std::setprecision(1) << std::setw(10) << "map"
+              << std::setw(8) << "paths" << std::setw(11) << "waypoints"
+              << std::setw(13) << "vector KiB" << std::setw(14)
+              << "compact KiB" << std::setw(10) << "ratio" << std::setw(14)
+              << "encode ns" << std::setw(14) << "decode ns" << std::endl;
+    for (r2d2::ScenarioKind kind : {r2d2::ScenarioKind::WAREHOUSE,
+                                    r2d2::ScenarioKind::ROOMS,
+                                    r2d2::ScenarioKind::CAVES}) {
+        r2d2::Scenario scenario{r2d2::ScenarioGenerator{
+                kind, size, size, 42,
+                kind == r2d2::ScenarioKind::CAVES ? .45 : .25}.make_scenario(
+                pathCount)};
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{scenario.map};
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+
+        std::vector<std::vector<r2d2::Coordinate>> paths;
+        std::size_t waypoints = 0, vectorBytes = 0;
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            std::vector<r2d2::Coordinate> path;
+            if (pathFinder.get_path_to_coordinate(query.start, query.goal,
+                                                  path)) {
+                path.shrink_to_fit();
+                waypoints += path.size();
+                vectorBytes += sizeof(path) +
+                               path.capacity() * sizeof(r2d2::Coordinate);
+                paths.push_back(std::move(path));
+            }
+        }
+
+        std::chrono::steady_clock::time_point start{
+                std::chrono::steady_clock::now()};
+        std::vector<r2d2::CompactPath> compactPaths;
+        compactPaths.reserve(paths.size());
+        for (std::size_t i = 0; i < paths.size(); i++) {
+            compactPaths.emplace_back(scenario.queries[i].start, paths[i]);
+        }
+        double encodeTime = get_seconds(start);
+        std::size_t compactBytes = 0;
+        for (const r2d2::CompactPath &path : compactPaths) {
+            compactBytes += path.get_memory_usage();
+        }
+
+        start = std::chrono::steady_clock::now();
+        double sum = 0;
+        for (const r2d2::CompactPath &path : compactPaths) {
+            for (r2d2::Coordinate point : path) {
+                sum += point.get_x() / r2d2::Length::METER;
+            }
+        }
+        double decodeTime = get_seconds(start);
+
+        std::cout << std::setw(10) << r2d2::get_scenario_kind_name(kind)
+                  << std::setw(8) << paths.size() << std::setw(11)
+                  << waypoints << std::setw(13) << vectorBytes / 1024.
+                  << std::setw(14) << compactBytes / 1024. << std::setw(10)
+                  << double(vectorBytes) / compactBytes << std::setw(14)
+                  << encodeTime * 1e9 / std::max<std::size_t>(1, waypoints)
+                  << std::setw(14)
+                  << decodeTime * 1e9 / std::max<std::size_t>(1, waypoints)
+                  << (sum == 0 ? " " : "") << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ConcurrentQueries.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  Concurrent query benchmark
+//!
+//! Measures how the throughput of a single AStarPathFinder scales when it is
+//! queried from an increasing amount of threads.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/Tracing.hpp"
+#include "LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+
+int main(int argc, char *argv[]) {
+    int mapSize = argc > 1 ? std::atoi(argv[1]) : 200;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 200;
+    int maxThreads = argc > 3 ? std::atoi(argv[3]) :
+                     int(std::thread::hardware_concurrency());
+    // only contains events when built with R2D2_PATHFINDING_TRACING
+    const char *traceFile = argc > 4 ? argv[4] : nullptr;
+
+    // a seeded map and query set, so runs can be compared
+    std::mt19937_64 random{42};
+    std::vector<std::vector<int>> grid(std::size_t(mapSize),
+                                       std::vector<int>(std::size_t(mapSize), 0));
+    for (std::vector<int> &row : grid) {
+        for (int &cell : row) {
+            cell = std::uniform_real_distribution<float>{}(random) < .2f ? 1 : 0;
+        }
+    }
+    std::uniform_int_distribution<int> cellDist{0, mapSize - 1};
+    std::vector<std::pair<r2d2::Coordinate, r2d2::Coordinate>> queries;
+    for (int i = 0; i < queryCount; i++) {
+        int sx = cellDist(random), sy = cellDist(random),
+                gx = cellDist(random), gy = cellDist(random);
+        grid[sy][sx] = 0;
+        grid[gy][gx] = 0;
+        queries.emplace_back(make_coordinate(sx + .5, sy + .5),
+                             make_coordinate(gx + .5, gy + .5));
+    }
+
+    r2d2::Dummy map{grid};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    // the connectivity index is made once, and not measured
+    r2d2::PrecomputationBundle bundle;
+    r2d2::AStarPathFinder{sharedMap, {{}, robotBox}}.save_precomputation(
+            bundle);
+
+    std::cout << "map " << mapSize << "x" << mapSize << ", "
+              << queryCount << " queries" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "queries/s"
+              << std::setw(10) << "speedup" << std::endl;
+    double baseline = 0;
+    for (int threadCount = 1; threadCount <= std::max(1, maxThreads);
+         threadCount *= 2) {
+        // a fresh pathfinder, so no search is kept from the round before
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+        pathFinder.load_precomputation(bundle);
+        std::atomic<int> next{0};
+        auto begin = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([&]() {
+                std::vector<r2d2::Coordinate> path;
+                for (int i = next++; i < queryCount; i = next++) {
+                    pathFinder.get_path_to_coordinate(queries[i].first,
+                                                      queries[i].second, path);
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin).count();
+        double throughput = queryCount / seconds;
+        if (threadCount == 1) {
+            baseline = throughput;
+        }
+        std::cout << std::setw(8) << threadCount
+                  << std::setw(14) << std::fixed << std::setprecision(1)
+                  << throughput
+                  << std::setw(10) << std::setprecision(2)
+                  << throughput / baseline << std::endl;
+    }
+
+    if (traceFile != nullptr) {
+        std::ofstream out{traceFile};
+        r2d2::TraceLog::write_chrome_trace(out);
+    }
+    return 0;
+}
@@ -0,0 +1,164 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CooperativePlanner.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Cooperative planner benchmark
+//!
+//! Measures the robots per second CooperativePlanner plans for fleets of growing
+//! size, against planning the same robots independently.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/CooperativePlanner.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+
+namespace {
+
+    // small enough that a robot on the lattice node closest to the center
+    // of a free cell stays within that cell
+    const r2d2::Translation robotBox{.3 * r2d2::Length::METER,
+                                     .3 * r2d2::Length::METER,
+                                     0 * r2d2::Length::METER};
+
+    double get_seconds(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - since).count();
+    }
+
+    bool is_near(r2d2::Coordinate a, r2d2::Coordinate b) {
+        return (a - b).get_length() / r2d2::Length::METER < .5;
+    }
+
+    /**
+     * the time step after which no robot of a plan moves anymore
+     */
+    std::size_t get_makespan(const r2d2::FleetPlan &plan) {
+        std::size_t makespan = 0;
+        for (const std::vector<r2d2::Coordinate> &path : plan.paths) {
+            for (std::size_t t = 1; t < path.size(); t++) {
+                if ((path[t] - path[t - 1]).get_length() >
+                    0 * r2d2::Length::METER) {
+                    makespan = std::max(makespan, t);
+                }
+            }
+        }
+        return makespan;
+    }
+
+    void run(const char *name, r2d2::Scenario &scenario, std::size_t size,
+             int window) {
+        // the queries become robots, as long as no two share a start or goal
+        std::vector<r2d2::RobotTask> tasks;
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            bool distinct = true;
+            for (const r2d2::RobotTask &task : tasks) {
+                distinct = distinct && !is_near(task.start, query.start) &&
+                           !is_near(task.goal, query.goal);
+            }
+            if (distinct && tasks.size() < size) {
+                tasks.push_back({query.start, query.goal});
+            }
+        }
+
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{scenario.map};
+        r2d2::CooperativePlanner planner{sharedMap, {{}, robotBox}, window};
+        r2d2::FleetPlan plan;
+        std::chrono::steady_clock::time_point start{
+                std::chrono::steady_clock::now()};
+        planner.plan(tasks, plan);
+        double cold = get_seconds(start);
+        // the second plan reuses the distance fields of the goals
+        start = std::chrono::steady_clock::now();
+        planner.plan(tasks, plan);
+        double warm = get_seconds(start);
+
+        // the same robots, each planned on its own without the others
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+        start = std::chrono::steady_clock::now();
+        for (const r2d2::RobotTask &task : tasks) {
+            std::vector<r2d2::Coordinate> path;
+            pathFinder.get_path_to_coordinate(task.start, task.goal, path);
+        }
+        double independent = get_seconds(start);
+
+        int arrived = int(std::count(plan.arrived.begin(), plan.arrived.end(),
+                                     true));
+        std::cout << std::setw(8) << name << std::setw(8) << tasks.size()
+                  << std::setw(10) << arrived << std::setw(10)
+                  << get_makespan(plan) << std::setw(10) << plan.searches
+                  << std::setw(10) << plan.restarts << std::setw(14)
+                  << tasks.size() / cold << std::setw(14)
+                  << tasks.size() / warm << std::setw(14)
+                  << tasks.size() / independent << std::endl;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 64;
+    int window = argc > 2 ? std::atoi(argv[2]) : 16;
+
+    std::cout << std::fixed << std::setprecision(1) << std::setw(8) << "map"
+              << std::setw(8) << "robots" << std::setw(10) << "arrived"
+              << std::setw(10) << "makespan" << std::setw(10) << "searches"
+              << std::setw(10) << "restarts" << std::setw(14) << "cold r/s"
+              << std::setw(14) << "warm r/s" << std::setw(14) << "alone r/s"
+              << std::endl;
+    struct {
+        const char *name;
+        r2d2::ScenarioKind kind;
+        double density;
+    } maps[] = {{"rooms", r2d2::ScenarioKind::ROOMS, 0},
+                {"caves", r2d2::ScenarioKind::CAVES, .45}};
+    for (const auto &map : maps) {
+        r2d2::Scenario scenario{r2d2::ScenarioGenerator{
+                map.kind, size, size, 42, map.density}.make_scenario(200)};
+        for (std::size_t fleet : {10, 25, 50, 100}) {
+            run(map.name, scenario, fleet, window);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   MapLayers.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Map backend benchmark
+//!
+//! Replays the box queries of the pathfinder against every map backend,
+//! checks their answers against the Dummy map, and reports their throughput
+//! and cache misses per map size.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/MapWorkload.hpp"
+#include "../source/include/QuadTreeMap.hpp"
+
+namespace {
+
+    /**
+     * a warehouse like map: rooms of 64 cells with doors, racks in every
+     * room, and an unexplored corner
+     */
+    std::vector<std::vector<int>> make_cells(int mapSize) {
+        std::mt19937_64 random{42};
+        std::vector<std::vector<int>> cells(
+                std::size_t(mapSize), std::vector<int>(std::size_t(mapSize), 0));
+        for (int i = 0; i < mapSize; i++) {
+            for (int wall = 0; wall < mapSize; wall += 64) {
+                if (i % 64 < 28 || i % 64 > 35) {
+                    cells[i][wall] = 1;
+                    cells[wall][i] = 1;
+                }
+            }
+        }
+        std::uniform_int_distribution<int> cellDist{0, mapSize - 1};
+        for (int rack = 0; rack < mapSize * mapSize / 8192; rack++) {
+            int x = cellDist(random), y = cellDist(random);
+            for (int i = 0; i < 12 && x + i < mapSize; i++) {
+                cells[y][x + i] = 1;
+            }
+        }
+        for (int y = mapSize * 3 / 4; y < mapSize; y++) {
+            for (int x = mapSize * 3 / 4; x < mapSize; x++) {
+                cells[y][x] = 2;
+            }
+        }
+        return cells;
+    }
+
+    const char *get_name(r2d2::BoxQueryKind kind) {
+        switch (kind) {
+            case r2d2::BoxQueryKind::SUCCESSOR:
+                return "successor";
+            case r2d2::BoxQueryKind::SEGMENT:
+                return "segment";
+            default:
+                return "out of bounds";
+        }
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int maxSize = argc > 1 ? std::atoi(argv[1]) : 2048;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 20000;
+    r2d2::Translation robotBox{.8 * r2d2::Length::METER,
+                               .8 * r2d2::Length::METER,
+                               0 * r2d2::Length::METER};
+    bool conforms = true;
+
+    std::cout << std::fixed << std::setw(6) << "size" << std::setw(15)
+              << "queries" << std::setw(10) << "backend" << std::setw(12)
+              << "kq/s" << std::setw(10) << "ns/cell" << std::setw(10)
+              << "miss %" << std::setw(12) << "mismatches" << std::setw(8)
+              << "unsafe" << std::endl;
+    for (int mapSize = 128; mapSize <= maxSize; mapSize *= 4) {
+        std::vector<std::vector<int>> cells{make_cells(mapSize)};
+        r2d2::Dummy dummy{cells};
+        r2d2::GridMap grid{{}, r2d2::Length::METER, mapSize, mapSize};
+        std::vector<uint8_t> values;
+        values.reserve(std::size_t(mapSize) * std::size_t(mapSize));
+        for (const std::vector<int> &row : cells) {
+            values.insert(values.end(), row.begin(), row.end());
+        }
+        grid.set_cells(std::move(values));
+        r2d2::QuadTreeMap tree{grid};
+        std::vector<std::pair<const char *, r2d2::ReadOnlyMap *>> backends{
+                {"dummy", &dummy}, {"grid", &grid}, {"quadtree", &tree}};
+
+        for (r2d2::BoxQueryKind kind : {r2d2::BoxQueryKind::SUCCESSOR,
+                                        r2d2::BoxQueryKind::SEGMENT,
+                                        r2d2::BoxQueryKind::OUT_OF_BOUNDS}) {
+            std::vector<r2d2::BoxQuery> queries{r2d2::generate_box_queries(
+                    dummy.get_map_bounding_box(), robotBox,
+                    r2d2::Length::METER, kind, queryCount, uint64_t(mapSize))};
+            for (const std::pair<const char *, r2d2::ReadOnlyMap *> &backend :
+                    backends) {
+                r2d2::MapConformance conformance{r2d2::check_map_conformance(
+                        dummy, *backend.second, queries)};
+                conforms = conforms && conformance.unsafe == 0;
+                // once to fill the caches, then measured
+                r2d2::measure_map_throughput(*backend.second, queries);
+                r2d2::MapThroughput throughput{r2d2::measure_map_throughput(
+                        *backend.second, queries, 3)};
+                std::cout << std::setw(6) << mapSize << std::setw(15)
+                          << get_name(kind) << std::setw(10) << backend.first
+                          << std::setw(12) << std::setprecision(0)
+                          << throughput.queriesPerSecond / 1000
+                          << std::setw(10) << std::setprecision(2)
+                          << throughput.nsPerCell << std::setw(10);
+                if (throughput.hasCacheCounters &&
+                    throughput.cacheReferences > 0) {
+                    std::cout << std::setprecision(1)
+                              << 100. * throughput.cacheMisses /
+                                 throughput.cacheReferences;
+                } else {
+                    std::cout << "n/a";
+                }
+                std::cout << std::setw(12) << conformance.mismatches
+                          << std::setw(8) << conformance.unsafe << std::endl;
+            }
+        }
+    }
+    return conforms ? 0 : 1;
+}
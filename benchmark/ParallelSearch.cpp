@@ -0,0 +1,116 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ParallelSearch.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  Parallel single query benchmark
+//!
+//! Measures the speedup of the hash distributed search on a single large query
+//! for 1, 2, 4, 8 and 16 threads, checks the path cost against the
+//! sequential search and reports the node expansions of all threads.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include "../source/include/AStarPathFinder.hpp"
+#include "LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+
+int main(int argc, char *argv[]) {
+    int mapSize = argc > 1 ? std::atoi(argv[1]) : 400;
+    int maxThreads = argc > 2 ? std::atoi(argv[2]) : 16;
+
+    // a seeded map with the query between opposite corners
+    r2d2::Dummy map{make_seeded_map(mapSize, mapSize, .25f, 42)};
+    map.set_cell(1, 1, 0);
+    map.set_cell(mapSize - 2, mapSize - 2, 0);
+    r2d2::Coordinate start{make_coordinate(1.5, 1.5)},
+            goal{make_coordinate(mapSize - 1.5, mapSize - 1.5)};
+
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+
+    // the threads wait for each other, so a speedup needs a core per thread
+    int cores = int(std::thread::hardware_concurrency());
+    std::cout << "map " << mapSize << "x" << mapSize << ", " << cores
+              << " cores" << std::endl;
+    std::vector<r2d2::Coordinate> path;
+    auto begin = std::chrono::steady_clock::now();
+    bool found = pathFinder.get_path_to_coordinate(start, goal, path);
+    double sequential = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - begin).count();
+    std::cout << "sequential " << std::fixed << std::setprecision(3)
+              << sequential << " s, " << (found ? "found" : "no path")
+              << std::endl;
+
+    std::cout << std::setw(8) << "threads" << std::setw(10) << "seconds"
+              << std::setw(10) << "speedup" << std::setw(12) << "cost"
+              << std::setw(10) << "expanded" << std::endl;
+    double baseline = 0, baselineCost = 0;
+    for (int threadCount = 1; threadCount <= std::max(1, maxThreads);
+         threadCount *= 2) {
+        r2d2::Length cost;
+        int expanded;
+        begin = std::chrono::steady_clock::now();
+        found = pathFinder.get_path_to_coordinate_parallel(
+                start, goal, path, threadCount, &cost, &expanded);
+        double seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin).count();
+        double meters = found ? cost / r2d2::Length::METER : -1;
+        if (threadCount == 1) {
+            baseline = seconds;
+            baselineCost = meters;
+        }
+        std::cout << std::setw(8) << threadCount
+                  << std::setw(10) << std::setprecision(3) << seconds
+                  << std::setw(10) << std::setprecision(2)
+                  << baseline / seconds
+                  << std::setw(12) << std::setprecision(4) << meters
+                  << std::setw(10) << expanded
+                  << (std::abs(meters - baselineCost) > 1e-6 ?
+                      "  cost differs" : "")
+                  << (cores > 0 && threadCount > cores ?
+                      "  more threads than cores" : "")
+                  << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,205 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   Portfolio.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Portfolio benchmark
+//!
+//! Compares the latency and success of single search configurations with a
+//! portfolio that races them.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../source/include/PortfolioPathFinder.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    struct Configuration {
+        const char *name;
+        r2d2::SearchSettings settings;
+    };
+
+    const Configuration configurations[] = {
+            {"exact", r2d2::SearchSettings{}},
+            {"weighted", r2d2::SearchSettings{
+                    r2d2::CollisionChecking::EAGER, 1, 2}},
+            {"coarse", r2d2::SearchSettings{
+                    r2d2::CollisionChecking::EAGER, 2, 1}},
+            {"coarse-w", r2d2::SearchSettings{
+                    r2d2::CollisionChecking::EAGER, 2, 2}}};
+
+    double get_seconds(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - since).count();
+    }
+
+    double get_length(r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length() / r2d2::Length::METER;
+            from = to;
+        }
+        return length;
+    }
+
+    void print(const std::string &map, const std::string &mode, int found,
+               std::vector<double> &latencies, double length) {
+        double mean = 0;
+        for (double latency : latencies) {
+            mean += latency;
+        }
+        mean /= std::max<std::size_t>(1, latencies.size());
+        std::sort(latencies.begin(), latencies.end());
+        double p95 = latencies.empty() ? 0 :
+                     latencies[latencies.size() * 95 / 100];
+        std::cout << std::setw(10) << map << std::setw(16) << mode
+                  << std::setw(8) << found << std::setw(12) << mean
+                  << std::setw(12) << p95 << std::setw(12)
+                  << length / std::max(1, found) << std::endl;
+    }
+
+    /**
+     * every query has its own goal, so no kept search is reused
+     */
+    void run(const std::string &map, r2d2::Scenario &scenario,
+             std::chrono::nanoseconds deadline) {
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{scenario.map};
+        r2d2::PrecomputationBundle bundle;
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+        pathFinder.save_precomputation(bundle);
+
+        if (deadline.count() == 0) {
+            for (const Configuration &configuration : configurations) {
+                r2d2::PortfolioPlanner planner{
+                        r2d2::PortfolioPathFinder::make_planner(
+                                pathFinder, configuration.settings)};
+                std::vector<double> latencies;
+                int found = 0;
+                double length = 0;
+                for (const r2d2::ScenarioQuery &query : scenario.queries) {
+                    std::vector<r2d2::Coordinate> path;
+                    std::chrono::steady_clock::time_point start{
+                            std::chrono::steady_clock::now()};
+                    if (planner(query.start, query.goal, path,
+                                r2d2::CancellationToken::never())) {
+                        found++;
+                        length += get_length(query.start, path);
+                    }
+                    latencies.push_back(get_seconds(start) * 1e3);
+                }
+                print(map, configuration.name, found, latencies, length);
+            }
+        }
+
+        // a fresh pathfinder, which kept none of the searches above
+        r2d2::AStarPathFinder racing{sharedMap, {{}, robotBox}};
+        racing.save_precomputation(bundle);
+        // a thread per configuration, so they race even on few cores
+        r2d2::PortfolioPathFinder portfolio{
+                sharedMap, {{}, robotBox},
+                int(sizeof(configurations) / sizeof(configurations[0]))};
+        for (const Configuration &configuration : configurations) {
+            portfolio.add_configuration(
+                    configuration.name, r2d2::PortfolioPathFinder::make_planner(
+                            racing, configuration.settings));
+        }
+        portfolio.set_deadline(deadline);
+        std::vector<double> latencies;
+        int found = 0;
+        double length = 0;
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            std::vector<r2d2::Coordinate> path;
+            std::chrono::steady_clock::time_point start{
+                    std::chrono::steady_clock::now()};
+            if (portfolio.get_path_to_coordinate(query.start, query.goal,
+                                                 path)) {
+                found++;
+                length += get_length(query.start, path);
+            }
+            latencies.push_back(get_seconds(start) * 1e3);
+        }
+        std::string mode{deadline.count() == 0 ? "portfolio" :
+                         "portfolio+" + std::to_string(
+                                 deadline.count() / 1000000) + "ms"};
+        print(map, mode, found, latencies, length);
+        std::cout << std::setw(26) << "wins:";
+        for (const r2d2::PortfolioStatistics &statistics :
+                portfolio.get_statistics()) {
+            std::cout << " " << statistics.name << "=" << statistics.wins;
+        }
+        std::cout << std::endl;
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int size = argc > 1 ? std::atoi(argv[1]) : 256;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 32;
+    int deadline = argc > 3 ? std::atoi(argv[3]) : 20;
+
+    std::cout << std::fixed << std::setprecision(2) << std::setw(10) << "map"
+              << std::setw(16) << "mode" << std::setw(8) << "found"
+              << std::setw(12) << "mean ms" << std::setw(12) << "p95 ms"
+              << std::setw(12) << "length m" << std::endl;
+    struct {
+        const char *name;
+        r2d2::ScenarioKind kind;
+        double density;
+    } maps[] = {{"random", r2d2::ScenarioKind::RANDOM, .2},
+                {"rooms", r2d2::ScenarioKind::ROOMS, 0},
+                {"maze", r2d2::ScenarioKind::MAZE, 0},
+                {"caves", r2d2::ScenarioKind::CAVES, .45}};
+    for (const auto &map : maps) {
+        r2d2::Scenario scenario{r2d2::ScenarioGenerator{
+                map.kind, size, size, 42, map.density}.make_scenario(
+                queryCount)};
+        run(map.name, scenario, std::chrono::nanoseconds{0});
+        run(map.name, scenario, std::chrono::milliseconds(deadline));
+    }
+    return 0;
+}
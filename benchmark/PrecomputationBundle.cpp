@@ -0,0 +1,148 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PrecomputationBundle.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Precomputation bundle benchmark
+//!
+//! Compares the startup of the lattice and visibility graph planners that
+//! make their indices from the map against planners that load them from a
+//! precomputation bundle.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/VisibilityGraphPathFinder.hpp"
+#include "LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    double milliseconds_since(std::chrono::steady_clock::time_point begin) {
+        return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - begin).count();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int mapSize = argc > 1 ? std::atoi(argv[1]) : 512;
+    std::string path = argc > 2 ? argv[2] : "precomputation.bundle";
+
+    // rooms of 64 cells with doors, and racks in every room
+    std::mt19937_64 random{42};
+    r2d2::GridMap grid{{}, r2d2::Length::METER, mapSize, mapSize,
+                       r2d2::GridMap::FREE};
+    for (int i = 0; i < mapSize; i++) {
+        for (int wall = 0; wall < mapSize; wall += 64) {
+            if (i % 64 < 28 || i % 64 > 35) {
+                grid.set_cell(wall, i, r2d2::GridMap::OBSTACLE);
+                grid.set_cell(i, wall, r2d2::GridMap::OBSTACLE);
+            }
+        }
+    }
+    std::uniform_int_distribution<int> cellDist{0, mapSize - 1};
+    for (int rack = 0; rack < mapSize * mapSize / 8192; rack++) {
+        int x = cellDist(random), y = cellDist(random);
+        for (int i = 0; i < 12 && x + i < mapSize; i++) {
+            grid.set_cell(x + i, y, r2d2::GridMap::OBSTACLE);
+        }
+    }
+    r2d2::Coordinate start{make_coordinate(10.5, 10.5)},
+            goal{make_coordinate(mapSize - 10.5, mapSize - 10.5)};
+
+    r2d2::Box robot{{}, r2d2::Translation{.8 * r2d2::Length::METER,
+                                          .8 * r2d2::Length::METER,
+                                          0 * r2d2::Length::METER}};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    std::vector<r2d2::Coordinate> result;
+    std::cout << std::fixed << std::setprecision(1) << "map " << mapSize
+              << "x" << mapSize << std::endl;
+
+    // cold start: the first query makes the indices
+    auto begin = std::chrono::steady_clock::now();
+    double coldTime;
+    {
+        r2d2::AStarPathFinder lattice{sharedMap, robot};
+        r2d2::VisibilityGraphPathFinder visibility{sharedMap, robot};
+        bool found = lattice.get_path_to_coordinate(start, goal, result) &&
+                     visibility.get_path_to_coordinate(start, goal, result);
+        coldTime = milliseconds_since(begin);
+        std::cout << "cold start and first queries: " << coldTime << " ms"
+                  << (found ? "" : " (no path)") << std::endl;
+
+        begin = std::chrono::steady_clock::now();
+        r2d2::PrecomputationBundle bundle;
+        lattice.save_precomputation(bundle);
+        visibility.save_precomputation(bundle);
+        bundle.save(path);
+        std::cout << "bundle written in " << milliseconds_since(begin)
+                  << " ms" << std::endl;
+    }
+
+    // warm start: the indices come from the bundle, the map is only hashed
+    begin = std::chrono::steady_clock::now();
+    std::shared_ptr<const r2d2::PrecomputationBundle> bundle{
+            r2d2::PrecomputationBundle::open(path)};
+    double openTime = milliseconds_since(begin);
+    r2d2::AStarPathFinder lattice{sharedMap, robot};
+    r2d2::VisibilityGraphPathFinder visibility{sharedMap, robot};
+    bool loaded = lattice.load_precomputation(*bundle) &&
+                  visibility.load_precomputation(*bundle);
+    double loadTime = milliseconds_since(begin);
+    bool found = lattice.get_path_to_coordinate(start, goal, result) &&
+                 visibility.get_path_to_coordinate(start, goal, result);
+    double warmTime = milliseconds_since(begin);
+    std::cout << "warm start: opened in " << openTime << " ms, loaded in "
+              << loadTime << " ms" << (loaded ? "" : " (rejected)")
+              << std::endl;
+    std::cout << "warm start and first queries: " << warmTime << " ms"
+              << (found ? "" : " (no path)") << ", "
+              << std::setprecision(1) << coldTime / warmTime << "x faster"
+              << std::endl;
+    std::remove(path.c_str());
+    return loaded ? 0 : 1;
+}
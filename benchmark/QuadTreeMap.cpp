@@ -0,0 +1,189 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QuadTreeMap.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  Quadtree map benchmark
+//!
+//! Compares the memory use and query times of the quadtree map against the
+//! flat grid it was built from, for box queries and for path queries with the
+//! lattice search and the quadtree leaf search.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <atomic>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/QuadTreePathFinder.hpp"
+#include "LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    double seconds_since(std::chrono::steady_clock::time_point begin) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin).count();
+    }
+
+    /**
+     * time a set of path queries
+     *
+     * \return the average time per query in milliseconds
+     */
+    double time_queries(r2d2::PathFinder &pathFinder,
+                        const std::vector<std::pair<r2d2::Coordinate,
+                                r2d2::Coordinate>> &queries, int &found) {
+        std::vector<r2d2::Coordinate> path;
+        found = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (const std::pair<r2d2::Coordinate, r2d2::Coordinate> &query : queries) {
+            if (pathFinder.get_path_to_coordinate(query.first, query.second,
+                                                  path)) {
+                found++;
+            }
+        }
+        return seconds_since(begin) * 1000 / queries.size();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int mapSize = argc > 1 ? std::atoi(argv[1]) : 512;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    // a warehouse like map: rooms of 64 cells with doors, and a few racks
+    // in every room. most of the map is open floor
+    std::mt19937_64 random{42};
+    r2d2::GridMap grid{{}, r2d2::Length::METER, mapSize, mapSize,
+                       r2d2::GridMap::FREE};
+    for (int i = 0; i < mapSize; i++) {
+        for (int wall = 0; wall < mapSize; wall += 64) {
+            if (i % 64 < 28 || i % 64 > 35) {
+                grid.set_cell(wall, i, r2d2::GridMap::OBSTACLE);
+                grid.set_cell(i, wall, r2d2::GridMap::OBSTACLE);
+            }
+        }
+    }
+    std::uniform_int_distribution<int> cellDist{0, mapSize - 1};
+    for (int rack = 0; rack < mapSize * mapSize / 8192; rack++) {
+        int x = cellDist(random), y = cellDist(random);
+        for (int i = 0; i < 12 && x + i < mapSize; i++) {
+            grid.set_cell(x + i, y, r2d2::GridMap::OBSTACLE);
+        }
+    }
+    std::vector<std::pair<r2d2::Coordinate, r2d2::Coordinate>> queries;
+    while (int(queries.size()) < queryCount) {
+        int sx = cellDist(random), sy = cellDist(random),
+                gx = cellDist(random), gy = cellDist(random);
+        if (grid.get_cell(sx, sy) == r2d2::GridMap::FREE &&
+            grid.get_cell(gx, gy) == r2d2::GridMap::FREE) {
+            queries.emplace_back(make_coordinate(sx + .5, sy + .5),
+                                 make_coordinate(gx + .5, gy + .5));
+        }
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    r2d2::QuadTreeMap tree{grid};
+    double buildTime = seconds_since(begin);
+    std::cout << "map " << mapSize << "x" << mapSize << ", "
+              << tree.get_leaf_count() << " leaves, built in "
+              << std::fixed << std::setprecision(1) << buildTime * 1000
+              << " ms" << std::endl;
+    std::cout << "memory: grid " << grid.get_cells().capacity() / 1024
+              << " KiB, quadtree " << tree.get_memory_usage() / 1024
+              << " KiB" << std::endl;
+
+    // box queries of the sizes the pathfinder makes, and much larger ones
+    int obstacles = 0;
+    for (double maxSize : {2.0, 64.0}) {
+        std::uniform_real_distribution<double> position{0, double(mapSize)},
+                size{0, maxSize};
+        std::vector<r2d2::Box> boxes;
+        for (int i = 0; i < 100000; i++) {
+            boxes.emplace_back(
+                    make_coordinate(position(random), position(random)),
+                    r2d2::Translation{size(random) * r2d2::Length::METER,
+                                      size(random) * r2d2::Length::METER,
+                                      0 * r2d2::Length::METER});
+        }
+        for (r2d2::ReadOnlyMap *map : {static_cast<r2d2::ReadOnlyMap *>(&grid),
+                                       static_cast<r2d2::ReadOnlyMap *>(&tree)}) {
+            begin = std::chrono::steady_clock::now();
+            for (const r2d2::Box &box : boxes) {
+                obstacles += map->get_box_info(box).get_has_obstacle() ? 1 : 0;
+            }
+            std::cout << "boxes up to " << std::setprecision(0) << maxSize
+                      << " m on the " << (map == &grid ? "grid: " : "tree: ")
+                      << std::setprecision(1)
+                      << seconds_since(begin) * 1e9 / boxes.size()
+                      << " ns/query" << std::endl;
+        }
+    }
+
+    r2d2::Box robot{{}, r2d2::Translation{.8 * r2d2::Length::METER,
+                                          .8 * r2d2::Length::METER,
+                                          0 * r2d2::Length::METER}};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedGrid{grid}, sharedTree{tree};
+    r2d2::AStarPathFinder gridLattice{sharedGrid, robot},
+            treeLattice{sharedTree, robot};
+    r2d2::QuadTreePathFinder leaves{sharedTree, robot};
+    begin = std::chrono::steady_clock::now();
+    std::shared_ptr<const r2d2::QuadTreeMap> space{leaves.get_free_space()};
+    std::cout << "free space tree: " << space->get_leaf_count()
+              << " leaves, built in " << std::setprecision(1)
+              << seconds_since(begin) * 1000 << " ms" << std::endl;
+
+    int found;
+    std::cout << std::setw(24) << "path queries" << std::setw(12) << "ms/query"
+              << std::setw(8) << "found" << std::endl;
+    double time = time_queries(gridLattice, queries, found);
+    std::cout << std::setw(24) << "lattice on grid" << std::setw(12)
+              << std::setprecision(2) << time << std::setw(8) << found
+              << std::endl;
+    time = time_queries(treeLattice, queries, found);
+    std::cout << std::setw(24) << "lattice on quadtree" << std::setw(12)
+              << time << std::setw(8) << found << std::endl;
+    time = time_queries(leaves, queries, found);
+    std::cout << std::setw(24) << "leaves on quadtree" << std::setw(12)
+              << time << std::setw(8) << found << std::endl;
+    return obstacles < 0;
+}
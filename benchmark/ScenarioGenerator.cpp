@@ -0,0 +1,115 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ScenarioGenerator.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Benchmark of the scenario generator
+//!
+//! Measures how fast maps of every kind are generated, for growing sizes and
+//! thread counts, and how long the reference queries take.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include "../source/include/ScenarioGenerator.hpp"
+
+namespace {
+
+    double get_seconds(std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - since).count();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    // 10000 generates maps of 10^8 cells
+    int maxSize = argc > 1 ? std::atoi(argv[1]) : 4096;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 16;
+    int cores = int(std::max(1u, std::thread::hardware_concurrency()));
+
+    std::cout << std::fixed << std::setw(10) << "kind" << std::setw(8)
+              << "size" << std::setw(9) << "threads" << std::setw(14)
+              << "Mcells/s" << std::setw(12) << "free %" << std::setw(12)
+              << "queries/s" << std::endl;
+    for (r2d2::ScenarioKind kind : {r2d2::ScenarioKind::RANDOM,
+                                    r2d2::ScenarioKind::ROOMS,
+                                    r2d2::ScenarioKind::MAZE,
+                                    r2d2::ScenarioKind::CAVES,
+                                    r2d2::ScenarioKind::WAREHOUSE,
+                                    r2d2::ScenarioKind::CORRIDORS}) {
+        for (int size = 256; size <= maxSize; size *= 4) {
+            r2d2::ScenarioGenerator generator{
+                    kind, size, size, 42,
+                    kind == r2d2::ScenarioKind::CAVES ? .45 : .25};
+            for (int threads = 1; threads <= cores; threads *= 2) {
+                std::chrono::steady_clock::time_point start{
+                        std::chrono::steady_clock::now()};
+                r2d2::GridMap map{generator.generate(threads)};
+                double seconds = get_seconds(start);
+                const std::vector<uint8_t> &cells = map.get_cells();
+                double free = double(std::count(cells.begin(), cells.end(),
+                                                r2d2::GridMap::FREE)) /
+                              cells.size();
+
+                std::cout << std::setw(10)
+                          << r2d2::get_scenario_kind_name(kind)
+                          << std::setw(8) << size << std::setw(9) << threads
+                          << std::setw(14) << std::setprecision(1)
+                          << cells.size() / seconds / 1e6 << std::setw(12)
+                          << 100 * free << std::setw(12);
+                // the reference searches only once per size, they are slow
+                if (threads == 1 && size <= 4096) {
+                    start = std::chrono::steady_clock::now();
+                    std::vector<r2d2::ScenarioQuery> queries{
+                            generator.make_queries(map, queryCount)};
+                    std::cout << queries.size() / get_seconds(start);
+                } else {
+                    std::cout << "-";
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
+    return 0;
+}
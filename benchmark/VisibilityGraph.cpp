@@ -0,0 +1,169 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   VisibilityGraph.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Visibility graph benchmark
+//!
+//! Compares the build time and query times of the visibility graph pathfinder
+//! with the lattice search on a warehouse like map.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/VisibilityGraphPathFinder.hpp"
+#include "LockingSharedObject.hpp"
+#include "../test/TestHelpers.hpp"
+
+namespace {
+
+    double seconds_since(std::chrono::steady_clock::time_point begin) {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin).count();
+    }
+
+    /**
+     * time a set of path queries
+     *
+     * \param lengths receives the length of every path, -1 if not found
+     * \return the average time per query in milliseconds
+     */
+    double time_queries(r2d2::PathFinder &pathFinder,
+                        const std::vector<std::pair<r2d2::Coordinate,
+                                r2d2::Coordinate>> &queries,
+                        std::vector<double> &lengths) {
+        std::vector<r2d2::Coordinate> path;
+        lengths.assign(queries.size(), -1);
+        auto begin = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            if (pathFinder.get_path_to_coordinate(queries[i].first,
+                                                  queries[i].second, path)) {
+                r2d2::Coordinate from = queries[i].first;
+                lengths[i] = 0;
+                for (const r2d2::Coordinate &to : path) {
+                    lengths[i] += (to - from).get_length() / r2d2::Length::METER;
+                    from = to;
+                }
+            }
+        }
+        return seconds_since(begin) * 1000 / queries.size();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    int mapSize = argc > 1 ? std::atoi(argv[1]) : 400;
+    int queryCount = argc > 2 ? std::atoi(argv[2]) : 20;
+    int threadCount = argc > 3 ? std::atoi(argv[3]) : 0;
+
+    // a warehouse: rows of racks of 2x20 cells with aisles of 4 cells
+    // between them, and a cross aisle every rack
+    r2d2::GridMap grid{{}, r2d2::Length::METER, mapSize, mapSize,
+                       r2d2::GridMap::FREE};
+    for (int y = 8; y + 20 < mapSize - 8; y += 26) {
+        for (int x = 8; x + 2 < mapSize - 8; x += 6) {
+            for (int dy = 0; dy < 20; dy++) {
+                for (int dx = 0; dx < 2; dx++) {
+                    grid.set_cell(x + dx, y + dy, r2d2::GridMap::OBSTACLE);
+                }
+            }
+        }
+    }
+    std::mt19937_64 random{42};
+    std::uniform_int_distribution<int> cellDist{0, mapSize - 1};
+    std::vector<std::pair<r2d2::Coordinate, r2d2::Coordinate>> queries;
+    while (int(queries.size()) < queryCount) {
+        int sx = cellDist(random), sy = cellDist(random),
+                gx = cellDist(random), gy = cellDist(random);
+        if (grid.get_cell(sx, sy) == r2d2::GridMap::FREE &&
+            grid.get_cell(gx, gy) == r2d2::GridMap::FREE) {
+            queries.emplace_back(make_coordinate(sx + .5, sy + .5),
+                                 make_coordinate(gx + .5, gy + .5));
+        }
+    }
+
+    r2d2::Box robot{{}, r2d2::Translation{.8 * r2d2::Length::METER,
+                                          .8 * r2d2::Length::METER,
+                                          0 * r2d2::Length::METER}};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedGrid{grid};
+    r2d2::AStarPathFinder lattice{sharedGrid, robot};
+    r2d2::VisibilityGraphPathFinder visibility{
+            sharedGrid, robot, .5 * r2d2::Length::METER, threadCount};
+
+    auto begin = std::chrono::steady_clock::now();
+    std::shared_ptr<const r2d2::VisibilityGraph> graph{visibility.get_graph()};
+    std::cout << "map " << mapSize << "x" << mapSize << ", "
+              << graph->get_vertex_count() << " corners, "
+              << graph->get_edge_count() << " edges, built in "
+              << std::fixed << std::setprecision(1)
+              << seconds_since(begin) * 1000 << " ms, "
+              << graph->get_memory_usage() / 1024 << " KiB" << std::endl;
+
+    std::vector<double> latticeLengths, graphLengths;
+    double latticeTime = time_queries(lattice, queries, latticeLengths),
+            graphTime = time_queries(visibility, queries, graphLengths);
+    // the path lengths are only compared where both found a path
+    int latticeFound = 0, graphFound = 0;
+    double latticeLength = 0, graphLength = 0;
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        latticeFound += latticeLengths[i] >= 0;
+        graphFound += graphLengths[i] >= 0;
+        if (latticeLengths[i] >= 0 && graphLengths[i] >= 0) {
+            latticeLength += latticeLengths[i];
+            graphLength += graphLengths[i];
+        }
+    }
+    std::cout << std::setw(20) << "path queries" << std::setw(12) << "ms/query"
+              << std::setw(8) << "found" << std::setw(16) << "common length"
+              << std::endl;
+    std::cout << std::setw(20) << "lattice" << std::setw(12)
+              << std::setprecision(3) << latticeTime << std::setw(8)
+              << latticeFound << std::setw(16) << std::setprecision(1)
+              << latticeLength << std::endl;
+    std::cout << std::setw(20) << "visibility graph" << std::setw(12)
+              << std::setprecision(3) << graphTime << std::setw(8)
+              << graphFound << std::setw(16) << std::setprecision(1)
+              << graphLength << std::endl;
+    return 0;
+}
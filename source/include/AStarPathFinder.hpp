@@ -7,14 +7,14 @@
 //! \file   AStarPathFinder.hpp
 //! \author Chiel Douwes 1666311
 //! \date   Created: 30-03-2016
-//! \date   Last Modified: 15-4-2016
+//! \date   Last Modified: 19-10-2026
 //! \brief  Implementation of the pathfinder interface
 //!
 //! Takes a starting point and end point and a reference to a path.
 //! If a path is possible it returns a path to the end point. If no path is
 //! possible it will return false.
-//! This implementation uses A* for the search, which is defined in the
-//! "Astar" class.
+//! This implementation uses A* over a lattice anchored at the goal, with the
+//! search memory kept per thread in a SearchWorkspace.
 //!
 //! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
 //! All rights reserved.
@@ -52,8 +52,17 @@
 #define R2D2_PATHFINDING_ASTARPATHFINDER_HPP
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include "PathFinder.hpp"
 #include "Astar.hpp"
+#include "ConnectivityIndex.hpp"
+#include "DistanceField.hpp"
+#include "MapAccessGroup.hpp"
+#include "SearchWorkspace.hpp"
 
 // defines the amount of nodes that will be visited per length of the robot
 // for instance, if the robot has a size of 1m, and this value is 2, a node will
@@ -62,55 +71,504 @@
 
 namespace r2d2 {
 
+    /**
+     * the outcome of AStarPathFinder::repair_path
+     */
+    struct PathRepair {
+        enum class Status {
+            //! every segment of the path was clear
+            VALID,
+            //! blocked segments were replaced by local detours
+            REPAIRED,
+            //! a local detour was not found, the whole path was replaced
+            REPLANNED,
+            //! there is no path to the goal anymore
+            NOT_FOUND
+        };
+
+        Status status;
+        //! the first segment that was blocked, -1 if there was none
+        int blockedSegment;
+        std::chrono::nanoseconds validationTime, repairTime, replanTime;
+    };
+
+    /**
+     * the outcome of AStarPathFinder::get_path_to_coordinate_bounded
+     */
+    struct BoundedSearchInfo {
+        //! whether the path is the shortest one on the lattice, which is
+        //! only known for sure when no cheaper node had to be pruned
+        bool optimal;
+        //! the most memory the search used, in bytes
+        std::size_t peakMemory;
+        int prunedNodes;
+        int expandedNodes;
+    };
+
+    /**
+     * when the lattice edges of get_path_to_coordinate are checked against
+     * the map
+     */
+    enum class CollisionChecking {
+        //! when the node at the end of the edge is generated
+        EAGER,
+        //! when the node at the end of the edge is expanded, so the edges to
+        //! nodes that are never expanded are never checked
+        LAZY
+    };
+
+    /**
+     * the lattice and heuristic of a single query of
+     * AStarPathFinder::get_path_to_coordinate
+     */
+    struct SearchSettings {
+        /**
+         * \param collisionChecking see AStarPathFinder::set_collision_checking
+         * \param latticeScale the step between the lattice nodes as a
+         * multiple of the robot size divided by SQUARES_PER_ROBOT. a coarse
+         * lattice searches open space with fewer nodes, but misses passages
+         * that lie between its nodes
+         * \param heuristicWeight the factor of the heuristic, at least 1. a
+         * weight above one expands fewer nodes, and finds paths up to the
+         * weight times longer than the shortest path on the lattice
+         * \param maxStepScale the longest step in open space, as a multiple
+         * of the lattice step. above 1, a node whose surroundings are free
+         * of obstacles takes the longest step that stays in the free area,
+         * so open space is crossed with few nodes while passages are
+         * searched with the lattice step. such a search is not kept between
+         * queries, see AStarPathFinder::search_lattice
+         */
+        SearchSettings(CollisionChecking collisionChecking =
+                               CollisionChecking::EAGER,
+                       double latticeScale = 1, double heuristicWeight = 1,
+                       int maxStepScale = 1) :
+                collisionChecking{collisionChecking},
+                latticeScale{latticeScale},
+                heuristicWeight{heuristicWeight},
+                maxStepScale{maxStepScale} {
+        }
+
+        bool operator==(const SearchSettings &rhs) const {
+            return collisionChecking == rhs.collisionChecking &&
+                   latticeScale == rhs.latticeScale &&
+                   heuristicWeight == rhs.heuristicWeight &&
+                   maxStepScale == rhs.maxStepScale;
+        }
+
+        CollisionChecking collisionChecking;
+        double latticeScale;
+        double heuristicWeight;
+        int maxStepScale;
+    };
+
     /**
      * interface for a pathfinder module
      *
      * computes a path between two points on a map
+     * all public functions can be called from multiple threads at once, every
+     * query keeps its search state to itself. queries that run at the same
+     * time share a single accessor to the map, see MapAccessGroup.
+     * the search memory of a query is kept for the next query on the same
+     * thread, see SearchWorkspace.
+     * queries between positions that are not connected on the map are
+     * rejected without a search, see ConnectivityIndex. on a map that
+     * implements VersionedMap, the index is made by a background thread
+     * that the first query starts, and updated, and grown with the map, in
+     * the background once a query sees that the map version changed.
+     * while it is being made or out of date, queries search without it.
+     * with set_kept_search_budget, the searches of get_path_to_coordinate
+     * towards the last few goals are kept, so a robot that replans while
+     * driving to the same goal continues the previous search instead of
+     * starting over.
      */
     class AStarPathFinder : public PathFinder {
     public:
+        /**
+         * decides whether a position is a goal of get_path_to_goal
+         *
+         * the predicate is called with the map the query accesses, and only
+         * with positions the robot can be on.
+         */
+        typedef std::function<bool(ReadOnlyMap &map,
+                                   const Coordinate &position)> GoalPredicate;
+
         AStarPathFinder(SharedObject<ReadOnlyMap> &map, Box robotBox);
 
+        /**
+         * waits for the background work on the connectivity index
+         */
+        virtual ~AStarPathFinder();
+
         virtual bool get_path_to_coordinate(
                 Coordinate start,
                 Coordinate goal,
                 std::vector<Coordinate> &path) override;
 
-    private:
+        /**
+         * Returns a path between two points, unless the query is cancelled
+         *
+         * the search starts at the goal. when searches are kept, see
+         * set_kept_search_budget, it is kept for the next query towards the
+         * same goal, as long as the map version does not change. the cost
+         * of every node the search expanded is final, so when the start of
+         * a later query is next to expanded nodes it is answered without a
+         * search. otherwise the search continues with the heuristic towards
+         * the new start (repeated reverse A*).
+         * \param start The start coordinate
+         * \param goal The goal coordinate
+         * \param path Vector where the path need to be written to
+         * \param token the token that is checked once per expanded node
+         * \param expandedNodes if not nullptr, receives the amount of nodes
+         * this query expanded
+         * \return If it was able to find a path, false when cancelled
+         */
+        bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path,
+                const CancellationToken &token,
+                int *expandedNodes = nullptr);
+
+        /**
+         * Returns a path between two points with the given search settings,
+         * unless the query is cancelled
+         *
+         * queries with different settings can run at the same time, each
+         * kept search belongs to a single goal and settings. the steps of a
+         * search with a step scale above 1 depend on the start, so such a
+         * search is not kept. see the other overloads for the parameters.
+         * \param settings the lattice and heuristic of the search, the
+         * collision checking of set_collision_checking is not used
+         */
+        bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path,
+                const CancellationToken &token,
+                const SearchSettings &settings,
+                int *expandedNodes = nullptr);
 
         /**
-         * implementation of the astar node from Astar.hpp
+         * choose when get_path_to_coordinate checks lattice edges
+         *
+         * with LAZY checking, the successors of a node are opened without a
+         * map query. a node is only checked when it is taken from the open
+         * list: when the edge from its parent is blocked, its cheapest
+         * expanded neighbour it can be reached from becomes its parent and it
+         * is opened again with the higher cost, or it is dropped when there
+         * is none. the paths are as short as with EAGER checking, which is
+         * the default. LAZY saves the most queries on open maps, on maps
+         * with many small obstacles the repairs can cost more than they save.
+         * \param mode the mode used by the queries that start afterwards
          */
-        class CoordNode : public Node<CoordNode> {
-        public:
-            CoordNode(AStarPathFinder &pathFinder, Coordinate coord,
-                      Coordinate &startCoord,
-                      Length g = r2d2::Length::METER *
-                                 std::numeric_limits<double>::infinity(),
-                      std::weak_ptr<CoordNode> parent = {});
+        void set_collision_checking(CollisionChecking mode) {
+            collisionChecking = mode;
+        }
 
-            virtual bool operator==(const CoordNode &lhs) const override;
+        CollisionChecking get_collision_checking() const {
+            return collisionChecking;
+        }
 
-            virtual std::vector<CoordNode> get_available_nodes(
-                    std::shared_ptr<CoordNode> &self) override;
+        /**
+         * keep the searches of get_path_to_coordinate between queries
+         *
+         * only one query at a time continues a kept search, the queries
+         * towards the same goal that run meanwhile search anew. when the
+         * kept searches hold more memory together than the budget, the
+         * least recently used ones are dropped. searches are only kept on
+         * maps that implement VersionedMap. by default no search is kept,
+         * and every query searches in the workspace of its thread.
+         * \param memoryBudget the memory the kept searches may hold
+         * together, in bytes, 0 to keep no searches
+         */
+        void set_kept_search_budget(std::size_t memoryBudget) {
+            keptSearchBudget = memoryBudget;
+        }
 
-            std::reference_wrapper<AStarPathFinder> pathFinder;
-            Coordinate coord;
-            std::reference_wrapper<Coordinate> startNodeCoord;
+        /**
+         * get the group the queries read the map through
+         *
+         * a wrapper that reads the map with a lease of this group joins the
+         * running queries, instead of waiting for them on a locking map.
+         */
+        MapAccessGroup &get_map_access() {
+            return mapAccess;
+        }
 
-            friend std::ostream &operator<<(std::ostream &lhs,
-                                            const CoordNode &rhs) {
-                return lhs << "(" << rhs.coord << ",	" << rhs.g
-                       << ",	" << rhs.h << ",	" << rhs.f << ")";
-            }
+        /**
+         * Returns a path between two points, searching with multiple threads
+         *
+         * the lattice nodes are divided over the threads by a hash of their
+         * position (hash distributed A*). every thread searches its own
+         * nodes and sends the nodes it generates for other threads to them.
+         * the search only ends when no thread has a node left that could
+         * lead to a cheaper path, so the path is optimal on the lattice.
+         * a thread only expands a node when no other thread has a cheaper
+         * one, and yields while it waits, so the threads need cores of
+         * their own to get a speedup.
+         * \param start The start coordinate
+         * \param goal The goal coordinate
+         * \param path Vector where the path need to be written to
+         * \param threadCount the amount of threads, 0 to use all cores
+         * \param pathCost if not nullptr, receives the cost of the path
+         * before it was smoothed
+         * \param expandedNodes if not nullptr, receives the amount of node
+         * expansions of all threads together
+         * \return If it was able to find a path
+         */
+        bool get_path_to_coordinate_parallel(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path,
+                int threadCount = 0,
+                Length *pathCost = nullptr,
+                int *expandedNodes = nullptr);
 
-        };
-        friend struct std::hash<CoordNode>;
+        /**
+         * Returns a path between two points, using at most a given amount of
+         * memory for the search
+         *
+         * the memory of the search grows as needed, up to the budget. when
+         * it is used up, the open and closed nodes without children
+         * that have the highest cost are pruned, so the search keeps going
+         * within the budget, but might no longer find the shortest path,
+         * or any path. the connectivity index of the map is shared between
+         * queries and not part of the budget.
+         * \param start The start coordinate
+         * \param goal The goal coordinate
+         * \param path Vector where the path need to be written to
+         * \param memoryBudget the memory the search may use, in bytes
+         * \param info if not nullptr, receives whether the path is optimal
+         * and how much memory was used
+         * \param token the token that is checked once per expanded node
+         * \return If it was able to find a path
+         */
+        bool get_path_to_coordinate_bounded(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path,
+                std::size_t memoryBudget,
+                BoundedSearchInfo *info = nullptr,
+                const CancellationToken &token = CancellationToken::never());
+
+        /**
+         * check a path against the current map, and repair it where blocked
+         *
+         * segment i goes from waypoint i - 1, or the start, to waypoint i.
+         * the segments are checked in order with the same footprint test
+         * the paths are made with, so a path of this pathfinder stays valid
+         * until the map changes. they are queried in batches that double in
+         * size while every segment is clear. for a blocked segment only the
+         * part of the path from the waypoint a window before it until the
+         * waypoint a window after it is searched again, with a limited
+         * amount of nodes.
+         * only when that fails, the whole path is searched again.
+         * \param start the position the path starts at
+         * \param path the waypoints, ending at the goal, replaced by the
+         * repaired path
+         * \param window the amount of segments around a blocked one that is
+         * replaced by a detour
+         * \param maxRepairNodes the amount of nodes a detour search may
+         * expand before the whole path is searched again
+         * \return what was done, and the time it took
+         */
+        PathRepair repair_path(Coordinate start, std::vector<Coordinate> &path,
+                               int window = 2, int maxRepairNodes = 5000);
+
+        /**
+         * check a compact path against the current map, and repair it where
+         * blocked, see repair_path
+         *
+         * the waypoints are checked as they were rounded. a repaired path
+         * keeps the origin and resolution of the path.
+         */
+        PathRepair repair_path(Coordinate start, CompactPath &path,
+                               int window = 2, int maxRepairNodes = 5000);
+
+        /**
+         * Returns a path to the closest position that satisfies a predicate
+         *
+         * a single uniform cost search expands from the start over the
+         * lattice, anchored at the start, and stops at the first position
+         * for which the predicate holds. this replaces a search for every
+         * candidate goal.
+         * \param start The start coordinate
+         * \param isGoal the predicate a goal has to satisfy
+         * \param path Vector where the path need to be written to
+         * \param token the token that is checked once per expanded node
+         * \return If a goal was found, false when cancelled
+         */
+        bool get_path_to_goal(
+                Coordinate start,
+                const GoalPredicate &isGoal,
+                std::vector<Coordinate> &path,
+                const CancellationToken &token = CancellationToken::never());
+
+        /**
+         * Returns a path to the closest frontier, see get_frontier_predicate
+         *
+         * \param start The start coordinate
+         * \param path Vector where the path need to be written to
+         * \param token the token that is checked once per expanded node
+         * \return If a frontier was found, false when cancelled
+         */
+        bool get_path_to_frontier(
+                Coordinate start,
+                std::vector<Coordinate> &path,
+                const CancellationToken &token = CancellationToken::never());
+
+        /**
+         * get the predicate for positions at the border of explored space
+         *
+         * a position is a frontier when the robot can be on it, and unknown
+         * space is within a single lattice step of the robot.
+         */
+        GoalPredicate get_frontier_predicate() const;
+
+        /**
+         * get the distance field towards a goal
+         *
+         * the field contains the cost to the goal for every node on the search
+         * lattice, so the paths of any amount of robots towards the same goal
+         * can be extracted with get_path_from_field.
+         * fields are cached per goal. a cached field is returned as long as
+         * the map version did not change, otherwise it is computed again.
+         * fields of an older map version are dropped from the cache, and
+         * the least recently used fields are dropped once there are more
+         * than 16, or once they use more than 256 MB together.
+         * \param goal the coordinate all paths in the field lead to
+         * \param threadCount the amount of threads used for computing the
+         * field, 0 to use all cores
+         * \return the field, or nullptr if the robot cannot be on the goal
+         */
+        std::shared_ptr<const DistanceField> get_distance_field(
+                Coordinate goal, int threadCount = 0);
+
+        /**
+         * extract a path from a distance field
+         *
+         * the path is found by following the field downhill from the start,
+         * which takes time proportional to the length of the path.
+         * \param field the field towards the goal, created by this pathfinder
+         * \param start the start coordinate
+         * \param path vector where the path will be written to
+         * \return false if there is no path, or the field is out of date
+         */
+        bool get_path_from_field(const DistanceField &field,
+                                 Coordinate start,
+                                 std::vector<Coordinate> &path);
+
+        /**
+         * update the connectivity index after a part of the map changed
+         *
+         * without this call, the first query that sees the new map version
+         * updates the index in the background, which checks the whole map.
+         * this update only queries the map near the changed region, and
+         * only copies the parts of the index it changes, as queries that are
+         * running keep using the index they started with.
+         * \param region the area of the map that changed
+         */
+        void update_connectivity(const Box &region);
+
+        /**
+         * wait until the connectivity index is no longer made or updated in
+         * the background
+         *
+         * queries never wait for the index, this is for callers that want
+         * the index to reject queries from the next query on.
+         */
+        void wait_for_connectivity();
+
+        /**
+         * add the connectivity index of the current map to a bundle
+         *
+         * the index is made first when needed. the bundle should have been
+         * made for the same map.
+         * \param bundle the bundle that receives a "connectivity" section
+         */
+        void save_precomputation(PrecomputationBundle &bundle);
+
+        /**
+         * use the connectivity index of a bundle instead of making it
+         *
+         * the bundle is only used when it matches the current map content
+         * and holds an index for the same robot size, and the map
+         * implements VersionedMap.
+         * \param bundle the bundle to read
+         * \return whether the index was taken from the bundle
+         * \throws std::runtime_error if the section is not a valid index
+         */
+        bool load_precomputation(const PrecomputationBundle &bundle);
+
+    private:
+        class BoundedSearch;
+        class ParallelSearch;
+        class ResumableSearch;
+
+        //! the amount of searches that are kept, one per goal and settings
+        static const int MAX_RESUMABLE_SEARCHES = 4;
+
+        //! the amount of distance fields that are cached, one per goal
+        static const int MAX_DISTANCE_FIELDS = 16;
+
+        //! the memory the cached distance fields may use together, the most
+        //! recently used field is kept even when it is larger
+        static const std::size_t DISTANCE_FIELD_MEMORY = std::size_t(256) << 20;
+
+        //! the amount of moves smooth_path checks in its first batch per
+        //! anchor node, and repair_path in its first batch of segments
+        static const std::size_t SMOOTH_BATCH = 4;
+
+        MapAccessGroup mapAccess;
+        const Translation robotBox;
+        std::atomic<CollisionChecking> collisionChecking;
+
+        std::mutex distanceFieldMutex;
+        //! the cached fields, the least recently used first
+        std::vector<std::shared_ptr<const DistanceField>> distanceFields;
+
+        std::mutex connectivityMutex;
+        std::condition_variable connectivityChanged;
+        std::shared_ptr<const ConnectivityIndex> connectivity;
+        //! whether the background thread is making or updating the index
+        bool connectivityBuilding;
+        //! the last background thread, joined before the next one starts
+        std::thread connectivityThread;
+
+        std::atomic<std::size_t> keptSearchBudget;
+        std::mutex resumableMutex;
+        //! the kept searches, the one used last at the back
+        std::vector<std::shared_ptr<ResumableSearch>> resumableSearches;
+
+        /**
+         * get the connectivity index of the current map version
+         *
+         * when there is no index for the current version of a versioned map,
+         * a background thread is started to make or update it, unless one
+         * is running already.
+         * \return the index, or nullptr when the map is not versioned or
+         * the index is not current
+         */
+        std::shared_ptr<const ConnectivityIndex> get_connectivity(
+                ReadOnlyMap &map);
 
-        SharedObject<ReadOnlyMap> &map;
-        std::weak_ptr<SharedObject<ReadOnlyMap>::Accessor> mapAccessor;
-        std::atomic<int> referenceCount;
-        Translation robotBox;
+        /**
+         * make the connectivity index, or update it to the current map,
+         * run by the background thread
+         */
+        void build_connectivity();
+
+        /**
+         * check with a connectivity index whether two positions can be
+         * connected
+         *
+         * \param index the index, or nullptr when there is none, then every
+         * two positions can be
+         * \param component receives the component of both, 0 without index
+         */
+        static bool is_connected(const ConnectivityIndex *index,
+                                 const Coordinate &start,
+                                 const Coordinate &goal, int &component);
 
         /**
          * test whether it is possible to travel from "from" directly to "to"
@@ -119,12 +577,30 @@ namespace r2d2 {
          * direct path between "from" and "to". the function may return false
          * even if the is a direct connection because it has to absolutely
          * certain.
+         * \param map the map to test on
          * \param from the coordinate that will be travelled from
          * \param to the coordinate that will be travelled to from "from"
          * \return true if it is guaranteed that the robot can travel from
          * "from" to "to"
          */
-        bool can_travel(const Coordinate &from, const Coordinate &to);
+        bool can_travel(ReadOnlyMap &map, const Coordinate &from,
+                        const Coordinate &to) const;
+
+        /**
+         * get the box that can_travel queries for a move
+         *
+         * \param from the coordinate that will be travelled from
+         * \param to the coordinate that will be travelled to from "from"
+         * \return the area the robot sweeps, for a batched query
+         */
+        Box get_travel_box(const Coordinate &from, const Coordinate &to) const;
+
+        /**
+         * check the answer to a box of get_travel_box, see can_travel
+         */
+        static bool is_clear(const BoxInfo &info) {
+            return !(info.get_has_obstacle() || info.get_has_unknown());
+        }
 
         /**
          * check whether a coordinate will be overlapped by the robot when
@@ -137,7 +613,7 @@ namespace r2d2 {
          * with the robot
          * \return c1 overlaps c2 within the size of the robot
          */
-        bool overlaps(const Coordinate &c1, const Coordinate &c2);
+        bool overlaps(const Coordinate &c1, const Coordinate &c2) const;
 
         /**
          * get the traversed distance if the robot goes from {0, 0} to "coord"
@@ -148,20 +624,121 @@ namespace r2d2 {
         static Length get_heuristic(Translation coord);
 
         /**
-         * extracts a path from a pathfinder search field
+         * find a path on an accessed map with a search that is not kept, see
+         * get_path_to_coordinate
          *
-         * \param start the node to start the search from
-         * \return the computed path from the supplied node to the goal node
+         * when a search with steps of several lattice steps runs out of
+         * nodes to expand, the lattice is searched again with fixed steps,
+         * so a path is found whenever the fixed lattice has one.
+         * \param maxNodes the amount of nodes expanded before giving up
+         * \param settings the lattice and heuristic of the search
+         * \param expandedNodes if not nullptr, receives the amount of
+         * expanded nodes
          */
-        std::vector<CoordNode> get_path(std::shared_ptr<CoordNode> start);
+        bool find_path(ReadOnlyMap &map, Coordinate start, Coordinate goal,
+                       std::vector<Coordinate> &path,
+                       const CancellationToken &token, int maxNodes,
+                       const SearchSettings &settings = SearchSettings{},
+                       int *expandedNodes = nullptr);
+
+        /**
+         * find a path with the kept search towards the goal, see
+         * get_path_to_coordinate
+         *
+         * when no search is kept for the query, or another query is using
+         * it, the query searches in the workspace of its thread.
+         *
+         * \param settings the lattice and heuristic of the search
+         * \param expandedNodes receives the amount of expanded nodes
+         */
+        bool find_path_resumed(ReadOnlyMap &map, Coordinate start,
+                               Coordinate goal, std::vector<Coordinate> &path,
+                               const CancellationToken &token,
+                               const SearchSettings &settings,
+                               int &expandedNodes);
+
+        /**
+         * search the lattice from the goal towards the start
+         *
+         * the lattice is anchored at the goal, with the robot size times the
+         * lattice scale as step. a lattice node that overlaps the start is
+         * replaced by the start. on a coarser lattice, the closest node to
+         * the start and the ones around it also move to the start directly.
+         * the search ends as soon as the start is reached. nodes outside
+         * of the component of the start are never opened, when there is a
+         * connectivity index.
+         * with a step scale above 1, a node first checks the square around
+         * it that its moves of twice the step would sweep, and keeps
+         * doubling while the square is free and stays clear of the start.
+         * a node with a free square moves to the lattice nodes on its edge
+         * without checking the moves, near obstacles and the start the
+         * nodes move a single step as usual. the steps are multiples of the
+         * lattice step, so every node is a lattice node.
+         * \param map the map to search on
+         * \param start the start coordinate
+         * \param goal the goal coordinate
+         * \param path receives the path without the start, ending at the goal
+         * \param token the token that is checked once per expanded node
+         * \param workspace the memory used for the search
+         * \param connectivity the connectivity index of the map, or nullptr
+         * \param component the component of the start and the goal
+         * \param maxNodes the amount of nodes expanded before giving up
+         * \param settings the lattice, heuristic and step scale of the
+         * search, the collision checking is always eager
+         * \param expandedNodes receives the amount of expanded nodes
+         * \return whether the start was reached
+         */
+        bool search_lattice(ReadOnlyMap &map, Coordinate start, Coordinate goal,
+                            std::vector<Coordinate> &path,
+                            const CancellationToken &token,
+                            SearchWorkspace &workspace,
+                            const ConnectivityIndex *connectivity,
+                            int component, int maxNodes,
+                            const SearchSettings &settings,
+                            int &expandedNodes) const;
+
+        /**
+         * search the lattice from the start for the closest goal
+         *
+         * the lattice is anchored at the start, with the robot size as step.
+         * \param map the map to search on
+         * \param start the start coordinate
+         * \param isGoal the predicate a goal has to satisfy
+         * \param path receives the path without the start, ending at the goal
+         * \param token the token that is checked once per expanded node
+         * \param workspace the memory used for the search
+         * \return whether a goal was reached
+         */
+        bool search_uniform(ReadOnlyMap &map, Coordinate start,
+                            const GoalPredicate &isGoal,
+                            std::vector<Coordinate> &path,
+                            const CancellationToken &token,
+                            SearchWorkspace &workspace) const;
 
         /**
          * strips a path of all unnecessary nodes, smoothing the path in the process
          *
+         * \param map the map to check the smoothed path against
          * \param path the path to smooth
          * \param start the original start coordinate
          */
-        void smooth_path(std::vector<Coordinate> &path, Coordinate start);
+        void smooth_path(ReadOnlyMap &map, std::vector<Coordinate> &path,
+                         Coordinate start) const;
+
+        /**
+         * compute the distance field towards a goal
+         *
+         * first the travelable edges of the lattice are determined, which is
+         * where all map queries happen. after that a wavefront is expanded
+         * from the goal until the costs no longer change. both phases are
+         * divided over the given amount of threads.
+         * \param map the map to compute the field on
+         * \param goal the goal of the field
+         * \param threadCount the amount of threads to use, 0 for all cores
+         * \return the field, or nullptr if the robot cannot be on the goal
+         */
+        std::shared_ptr<DistanceField> compute_distance_field(
+                ReadOnlyMap &map, Coordinate goal, int threadCount) const;
     };
 
 }
@@ -177,16 +754,6 @@ namespace std {
         }
     };
 
-    /**
-     * hash for the coordinate node class, used for set insertion
-     */
-    template<>
-    struct hash<r2d2::AStarPathFinder::CoordNode> {
-        std::size_t operator()(const r2d2::AStarPathFinder::CoordNode &node) const {
-            return std::hash<r2d2::Coordinate>()(node.coord);
-        }
-    };
-
 }
 
 #endif //R2D2_PATHFINDING_ASTARPATHFINDER_HPP
@@ -8,7 +8,7 @@
 //! \author Jasper Schoenmaker 1661818
 //! \author Chiel Douwes 1666311
 //! \date   Created: 29-03-2016
-//! \date   Last Modified: 15-4-2016
+//! \date   Last Modified: 19-10-2026
 //! \brief  A star algorithm
 //!
 //! Implementation of the A star algorithm, used for finding the actual path.
@@ -53,6 +53,7 @@
 #include <unordered_set>
 #include <iostream>
 #include <memory>
+#include "CancellationToken.hpp"
 
 namespace r2d2 {
 // value of 1,000,000 will support completely seaching a map of 1000x1000 nodes
@@ -136,10 +137,25 @@ namespace r2d2 {
          *         otherwise return nullptr
          */
         std::shared_ptr<T> search(T &start) {
+            return search(start, CancellationToken::never());
+        }
+
+        /**
+         * start the actual search towards the start node, stopping early when
+         * the token gets cancelled
+         *
+         * the token is checked once for every expanded node
+         * \param start the node the user wants to reach the end from
+         * \param token the token to check for cancellation
+         * \return a pointer to the newly created start node if it was found,
+         *         otherwise return nullptr, also when cancelled
+         */
+        std::shared_ptr<T> search(T &start, const CancellationToken &token) {
             // the amount of nodes left to search before the search is abandoned
             int giveUpCount = MAX_SEARCH_NODES;
 
-            while (!open.empty() && --giveUpCount >= 0) {
+            while (!open.empty() && --giveUpCount >= 0 &&
+                   !token.is_cancelled()) {
                 std::shared_ptr<T> curOpen{open[0]};
                 // use the heap methods from std,
                 // as this is a fitting use case
@@ -0,0 +1,176 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   AsyncPathFinder.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Asynchronous pathfinding queries
+//!
+//! Runs pathfinding queries on a pool of threads. Every query returns a future
+//! and a token for cancelling it, and a new query for a robot cancels the query
+//! that robot submitted before.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_ASYNCPATHFINDER_HPP
+#define R2D2_PATHFINDING_ASYNCPATHFINDER_HPP
+
+#include <future>
+#include <unordered_map>
+#include "AStarPathFinder.hpp"
+#include "CancellationToken.hpp"
+#include "ThreadPool.hpp"
+
+namespace r2d2 {
+
+    /**
+     * the outcome of an asynchronous query
+     */
+    struct PathResult {
+        enum class Status {
+            FOUND, NOT_FOUND, CANCELLED
+        };
+
+        Status status;
+        std::vector<Coordinate> path;
+    };
+
+    /**
+     * handle to a submitted query
+     */
+    class PathQuery {
+    public:
+        PathQuery(std::shared_future<PathResult> result,
+                  CancellationToken token) :
+                result{result},
+                token{token} {
+        }
+
+        /**
+         * ask the query to stop, the result will be CANCELLED unless the
+         * query already finished
+         */
+        void cancel() const {
+            token.cancel();
+        }
+
+        /**
+         * check whether the result is available without blocking
+         */
+        bool is_ready() const {
+            return result.wait_for(std::chrono::seconds(0)) ==
+                   std::future_status::ready;
+        }
+
+        /**
+         * wait for the query to finish and get its result
+         */
+        const PathResult &get() const {
+            return result.get();
+        }
+
+        const std::shared_future<PathResult> &get_future() const {
+            return result;
+        }
+
+        const CancellationToken &get_token() const {
+            return token;
+        }
+
+    private:
+        std::shared_future<PathResult> result;
+        CancellationToken token;
+    };
+
+    /**
+     * submits queries to a pathfinder without blocking the caller
+     *
+     * the queries run on a pool of worker threads using a single
+     * AStarPathFinder, which supports concurrent queries.
+     * a query that is cancelled before it starts is not run at all, a query
+     * that is already searching stops at its next node expansion.
+     */
+    class AsyncPathFinder {
+    public:
+        /**
+         * constructor
+         *
+         * \param pathFinder the pathfinder that answers the queries
+         * \param threadCount the amount of worker threads, 0 for all cores
+         */
+        AsyncPathFinder(AStarPathFinder &pathFinder, int threadCount = 0);
+
+        /**
+         * cancels all robot queries that are still running
+         */
+        ~AsyncPathFinder();
+
+        /**
+         * submit a query for a robot
+         *
+         * the previous query submitted for the same robot is cancelled, as
+         * its answer is no longer of use
+         * \param robotId identifies the robot the query is for
+         * \param start The start coordinate
+         * \param goal The goal coordinate
+         * \return a handle to the query
+         */
+        PathQuery submit(int robotId, Coordinate start, Coordinate goal);
+
+        /**
+         * submit a query that is not tied to a robot
+         *
+         * \param start The start coordinate
+         * \param goal The goal coordinate
+         * \return a handle to the query
+         */
+        PathQuery submit(Coordinate start, Coordinate goal);
+
+    private:
+        PathQuery run(Coordinate start, Coordinate goal,
+                      CancellationToken token);
+
+        AStarPathFinder &pathFinder;
+        std::mutex mutex;
+        std::unordered_map<int, CancellationToken> latest;
+        // the pool is destroyed first, so no worker outlives the rest
+        ThreadPool pool;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_ASYNCPATHFINDER_HPP
@@ -0,0 +1,252 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   BatchedMap.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Batched box queries
+//!
+//! Interface for maps that answer several box queries at once, and a reusable
+//! batch of queries.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_BATCHEDMAP_HPP
+#define R2D2_PATHFINDING_BATCHEDMAP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <MapInterface.hpp>
+
+namespace r2d2 {
+
+    /**
+     * interface for maps that can answer several box queries at once
+     *
+     * a search checks the boxes around a node together, and those boxes
+     * mostly overlap. a map implementing this interface can look at the
+     * shared cells once, instead of once per box. maps that do not implement
+     * it are queried one box at a time.
+     */
+    class BatchedMap {
+    public:
+        virtual ~BatchedMap() { }
+
+        /**
+         * get the information of several boxes
+         *
+         * \param boxes the boxes to query
+         * \param infos receives the information of every box, in the same
+         * order as the boxes, as get_box_info would return it
+         */
+        virtual void get_box_infos(const std::vector<Box> &boxes,
+                                   std::vector<BoxInfo> &infos) = 0;
+
+        /**
+         * get the batched interface of a map, or nullptr if the map is not
+         * batched
+         */
+        static BatchedMap *get_batched(ReadOnlyMap &map) {
+            return dynamic_cast<BatchedMap *>(&map);
+        }
+
+    protected:
+        //! an inclusive range of cells, which can lie outside of the grid
+        struct CellRange {
+            int minX, minY, maxX, maxY;
+        };
+
+        /**
+         * answer a batch on a grid of cells
+         *
+         * the union of the cells of the boxes is read once into a bit mask
+         * per row and kind, and every box is answered from the rows it
+         * covers. when the union is wider than a mask, or larger than the
+         * boxes together, every box is scanned by itself instead.
+         * \param get_range gives the CellRange of a Box
+         * \param get_cell gives the kind of the cell at x, y: 0 for free, 1
+         * for an obstacle, 2 for unknown, other values are ignored
+         */
+        template<typename GetRange, typename GetCell>
+        static void scan_cells(const std::vector<Box> &boxes,
+                               std::vector<BoxInfo> &infos, int width,
+                               int height, GetRange get_range,
+                               GetCell get_cell);
+    };
+
+    /**
+     * a list of boxes that is queried at once on a map
+     *
+     * finding out whether a map is batched costs about as much as a box
+     * query, so a batch does it once for all its queries. the lists of the
+     * batches are kept per thread, so a thread can use only one batch at a
+     * time, and a batch needs no memory once the lists have grown.
+     */
+    class BoxBatch {
+    public:
+        /**
+         * \param map the map to query, which must outlive the batch
+         */
+        BoxBatch(ReadOnlyMap &map);
+
+        void clear() {
+            lists.boxes.clear();
+            lists.infos.clear();
+        }
+
+        void add(const Box &box) {
+            lists.boxes.push_back(box);
+        }
+
+        std::size_t size() const {
+            return lists.boxes.size();
+        }
+
+        /**
+         * query every added box
+         */
+        void query();
+
+        /**
+         * get the answer to a box, after query
+         *
+         * \param index the position of the box in the order it was added
+         */
+        const BoxInfo &get_info(std::size_t index) const {
+            return lists.infos[index];
+        }
+
+    private:
+        struct Lists {
+            std::vector<Box> boxes;
+            std::vector<BoxInfo> infos;
+        };
+
+        static Lists &get_thread_lists();
+
+        ReadOnlyMap &map;
+        BatchedMap *batched;
+        Lists &lists;
+    };
+
+    template<typename GetRange, typename GetCell>
+    void BatchedMap::scan_cells(const std::vector<Box> &boxes,
+                                std::vector<BoxInfo> &infos, int width,
+                                int height, GetRange get_range,
+                                GetCell get_cell) {
+        thread_local std::vector<CellRange> ranges;
+        // three masks per row of the union: free, obstacle and unknown
+        thread_local std::vector<uint64_t> rows;
+        ranges.clear();
+        infos.clear();
+        CellRange all{width, height, -1, -1};
+        int64_t boxCells = 0;
+        for (const Box &box : boxes) {
+            CellRange range = get_range(box);
+            ranges.push_back(range);
+            int minX = std::max(range.minX, 0), minY = std::max(range.minY, 0),
+                    maxX = std::min(range.maxX, width - 1),
+                    maxY = std::min(range.maxY, height - 1);
+            if (minX <= maxX && minY <= maxY) {
+                boxCells += int64_t(maxX - minX + 1) * (maxY - minY + 1);
+                all.minX = std::min(all.minX, minX);
+                all.minY = std::min(all.minY, minY);
+                all.maxX = std::max(all.maxX, maxX);
+                all.maxY = std::max(all.maxY, maxY);
+            }
+        }
+        int allWidth = all.maxX - all.minX + 1,
+                allHeight = all.maxY - all.minY + 1;
+        bool shared = boxes.size() > 1 && allWidth > 0 && allWidth <= 64 &&
+                      allHeight > 0 && int64_t(allWidth) * allHeight <= boxCells;
+        if (shared) {
+            rows.resize(3 * std::size_t(allHeight));
+            for (int y = 0; y < allHeight; y++) {
+                uint64_t free = 0, obstacle = 0, unknown = 0;
+                for (int x = 0; x < allWidth; x++) {
+                    int kind = get_cell(all.minX + x, all.minY + y);
+                    free |= uint64_t(kind == 0) << x;
+                    obstacle |= uint64_t(kind == 1) << x;
+                    unknown |= uint64_t(kind == 2) << x;
+                }
+                rows[3 * std::size_t(y)] = free;
+                rows[3 * std::size_t(y) + 1] = obstacle;
+                rows[3 * std::size_t(y) + 2] = unknown;
+            }
+        }
+        for (const CellRange &range : ranges) {
+            // everything outside of the grid is unknown
+            bool found[3] = {false, false,
+                             range.minX < 0 || range.minY < 0 ||
+                             range.maxX >= width || range.maxY >= height};
+            int minX = std::max(range.minX, 0), minY = std::max(range.minY, 0),
+                    maxX = std::min(range.maxX, width - 1),
+                    maxY = std::min(range.maxY, height - 1);
+            if (minX > maxX || minY > maxY) {
+                // nothing of the box lies on the grid
+            } else if (shared) {
+                // the shift wraps to zero for a mask of 64 bits
+                uint64_t mask = ((uint64_t(2) << (maxX - minX)) - 1)
+                        << (minX - all.minX);
+                uint64_t seen[3] = {0, 0, 0};
+                for (int y = minY; y <= maxY; y++) {
+                    const uint64_t *row = &rows[3 * std::size_t(y - all.minY)];
+                    seen[0] |= row[0];
+                    seen[1] |= row[1];
+                    seen[2] |= row[2];
+                }
+                for (int k = 0; k < 3; k++) {
+                    found[k] = found[k] || (seen[k] & mask) != 0;
+                }
+            } else {
+                for (int y = minY; y <= maxY; y++) {
+                    for (int x = minX; x <= maxX; x++) {
+                        int kind = get_cell(x, y);
+                        if (kind >= 0 && kind < 3) {
+                            found[kind] = true;
+                        }
+                    }
+                }
+            }
+            infos.push_back(BoxInfo{found[1], found[0], found[2]});
+        }
+    }
+
+}
+
+#endif //R2D2_PATHFINDING_BATCHEDMAP_HPP
@@ -0,0 +1,108 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CancellationToken.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Cooperative cancellation
+//!
+//! A token that can be used to ask a running query to stop.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_CANCELLATIONTOKEN_HPP
+#define R2D2_PATHFINDING_CANCELLATIONTOKEN_HPP
+
+#include <atomic>
+#include <memory>
+
+namespace r2d2 {
+
+    /**
+     * shared flag for cancelling a query
+     *
+     * copies of a token share the same flag, so the submitter of a query can
+     * keep a copy and cancel it while the search checks its own copy.
+     * cancelling is cooperative: the search checks the flag once per node
+     * expansion and stops as soon as it sees it set.
+     */
+    class CancellationToken {
+    public:
+        /**
+         * creates a new token that is not cancelled
+         */
+        CancellationToken() :
+                flag{std::make_shared<std::atomic<bool>>(false)} {
+        }
+
+        /**
+         * get a token that can never be cancelled
+         *
+         * checking this token costs a single comparison, and creating it does
+         * not allocate
+         */
+        static CancellationToken never() {
+            return CancellationToken{nullptr};
+        }
+
+        /**
+         * request the query using this token to stop
+         */
+        void cancel() const {
+            if (flag != nullptr) {
+                flag->store(true, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * check whether the query using this token should stop
+         */
+        bool is_cancelled() const {
+            return flag != nullptr && flag->load(std::memory_order_relaxed);
+        }
+
+    private:
+        CancellationToken(std::shared_ptr<std::atomic<bool>> flag) :
+                flag{flag} {
+        }
+
+        std::shared_ptr<std::atomic<bool>> flag;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_CANCELLATIONTOKEN_HPP
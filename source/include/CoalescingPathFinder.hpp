@@ -0,0 +1,170 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CoalescingPathFinder.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Coalescing pathfinder
+//!
+//! A pathfinder that answers equivalent queries that run at the same time
+//! with a single search.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_COALESCINGPATHFINDER_HPP
+#define R2D2_PATHFINDING_COALESCINGPATHFINDER_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "MapAccessGroup.hpp"
+#include "PathFinder.hpp"
+
+namespace r2d2 {
+
+    /**
+     * how many queries of a CoalescingPathFinder shared a search
+     */
+    struct CoalescingStatistics {
+        //! the queries that were asked
+        uint64_t queries;
+        //! the queries that ran a search
+        uint64_t searches;
+        //! the queries that received the result of an equivalent query
+        uint64_t coalesced;
+        //! the most queries that shared a single search
+        uint64_t largestGroup;
+
+        /**
+         * get the part of the queries that did not run a search
+         */
+        double get_dedup_rate() const {
+            return queries == 0 ? 0 : double(coalesced) / double(queries);
+        }
+    };
+
+    /**
+     * answers equivalent queries that run at the same time with a single
+     * search of another pathfinder
+     *
+     * two queries are equivalent when their starts lie in the same cell,
+     * their goals lie in the same cell, and the map has the same version.
+     * the footprint is the one of the wrapped pathfinder, so only the
+     * queries of a single wrapper are coalesced. the first query runs the
+     * search, equivalent queries that arrive before it finishes wait for it
+     * and receive a copy of its path. a query that arrives afterwards runs a
+     * search of its own, no results are kept.
+     * a waiting query receives a path that starts and ends in its cells,
+     * not exactly at its start and goal, so the cell size should be below
+     * the distance at which the robot counts as arrived.
+     */
+    class CoalescingPathFinder : public PathFinder {
+    public:
+        /**
+         * constructor
+         *
+         * \param map the map the wrapped pathfinder works on
+         * \param robotBox the robot size of the wrapped pathfinder
+         * \param pathFinder the pathfinder answering the queries
+         * \param mapAccess the group the map version is read through. with
+         * the group of the wrapped pathfinder, see
+         * AStarPathFinder::get_map_access, reading the version joins the
+         * running searches. with another group it waits for them on a
+         * locking map, and queries only coalesce while they wait for the map
+         * \param cellSize the size of the cells the starts and goals are
+         * rounded to
+         */
+        CoalescingPathFinder(SharedObject<ReadOnlyMap> &map, Box robotBox,
+                             PathFinder &pathFinder, MapAccessGroup &mapAccess,
+                             Length cellSize = .01 * Length::METER);
+
+        virtual bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path) override;
+
+        CoalescingStatistics get_statistics() const;
+
+        void reset_statistics();
+
+    private:
+        /**
+         * the cells and map version of a query
+         */
+        struct Key {
+            int64_t startX, startY, goalX, goalY;
+            uint64_t version;
+
+            bool operator==(const Key &rhs) const {
+                return startX == rhs.startX && startY == rhs.startY &&
+                       goalX == rhs.goalX && goalY == rhs.goalY &&
+                       version == rhs.version;
+            }
+        };
+
+        struct KeyHash {
+            std::size_t operator()(const Key &key) const;
+        };
+
+        /**
+         * a search that is running, and the queries that wait for it
+         */
+        struct Flight {
+            uint64_t queries;
+            bool finished;
+            bool found;
+            std::vector<Coordinate> path;
+        };
+
+        int64_t get_cell(Length position) const;
+
+        PathFinder &pathFinder;
+        MapAccessGroup &mapAccess;
+        const Length cellSize;
+
+        mutable std::mutex mutex;
+        //! notified when a search finished
+        std::condition_variable finished;
+        std::unordered_map<Key, std::shared_ptr<Flight>, KeyHash> flights;
+        CoalescingStatistics statistics;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_COALESCINGPATHFINDER_HPP
@@ -0,0 +1,284 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CompactPath.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Compact path
+//!
+//! A path stored as an origin and quantized deltas, which is decoded while it
+//! is iterated.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_COMPACTPATH_HPP
+#define R2D2_PATHFINDING_COMPACTPATH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include <Coordinate.hpp>
+
+namespace r2d2 {
+
+    /*
+     * the encoding is the x and y of the origin and the resolution as
+     * doubles in meters, and the amount of waypoints as a uint32, all in
+     * host byte order. every waypoint follows as its x and y distance to the
+     * previous waypoint, or the origin, in steps of the resolution. the
+     * distances are zigzag encoded varints of 7 bits per byte, so a step of
+     * a robot size at a millimeter takes four bytes. the planner ignores z,
+     * the waypoints are decoded with a z of 0.
+     */
+
+    /**
+     * a path encoded by CompactPath, read in place from memory it does not
+     * own
+     *
+     * a view can be made on a received buffer, so a path is used without
+     * copying or decoding it first. the memory must outlive the view.
+     */
+    class CompactPathView {
+    public:
+        /**
+         * iterates the waypoints, decoding one waypoint per step
+         */
+        class Iterator {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Coordinate value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const Coordinate *pointer;
+            typedef Coordinate reference;
+
+            Coordinate operator*() const;
+
+            Iterator &operator++();
+
+            Iterator operator++(int) {
+                Iterator old{*this};
+                ++*this;
+                return old;
+            }
+
+            bool operator==(const Iterator &rhs) const {
+                return index == rhs.index;
+            }
+
+            bool operator!=(const Iterator &rhs) const {
+                return index != rhs.index;
+            }
+
+        private:
+            friend class CompactPathView;
+
+            Iterator(const CompactPathView &view, uint32_t index);
+
+            void read();
+
+            const uint8_t *next;
+            double originX, originY, resolution;
+            int64_t x, y;
+            uint32_t index, count;
+        };
+
+        //! the size of the encoding without waypoints
+        static const std::size_t HEADER_SIZE = 28;
+
+        /**
+         * \param data the encoding of a path
+         * \param size the size of the encoding
+         * \throws std::runtime_error if the data is not exactly one encoded
+         * path
+         */
+        CompactPathView(const uint8_t *data, std::size_t size);
+
+        Iterator begin() const {
+            return Iterator{*this, 0};
+        }
+
+        Iterator end() const {
+            return Iterator{*this, count};
+        }
+
+        //! the amount of waypoints
+        std::size_t size() const {
+            return count;
+        }
+
+        bool empty() const {
+            return count == 0;
+        }
+
+        Coordinate get_origin() const;
+
+        Length get_resolution() const;
+
+        const uint8_t *data() const {
+            return bytes;
+        }
+
+        //! the size of the encoding in bytes
+        std::size_t get_byte_size() const {
+            return byteSize;
+        }
+
+        /**
+         * decode every waypoint
+         *
+         * \param path receives the waypoints
+         */
+        void decode(std::vector<Coordinate> &path) const;
+
+    private:
+        friend class CompactPath;
+
+        /**
+         * a view on an encoding that is known to be valid
+         */
+        static CompactPathView trust(const uint8_t *data, std::size_t size);
+
+        CompactPathView(const uint8_t *data, std::size_t size,
+                        uint32_t count) :
+                bytes{data},
+                byteSize{size},
+                count{count} {
+        }
+
+        const uint8_t *bytes;
+        std::size_t byteSize;
+        uint32_t count;
+    };
+
+    /**
+     * a path stored as an origin and quantized deltas
+     *
+     * a path of the pathfinder keeps three doubles per waypoint. this keeps
+     * the waypoints as steps of a resolution from the previous one, which
+     * takes a few bytes each. every waypoint is rounded to the resolution
+     * independently, so the error stays below half of the resolution however
+     * long the path is. the encoding is the only storage, so it can be
+     * written or sent as it is.
+     */
+    class CompactPath {
+    public:
+        typedef CompactPathView::Iterator Iterator;
+
+        /**
+         * an empty path at the origin
+         */
+        CompactPath();
+
+        /**
+         * encode a path
+         *
+         * \param origin the position the path starts at, the start of a
+         * query keeps the first delta short
+         * \param path the waypoints
+         * \param resolution the step the waypoints are rounded to, one
+         * millimeter by default
+         */
+        CompactPath(Coordinate origin, const std::vector<Coordinate> &path,
+                    Length resolution = .001 * Length::METER);
+
+        /**
+         * copy the encoding of a view
+         */
+        explicit CompactPath(const CompactPathView &view);
+
+        /**
+         * replace the path, keeping the memory
+         *
+         * see the constructor
+         */
+        void assign(Coordinate origin, const std::vector<Coordinate> &path,
+                    Length resolution = .001 * Length::METER);
+
+        CompactPathView get_view() const {
+            return CompactPathView::trust(bytes.data(), bytes.size());
+        }
+
+        Iterator begin() const {
+            return get_view().begin();
+        }
+
+        Iterator end() const {
+            return get_view().end();
+        }
+
+        std::size_t size() const {
+            return get_view().size();
+        }
+
+        bool empty() const {
+            return size() == 0;
+        }
+
+        Coordinate get_origin() const {
+            return get_view().get_origin();
+        }
+
+        Length get_resolution() const {
+            return get_view().get_resolution();
+        }
+
+        void decode(std::vector<Coordinate> &path) const {
+            get_view().decode(path);
+        }
+
+        /**
+         * get the encoding, to write or send it
+         */
+        const std::vector<uint8_t> &get_bytes() const {
+            return bytes;
+        }
+
+        /**
+         * get the memory the path takes, including the object itself
+         */
+        std::size_t get_memory_usage() const {
+            return sizeof(*this) + bytes.capacity();
+        }
+
+    private:
+        std::vector<uint8_t> bytes;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_COMPACTPATH_HPP
@@ -0,0 +1,226 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ConnectivityIndex.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Connected components of the free space
+//!
+//! Labels the positions the robot can possibly be on with connected components,
+//! so queries between different components can be rejected without a search.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_CONNECTIVITYINDEX_HPP
+#define R2D2_PATHFINDING_CONNECTIVITYINDEX_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <MapInterface.hpp>
+#include "PrecomputationBundle.hpp"
+
+namespace r2d2 {
+
+    /**
+     * connected components of the positions a robot can possibly be on
+     *
+     * the map is divided into cells of half the robot size. a cell is only
+     * blocked when every position of the robot in it overlaps an obstacle or
+     * unknown space, which is the case when the area all those positions
+     * share is not clear. the free cells are grouped into 8-connected
+     * components.
+     * a straight move that can_travel allows only passes clear positions, so
+     * every path the pathfinder can find stays within a single component.
+     * a query between two components, or from a blocked cell, has no path.
+     * the cells cover the map bounding box plus a margin of a meter and a
+     * robot size, as some maps only report unknown space a full map cell
+     * outside of their bounds. the cells grow with the map on update.
+     * the labels are stored in chunks that a copy of the index shares with
+     * the original, so updating a copy only copies the chunks it changes.
+     */
+    class ConnectivityIndex {
+    public:
+        /**
+         * label all cells of a map
+         *
+         * \param map the map to index
+         * \param robotBox the size of the robot
+         */
+        ConnectivityIndex(ReadOnlyMap &map, Translation robotBox);
+
+        /**
+         * read an index written by serialize
+         *
+         * \param in the data of the index
+         * \param mapVersion the version of the map the index is used for,
+         * which the caller has checked against the bundle
+         * \throws std::runtime_error if the data is not a valid index
+         */
+        ConnectivityIndex(PrecomputationBundle::Reader &in,
+                          uint64_t mapVersion);
+
+        /**
+         * write the index, so it can be read again without the map
+         *
+         * \param out receives the data of the index
+         */
+        void serialize(PrecomputationBundle::Writer &out) const;
+
+        /**
+         * update the index after a part of the map changed
+         *
+         * the cells near the region are checked again. free cells that
+         * appeared are joined with their neighbours, and components that lost
+         * a cell are labelled again, as they might have been split. when the
+         * map bounding box grew beyond the cells, cells are added around the
+         * existing ones and labelled as well. no other part of the map is
+         * queried.
+         * \param map the changed map
+         * \param region the area that changed
+         */
+        void update(ReadOnlyMap &map, const Box &region);
+
+        /**
+         * get the component of a position
+         *
+         * \param coord the position of the robot
+         * \return the component, or -1 if no robot can be there
+         */
+        int get_component(const Coordinate &coord) const;
+
+        /**
+         * get the area that the cells of a component cover
+         *
+         * \param component a component returned by get_component
+         */
+        Box get_component_bounds(int component) const;
+
+        /**
+         * get the amount of components
+         */
+        int get_component_count() const;
+
+        Translation get_robot_box() const {
+            return robotBox;
+        }
+
+        /**
+         * get the version of the map the index was made or updated for
+         */
+        uint64_t get_map_version() const {
+            return mapVersion;
+        }
+
+        /**
+         * get the amount of memory used by the index
+         *
+         * \return the size in bytes
+         */
+        std::size_t get_memory_usage() const;
+
+    private:
+        //! the labels of cells that are not in a component
+        static const int32_t BLOCKED = -1, UNLABELLED = -2;
+
+        //! the amount of cells in a chunk of labels is 1 << CHUNK_BITS
+        static const int CHUNK_BITS = 12;
+
+        struct Component {
+            int minX, minY, maxX, maxY;
+            // the amount of cells, 0 for an unused label
+            int cells;
+        };
+
+        Translation robotBox, cellSize;
+        Coordinate origin;
+        int width, height;
+        //! the label of every cell, row by row, in chunks
+        std::vector<std::shared_ptr<std::vector<int32_t>>> chunks;
+        std::vector<Component> components;
+        std::vector<int32_t> unused;
+        uint64_t mapVersion;
+
+        int32_t get_label(int cell) const {
+            return (*chunks[std::size_t(cell >> CHUNK_BITS)])[
+                    std::size_t(cell & ((1 << CHUNK_BITS) - 1))];
+        }
+
+        /**
+         * change the label of a cell, copying its chunk first when another
+         * index shares it
+         */
+        void set_label(int cell, int32_t label);
+
+        /**
+         * make the chunks for all cells, with every label BLOCKED
+         */
+        void allocate_chunks();
+
+        /**
+         * get the area around the map bounding box that is covered as well
+         */
+        Translation get_margin() const {
+            return robotBox + Translation{Length::METER, Length::METER,
+                                          0 * Length::METER};
+        }
+
+        /**
+         * add cells on the sides where the map bounding box plus the margin
+         * reaches beyond the cells, and label the new cells
+         */
+        void grow(ReadOnlyMap &map);
+
+        bool is_blocked(ReadOnlyMap &map, int x, int y) const;
+
+        int create_component();
+
+        /**
+         * give all unlabelled cells reachable from the seeds a component,
+         * merging components that became connected
+         */
+        void label(const std::vector<int> &seeds);
+
+        /**
+         * move all cells of a component to another one
+         */
+        void merge(int from, int into, const std::vector<int> *cells);
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_CONNECTIVITYINDEX_HPP
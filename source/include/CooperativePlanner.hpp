@@ -0,0 +1,283 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CooperativePlanner.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Cooperative fleet planner
+//!
+//! Plans the paths of a fleet of robots together, so that they do not collide
+//! with each other (windowed hierarchical cooperative A*).
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_COOPERATIVEPLANNER_HPP
+#define R2D2_PATHFINDING_COOPERATIVEPLANNER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include "AStarPathFinder.hpp"
+#include "Astar.hpp"
+
+namespace r2d2 {
+
+    /**
+     * the start and goal of a single robot of a fleet
+     */
+    struct RobotTask {
+        Coordinate start;
+        Coordinate goal;
+    };
+
+    /**
+     * the paths of a fleet, planned by CooperativePlanner
+     */
+    struct FleetPlan {
+        //! per robot, its position at every time step, all of the same
+        //! length. a robot that arrived early waits at its goal
+        std::vector<std::vector<Coordinate>> paths;
+        //! per robot, whether it is at its goal at the end of the plan
+        std::vector<bool> arrived;
+        //! the windowed searches that were run
+        int searches;
+        //! the rounds that were planned again, after a robot found no path
+        //! around the robots planned before it
+        int restarts;
+    };
+
+    /**
+     * plans a fleet of robots that share a map, without collisions
+     * between them (windowed hierarchical cooperative A*)
+     *
+     * the robots move over a grid of cells of the lattice step, anchored at
+     * the bottom left of the map. every time step, a robot moves to one of
+     * the four neighbouring cells or waits. the plan is made in rounds: in
+     * every round the robots are searched one after another with an
+     * AStarSearch over space and time, up to a window of time steps ahead.
+     * the cells and moves of every robot are reserved, and the robots
+     * searched after it plan around them. then half of the window is
+     * carried out, and the next round starts from there, until all robots
+     * are at their goals.
+     * beyond the window, the heuristic is the true distance to the goal: the
+     * distance field of AStarPathFinder, which is kept per goal and reused
+     * by every round and every plan while the map does not change. cells
+     * that are not in the field of the goal of a robot are never entered
+     * by it, so the map itself is only read through the fields.
+     * two robots never share a cell, never swap cells, and a robot only
+     * enters a cell that is being left when both move in the same
+     * direction. a robot that has not been searched yet in a round holds
+     * its current cell. with SQUARES_PER_ROBOT of 1 the cells are as large
+     * as a robot, so the boxes of two robots at most touch; with smaller
+     * cells the boxes of robots in neighbouring cells overlap.
+     */
+    class CooperativePlanner {
+    public:
+        /**
+         * constructor
+         *
+         * \param map the map the fleet drives on
+         * \param robotBox the size of every robot of the fleet
+         * \param window the amount of time steps a search looks ahead, at
+         * least 2
+         * \param threadCount the amount of threads that compute the
+         * distance fields, 0 to use all cores
+         */
+        CooperativePlanner(SharedObject<ReadOnlyMap> &map, Box robotBox,
+                           int window = 16, int threadCount = 0);
+
+        /**
+         * plan the paths of a fleet
+         *
+         * the starts and goals are rounded to the closest cells, which must
+         * all be different. a robot whose goal it cannot reach stays at its
+         * start, and the other robots plan around it.
+         * when a robot finds no way around the robots searched before it,
+         * it is searched first and the round is planned again, at most once
+         * per robot and round. after that it waits, and when a robot
+         * searched before it would run into it, planning stops.
+         * \param tasks the start and goal of every robot, the first robots
+         * are searched first
+         * \param plan receives the paths
+         * \param maxSteps the most time steps the plan may take
+         * \return whether all robots arrived at their goals, false when two
+         * starts or two goals share a cell, or when planning stopped, then
+         * the paths end at the round that could not be planned
+         */
+        bool plan(const std::vector<RobotTask> &tasks, FleetPlan &plan,
+                  int maxSteps = 1000);
+
+    private:
+        /**
+         * a cell of the grid
+         */
+        struct Cell {
+            int x, y;
+
+            bool operator==(const Cell &rhs) const {
+                return x == rhs.x && y == rhs.y;
+            }
+        };
+
+        /**
+         * the cells and moves of the robots planned so far in a round
+         */
+        class Reservations {
+        public:
+            void clear();
+
+            /**
+             * reserve the cells and moves of a robot
+             *
+             * \param cells the cell of the robot at every time step
+             * \param time the time step of the first cell
+             */
+            void reserve(const std::vector<Cell> &cells, int time);
+
+            bool is_reserved(Cell cell, int time) const {
+                return vertices.count(get_key(cell, time)) != 0;
+            }
+
+            /**
+             * whether a robot moves from a cell to its neighbour from a time
+             * step to the next
+             */
+            bool is_moving(Cell from, Cell to, int time) const {
+                return edges.count(get_key(from, to, time)) != 0;
+            }
+
+            /**
+             * whether a robot can move between neighbouring cells, or wait
+             * in a cell when they are the same, without colliding
+             */
+            bool can_move(Cell from, Cell to, int time) const;
+
+        private:
+            static uint64_t get_key(Cell cell, int time);
+
+            static uint64_t get_key(Cell from, Cell to, int time);
+
+            std::unordered_set<uint64_t> vertices;
+            std::unordered_set<uint64_t> edges;
+        };
+
+        /**
+         * the state of a single windowed search, shared by all its nodes
+         */
+        struct WindowSearch {
+            const DistanceField &field;
+            Cell goal;
+            //! the time step at which the search ends
+            int endTime;
+            const Reservations &reservations;
+            Length stepX, stepY;
+        };
+
+        /**
+         * implementation of the astar node from Astar.hpp, a cell at a time
+         * step
+         */
+        class TimedNode : public Node<TimedNode> {
+        public:
+            TimedNode(WindowSearch &search, Cell cell, int time,
+                      Length g = Length::METER *
+                                 std::numeric_limits<double>::infinity(),
+                      std::weak_ptr<TimedNode> parent = {});
+
+            /**
+             * make the node the search looks for, equal to every node at
+             * the end of the window
+             */
+            static TimedNode make_window_end(WindowSearch &search);
+
+            virtual bool operator==(const TimedNode &rhs) const override;
+
+            /**
+             * the waits and moves that collide with no reserved robot, the
+             * cheapest first
+             */
+            virtual std::vector<TimedNode> get_available_nodes(
+                    std::shared_ptr<TimedNode> &self) override;
+
+            std::reference_wrapper<WindowSearch> search;
+            Cell cell;
+            int time;
+            bool windowEnd;
+        };
+        friend struct std::hash<TimedNode>;
+
+        AStarPathFinder pathFinder;
+        const Translation robotBox;
+        const int window;
+        const int threadCount;
+
+        /**
+         * search the window of a robot
+         *
+         * \param cells receives the cell of the robot at every time step of
+         * the window, starting at the current one
+         * \return false if the reserved robots leave no way through
+         */
+        bool search_window(const DistanceField &field, Cell goal, Cell start,
+                           int time, const Reservations &reservations,
+                           std::vector<Cell> &cells) const;
+    };
+
+}
+
+namespace std {
+
+    /**
+     * hash for the timed node class, used for set insertion
+     */
+    template<>
+    struct hash<r2d2::CooperativePlanner::TimedNode> {
+        std::size_t operator()(
+                const r2d2::CooperativePlanner::TimedNode &node) const {
+            return std::hash<uint64_t>()(
+                    (uint64_t(uint32_t(node.cell.x)) << 40) ^
+                    (uint64_t(uint32_t(node.cell.y)) << 20) ^
+                    uint64_t(uint32_t(node.time)));
+        }
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_COOPERATIVEPLANNER_HPP
@@ -0,0 +1,175 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   DistanceField.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Goal rooted distance field
+//!
+//! A goal rooted cost-to-go field over the search lattice of a pathfinder.
+//! Once computed, the path from any start coordinate towards the goal can be
+//! extracted by following the field, without running a new search.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_DISTANCEFIELD_HPP
+#define R2D2_PATHFINDING_DISTANCEFIELD_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <Coordinate.hpp>
+#include <Translation.hpp>
+
+namespace r2d2 {
+
+    /**
+     * cost-to-go field towards a single goal
+     *
+     * the field covers the lattice the A* search uses: nodes are placed every
+     * "step" relative to the goal, so node (0, 0) is the goal itself. for every
+     * node the remaining travel cost to the goal is stored, together with the
+     * direction of the next node on the cheapest path.
+     * the field is created by AStarPathFinder::get_distance_field.
+     */
+    class DistanceField {
+    public:
+        //! direction value for nodes that have no next node
+        static const uint8_t NO_DIRECTION = 0xFF;
+
+        //! lattice offsets for each of the 8 directions
+        static const int DIRECTION_X[8], DIRECTION_Y[8];
+
+        /**
+         * creates a field in which every node is unreachable
+         *
+         * \param goal the coordinate of lattice node (0, 0)
+         * \param step the distance between two lattice nodes
+         * \param minX the lowest x index in the field
+         * \param minY the lowest y index in the field
+         * \param width the amount of nodes in the x direction
+         * \param height the amount of nodes in the y direction
+         * \param mapVersion the version of the map the field is computed for
+         */
+        DistanceField(Coordinate goal, Translation step, int minX, int minY,
+                      int width, int height, uint64_t mapVersion);
+
+        /**
+         * check whether a lattice index lies within the field
+         */
+        bool contains(int x, int y) const {
+            return x >= minX && y >= minY &&
+                   x < minX + width && y < minY + height;
+        }
+
+        /**
+         * get the coordinate of a lattice node
+         */
+        Coordinate get_coordinate(int x, int y) const;
+
+        /**
+         * get the remaining cost from a lattice node to the goal
+         *
+         * \return the cost in meters, infinity if the goal cannot be reached
+         */
+        float get_cost(int x, int y) const {
+            return contains(x, y) ? cost[index_of(x, y)]
+                                  : std::numeric_limits<float>::infinity();
+        }
+
+        /**
+         * get the direction of the next node on the path to the goal
+         *
+         * \return an index into DIRECTION_X and DIRECTION_Y, or NO_DIRECTION
+         */
+        uint8_t get_direction(int x, int y) const {
+            return contains(x, y) ? direction[index_of(x, y)] : NO_DIRECTION;
+        }
+
+        Coordinate get_goal() const {
+            return goal;
+        }
+
+        Translation get_step() const {
+            return step;
+        }
+
+        uint64_t get_map_version() const {
+            return mapVersion;
+        }
+
+        int get_min_x() const {
+            return minX;
+        }
+
+        int get_min_y() const {
+            return minY;
+        }
+
+        int get_width() const {
+            return width;
+        }
+
+        int get_height() const {
+            return height;
+        }
+
+        /**
+         * get the amount of bytes used for storing the field
+         */
+        std::size_t get_memory_usage() const;
+
+    private:
+        friend class AStarPathFinder;
+
+        std::size_t index_of(int x, int y) const {
+            return std::size_t(y - minY) * std::size_t(width) +
+                   std::size_t(x - minX);
+        }
+
+        Coordinate goal;
+        Translation step;
+        int minX, minY, width, height;
+        uint64_t mapVersion;
+
+        std::vector<float> cost;
+        std::vector<uint8_t> direction;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_DISTANCEFIELD_HPP
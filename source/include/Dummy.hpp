@@ -8,7 +8,7 @@
 //! \author Jasper Schoenmaker 1661818
 //! \author Chiel Douwes 1666311
 //! \date   Created: 29-03-2016
-//! \date   Last Modified: 15-4-2016
+//! \date   Last Modified: 19-10-2026
 //! \brief  Dummy map for pathfinding
 //!
 //! A dummy implementation of the map, without it the pathfinding module could
@@ -56,13 +56,15 @@
 #include <MapInterface.hpp>
 #include <Coordinate.hpp>
 #include <Translation.hpp>
+#include "BatchedMap.hpp"
+#include "VersionedMap.hpp"
 
 namespace r2d2 {
     //! Dummy Map
     /*!
     * Map for testing the pathfinder
     */
-    class Dummy : public ReadOnlyMap {
+    class Dummy : public ReadOnlyMap, public VersionedMap, public BatchedMap {
     public:
         //! Implementation of the map, where: 0 = clear, 1 = obstacle, 2 = unexplored
         std::vector<std::vector<int>> map;
@@ -90,13 +92,38 @@ namespace r2d2 {
         */
         void print_map();
 
+        //! Change a single cell of the map
+        /*!
+        * Changing the map through this function increments the map version,
+        * so structures derived from the map are invalidated.
+        * \param x The x index of the cell
+        * \param y The y index of the cell
+        * \param value The new value of the cell
+        */
+        void set_cell(int x, int y, int value);
+
         virtual const BoxInfo get_box_info(const Box box) override;
 
+        virtual void get_box_infos(const std::vector<Box> &boxes,
+                                   std::vector<BoxInfo> &infos) override;
+
         virtual const Box get_map_bounding_box() override;
 
+        virtual uint64_t get_map_version() const override;
+
     private:
         static std::mt19937_64 mersenne;
 
+        /**
+         * get the cells a box covers, rounded down like GridMap does
+         *
+         * \param box the box, in meters from the origin of the map
+         * \return the cells, which can lie outside of the map
+         */
+        static CellRange get_cell_range(const Box &box);
+
+        uint64_t version;
+
     };
 
 }
@@ -0,0 +1,163 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   GridMap.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Grid based map
+//!
+//! A map stored as a grid of cells with a configurable origin and cell size.
+//! Used for holding snapshots of other maps, for instance when replaying traces.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_GRIDMAP_HPP
+#define R2D2_PATHFINDING_GRIDMAP_HPP
+
+#include <cstdint>
+#include <vector>
+#include <MapInterface.hpp>
+#include "BatchedMap.hpp"
+#include "VersionedMap.hpp"
+
+namespace r2d2 {
+
+    /**
+     * map made of square cells, each being free, an obstacle, or unknown
+     *
+     * the cell values are the same as the ones the Dummy map uses. unlike
+     * Dummy, the grid can start at any origin and have any cell size.
+     */
+    class GridMap : public ReadOnlyMap, public VersionedMap, public BatchedMap {
+    public:
+        //! the values a cell can have
+        static const uint8_t FREE = 0, OBSTACLE = 1, UNKNOWN = 2;
+
+        /**
+         * constructor
+         *
+         * \param origin the bottom left corner of the grid
+         * \param cellSize the width and height of a single cell
+         * \param width the amount of cells in the x direction
+         * \param height the amount of cells in the y direction
+         * \param fill the value every cell starts with
+         */
+        GridMap(Coordinate origin = Coordinate{}, Length cellSize = Length::METER,
+                int width = 0, int height = 0, uint8_t fill = UNKNOWN);
+
+        /**
+         * create a grid copy of another map
+         *
+         * every cell is sampled with a box query on the whole cell, shrunk
+         * by a small margin so its neighbours are left out. a cell that
+         * contains an obstacle becomes an obstacle, otherwise a cell that
+         * contains unknown space becomes unknown.
+         * \param map the map to copy, covering its bounding box
+         * \param cellSize the size of the cells of the copy
+         * \return the copy
+         */
+        static GridMap sample(ReadOnlyMap &map, Length cellSize = Length::METER);
+
+        uint8_t get_cell(int x, int y) const {
+            return cells[std::size_t(y) * std::size_t(width) + std::size_t(x)];
+        }
+
+        /**
+         * change a single cell, incrementing the map version
+         */
+        void set_cell(int x, int y, uint8_t value);
+
+        /**
+         * replace all cells at once, incrementing the map version
+         *
+         * \param values the new cells, row by row from the bottom
+         */
+        void set_cells(std::vector<uint8_t> values);
+
+        /**
+         * replace the geometry and all cells at once, incrementing the map
+         * version
+         *
+         * \param origin the bottom left corner of the grid
+         * \param cellSize the width and height of a single cell
+         * \param width the amount of cells in the x direction
+         * \param height the amount of cells in the y direction
+         * \param values the new cells, row by row from the bottom
+         */
+        void assign(Coordinate origin, Length cellSize, int width, int height,
+                    std::vector<uint8_t> values);
+
+        const std::vector<uint8_t> &get_cells() const {
+            return cells;
+        }
+
+        Coordinate get_origin() const {
+            return origin;
+        }
+
+        Length get_cell_size() const {
+            return cellSize;
+        }
+
+        int get_width() const {
+            return width;
+        }
+
+        int get_height() const {
+            return height;
+        }
+
+        virtual const BoxInfo get_box_info(const Box box) override;
+
+        virtual void get_box_infos(const std::vector<Box> &boxes,
+                                   std::vector<BoxInfo> &infos) override;
+
+        virtual const Box get_map_bounding_box() override;
+
+        virtual uint64_t get_map_version() const override;
+
+    private:
+        Coordinate origin;
+        Length cellSize;
+        int width, height;
+        std::vector<uint8_t> cells;
+        uint64_t version;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_GRIDMAP_HPP
@@ -0,0 +1,148 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   MapAccessGroup.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Shared map access for concurrent queries
+//!
+//! Shares a single map accessor between all queries that run at the same time,
+//! so concurrent queries on one pathfinder read the map under one lock.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_MAPACCESSGROUP_HPP
+#define R2D2_PATHFINDING_MAPACCESSGROUP_HPP
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <MapInterface.hpp>
+#include "../../../sharedobjects/source/include/SharedObject.hpp"
+
+namespace r2d2 {
+
+    /**
+     * groups the readers of a shared map
+     *
+     * the first query to start opens an accessor, which locks the map.
+     * queries that start while the accessor is open join it instead of
+     * opening their own, so they read the map concurrently.
+     * once the query that opened the accessor has finished, no new queries
+     * can join, so other users of the map get their turn. the last query to
+     * leave closes the accessor, no query waits for the others to finish.
+     * the map has to be unlocked by the thread that locked it, so the
+     * accessor is opened and closed by a thread of the group, which is
+     * started by the first query.
+     * the internal mutex is never held while waiting for the map lock.
+     * the map must support concurrent calls to get_box_info.
+     * a thread should hold at most one lease at a time, as a second lease
+     * could wait for the closing of an accessor that the first one keeps open.
+     */
+    class MapAccessGroup {
+    public:
+        /**
+         * constructor
+         *
+         * \param map the map to share between the queries
+         */
+        MapAccessGroup(SharedObject<ReadOnlyMap> &map);
+
+        /**
+         * stops the thread of the group, all leases must have ended
+         */
+        ~MapAccessGroup();
+
+        /**
+         * access to the map for the lifetime of a single query
+         */
+        class Lease {
+        public:
+            /**
+             * join the current accessor, or open one if there is none
+             */
+            Lease(MapAccessGroup &group);
+
+            Lease(const Lease &) = delete;
+
+            Lease &operator=(const Lease &) = delete;
+
+            /**
+             * leave the accessor, closing it if this is the last lease and
+             * the lease that opened it has ended
+             */
+            ~Lease();
+
+            ReadOnlyMap &access();
+
+        private:
+            MapAccessGroup &group;
+            bool opener;
+        };
+
+    private:
+        enum class Request {
+            NONE, OPEN, CLOSE, STOP
+        };
+
+        /**
+         * open and close the accessor on request, until asked to stop
+         */
+        void hold();
+
+        SharedObject<ReadOnlyMap> &map;
+        std::mutex mutex;
+        std::condition_variable changed;
+        // the accessor is constructed in place, so a query does not have to
+        // allocate memory for it
+        std::aligned_storage<
+                sizeof(SharedObject<ReadOnlyMap>::Accessor),
+                alignof(SharedObject<ReadOnlyMap>::Accessor)>::type storage;
+        SharedObject<ReadOnlyMap>::Accessor *accessor;
+        std::thread holder;
+        Request request;
+        int users;
+        //! set while the accessor is being opened, or can no longer be
+        //! joined until it is closed
+        bool changing;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_MAPACCESSGROUP_HPP
@@ -0,0 +1,152 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   MapWorkload.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Box query workloads for map backends
+//!
+//! Generates the box queries the pathfinder makes, checks the answers of a
+//! map against a reference map, and measures the query throughput of a map.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_MAPWORKLOAD_HPP
+#define R2D2_PATHFINDING_MAPWORKLOAD_HPP
+
+#include <cstdint>
+#include <vector>
+#include <MapInterface.hpp>
+
+namespace r2d2 {
+
+    /**
+     * the kinds of box queries the pathfinder makes
+     */
+    enum class BoxQueryKind {
+        //! a step between neighbouring lattice nodes in can_travel
+        SUCCESSOR,
+        //! a long, mostly axis aligned segment tried by smooth_path
+        SEGMENT,
+        //! a box near the edge of the map that partly or fully leaves it
+        OUT_OF_BOUNDS
+    };
+
+    /**
+     * a single box query of a workload
+     */
+    struct BoxQuery {
+        Box box;
+        BoxQueryKind kind;
+        //! the amount of cells of the workload cell size the box touches
+        uint32_t cells;
+    };
+
+    /**
+     * the result of comparing a map with a reference map
+     */
+    struct MapConformance {
+        int queries;
+        //! queries where any of the three flags differs
+        int mismatches;
+        //! queries the reference blocks with an obstacle or unknown space
+        //! while the map reports neither, which lets the robot drive there
+        int unsafe;
+        //! the index of the first unsafe query, or else the first
+        //! mismatch, -1 if there is none
+        int firstMismatch;
+    };
+
+    /**
+     * the result of measuring the throughput of a map
+     */
+    struct MapThroughput {
+        double queriesPerSecond;
+        double nsPerCell;
+        //! whether the cache counters below could be read, which needs
+        //! access to the hardware performance counters
+        bool hasCacheCounters;
+        uint64_t cacheReferences, cacheMisses;
+    };
+
+    /**
+     * generate box queries like the pathfinder makes them
+     *
+     * successor boxes cover a step of the robot size in one of the eight
+     * directions plus the robot. segment boxes cover the bounding box of a
+     * segment of up to a quarter of the map, most of them horizontal or
+     * vertical, plus the robot. out of bounds boxes are successor or
+     * segment boxes placed around the edge of the map.
+     * \param bounds the bounding box of the map
+     * \param robotBox the size of the robot
+     * \param cellSize the cell size used for counting the touched cells
+     * \param kind the kind of queries
+     * \param count the amount of queries
+     * \param seed the seed of the random generator
+     * \return the queries
+     */
+    std::vector<BoxQuery> generate_box_queries(const Box &bounds,
+                                               Translation robotBox,
+                                               Length cellSize,
+                                               BoxQueryKind kind, int count,
+                                               uint64_t seed);
+
+    /**
+     * compare the box info of a map with a reference map
+     *
+     * \param reference the map that gives the expected answers
+     * \param map the map to check
+     * \param queries the queries to compare
+     */
+    MapConformance check_map_conformance(ReadOnlyMap &reference,
+                                         ReadOnlyMap &map,
+                                         const std::vector<BoxQuery> &queries);
+
+    /**
+     * measure the box query throughput of a map
+     *
+     * \param map the map to query
+     * \param queries the queries, done in order
+     * \param repeats the amount of times all queries are done
+     */
+    MapThroughput measure_map_throughput(ReadOnlyMap &map,
+                                         const std::vector<BoxQuery> &queries,
+                                         int repeats = 1);
+
+}
+
+#endif //R2D2_PATHFINDING_MAPWORKLOAD_HPP
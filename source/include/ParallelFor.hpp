@@ -0,0 +1,106 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ParallelFor.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Parallel for loop
+//!
+//! Small helper for splitting a range of work over a number of threads.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_PARALLELFOR_HPP
+#define R2D2_PATHFINDING_PARALLELFOR_HPP
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace r2d2 {
+
+    /**
+     * get the amount of threads to use when the user did not specify it
+     *
+     * \param requested the requested amount of threads, 0 for automatic
+     * \return the amount of threads that should be used, at least 1
+     */
+    inline int get_thread_count(int requested) {
+        if (requested > 0) {
+            return requested;
+        }
+        int hardware = int(std::thread::hardware_concurrency());
+        return hardware > 0 ? hardware : 1;
+    }
+
+    /**
+     * run a function over the range [0, count) divided over multiple threads
+     *
+     * the range is split into contiguous chunks, one per thread. the calling
+     * thread handles the first chunk itself, so no threads are started when
+     * only one thread is requested or when the range is too small to split.
+     * \param threadCount the amount of threads to divide the work over
+     * \param count the size of the range
+     * \param function called as function(worker, begin, end) for every chunk
+     * \param minChunk the minimum amount of items a thread should receive
+     */
+    template<typename F>
+    void parallel_for(int threadCount, int count, F function,
+                      int minChunk = 1) {
+        if (count <= 0) {
+            return;
+        }
+        int workers = std::max(1, std::min(threadCount,
+                                           count / std::max(1, minChunk)));
+        int chunk = (count + workers - 1) / workers;
+        std::vector<std::thread> threads;
+        threads.reserve(std::size_t(workers - 1));
+        for (int worker = 1; worker < workers; worker++) {
+            int begin = worker * chunk, end = std::min(count, begin + chunk);
+            if (begin < end) {
+                threads.emplace_back(function, worker, begin, end);
+            }
+        }
+        function(0, 0, std::min(count, chunk));
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+    }
+
+}
+
+#endif //R2D2_PATHFINDING_PARALLELFOR_HPP
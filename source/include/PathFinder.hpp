@@ -52,6 +52,7 @@
 #include <vector>
 #include "../../../adt/source/include/Box.hpp"
 #include "../../../sharedobjects/source/include/SharedObject.hpp"
+#include "CompactPath.hpp"
 #include "Dummy.hpp"
 
 namespace r2d2 {
@@ -86,6 +87,31 @@ namespace r2d2 {
 				Coordinate start,
 				Coordinate goal,
 				std::vector<Coordinate> &path) = 0;
+
+		/**
+		 * Returns a path between two points as a CompactPath
+		 *
+		 * The path is found with get_path_to_coordinate, and encoded with
+		 * the start as origin
+		 *
+		 * \param start The start coordinate
+		 * \param goal The goal coordinate
+		 * \param path The compact path the path is written to
+		 * \param resolution The step the waypoints are rounded to
+		 * \return If it was able to find a path
+		 */
+		bool get_compact_path(
+				Coordinate start,
+				Coordinate goal,
+				CompactPath &path,
+				Length resolution = .001 * Length::METER) {
+			std::vector<Coordinate> points;
+			if (!get_path_to_coordinate(start, goal, points)) {
+				return false;
+			}
+			path.assign(start, points, resolution);
+			return true;
+		}
 	};
 
 }
@@ -0,0 +1,113 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningClient.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Client of the planning daemon
+//!
+//! Sends batches of path queries to a PlanningServer on the same host.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_PLANNINGCLIENT_HPP
+#define R2D2_PATHFINDING_PLANNINGCLIENT_HPP
+
+#include <string>
+#include "PlanningProtocol.hpp"
+
+namespace r2d2 {
+
+    /**
+     * a connection to a PlanningServer
+     *
+     * batches can be sent without waiting for their replies. a single thread
+     * may send while another one receives, but neither function may be
+     * called by two threads at once.
+     */
+    class PlanningClient {
+    public:
+        /**
+         * connect to a server
+         *
+         * \param socketPath the path of the socket of the server
+         * \throws std::runtime_error if the server cannot be reached
+         */
+        PlanningClient(const std::string &socketPath);
+
+        PlanningClient(const PlanningClient &) = delete;
+
+        PlanningClient &operator=(const PlanningClient &) = delete;
+
+        ~PlanningClient();
+
+        /**
+         * send a batch of queries
+         *
+         * blocks while the server does not accept more queries
+         * \param queries at most PLANNING_MAX_BATCH queries
+         * \return the id of the batch, which the reply carries
+         * \throws std::runtime_error if the connection is closed
+         */
+        uint32_t send(const std::vector<PlanningQuery> &queries);
+
+        /**
+         * wait for the next reply
+         *
+         * replies do not have to arrive in the order of their batches
+         * \param results receives the results, in the order of the queries
+         * \return the id of the batch
+         * \throws std::runtime_error if the connection is closed
+         */
+        uint32_t receive(std::vector<PathResult> &results);
+
+        /**
+         * send a batch and wait for its reply
+         *
+         * may only be used when no other batches are outstanding
+         */
+        std::vector<PathResult> plan(const std::vector<PlanningQuery> &queries);
+
+    private:
+        int socket;
+        uint32_t nextBatchId;
+        std::vector<uint8_t> sendBuffer, receiveBuffer;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_PLANNINGCLIENT_HPP
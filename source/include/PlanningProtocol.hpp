@@ -0,0 +1,148 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningProtocol.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Wire format of the planning daemon
+//!
+//! The binary messages a PlanningClient and a PlanningServer exchange over a
+//! Unix domain socket.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_PLANNINGPROTOCOL_HPP
+#define R2D2_PATHFINDING_PLANNINGPROTOCOL_HPP
+
+#include <cstdint>
+#include <vector>
+#include "AsyncPathFinder.hpp"
+
+namespace r2d2 {
+
+    /**
+     * a single query of a batch sent to a PlanningServer
+     */
+    struct PlanningQuery {
+        Coordinate start, goal;
+    };
+
+    /*
+     * every message is a frame: the size of the rest of the frame as a
+     * uint32, a magic number, the id of the batch and the amount of queries
+     * or results in it.
+     * a request holds the x and y of the start and goal of every query, a
+     * reply holds the status of every result followed by the x and y of its
+     * path. lengths are doubles in meters, the planner ignores z.
+     * both sides run on the same host, so values are in host byte order.
+     */
+
+    //! "R2PQ", the first word of a request
+    const uint32_t PLANNING_REQUEST_MAGIC = 0x51503252;
+    //! "R2PR", the first word of a reply
+    const uint32_t PLANNING_REPLY_MAGIC = 0x52503252;
+    //! the largest amount of queries in a single batch
+    const uint32_t PLANNING_MAX_BATCH = 4096;
+    //! the largest frame that is accepted, which bounds a single allocation
+    const uint32_t PLANNING_MAX_FRAME = 64 << 20;
+
+    /**
+     * encode a batch of queries into a frame
+     *
+     * \param batchId the id the reply will carry
+     * \param queries at most PLANNING_MAX_BATCH queries
+     * \param frame receives the frame, including its size
+     */
+    void encode_planning_request(uint32_t batchId,
+                                 const std::vector<PlanningQuery> &queries,
+                                 std::vector<uint8_t> &frame);
+
+    /**
+     * decode a frame made by encode_planning_request
+     *
+     * \param frame the frame without its size, as read by read_planning_frame
+     * \param queries receives the queries
+     * \return the id of the batch
+     * \throws std::runtime_error if the frame is not a valid request
+     */
+    uint32_t decode_planning_request(const std::vector<uint8_t> &frame,
+                                     std::vector<PlanningQuery> &queries);
+
+    /**
+     * encode the results of a batch into a frame
+     *
+     * \param batchId the id of the request
+     * \param results the results, in the order of the queries
+     * \param frame receives the frame, including its size
+     */
+    void encode_planning_reply(uint32_t batchId,
+                               const std::vector<PathResult> &results,
+                               std::vector<uint8_t> &frame);
+
+    /**
+     * decode a frame made by encode_planning_reply
+     *
+     * \param frame the frame without its size, as read by read_planning_frame
+     * \param results receives the results
+     * \return the id of the batch
+     * \throws std::runtime_error if the frame is not a valid reply
+     */
+    uint32_t decode_planning_reply(const std::vector<uint8_t> &frame,
+                                   std::vector<PathResult> &results);
+
+    /**
+     * read the next frame from a socket
+     *
+     * \param socket the socket to read from, blocking until a whole frame
+     * arrived
+     * \param frame receives the frame without its size
+     * \return false if the socket was closed between frames
+     * \throws std::runtime_error on a read error, a frame that ends early or
+     * a frame larger than PLANNING_MAX_FRAME
+     */
+    bool read_planning_frame(int socket, std::vector<uint8_t> &frame);
+
+    /**
+     * write a whole frame to a socket
+     *
+     * \return false if the other side is gone
+     */
+    bool write_planning_frame(int socket, const std::vector<uint8_t> &frame);
+
+}
+
+#endif //R2D2_PATHFINDING_PLANNINGPROTOCOL_HPP
@@ -0,0 +1,167 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningServer.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Planning daemon
+//!
+//! Serves path queries of other processes on the same host over a Unix domain
+//! socket, so they share a single map and pathfinder.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_PLANNINGSERVER_HPP
+#define R2D2_PATHFINDING_PLANNINGSERVER_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include "PathFinder.hpp"
+#include "PlanningProtocol.hpp"
+#include "ThreadPool.hpp"
+
+namespace r2d2 {
+
+    /**
+     * answers batches of path queries sent over a Unix domain socket
+     *
+     * every connection has a reader thread that decodes the batches and runs
+     * their queries on a shared pool of workers. a client may send batches
+     * without waiting for the replies, which come back as soon as their last
+     * query is done, so not necessarily in order.
+     * the replies are queued for a writer thread of the connection, so a
+     * client that does not read its replies only holds up its own
+     * connection, never the workers.
+     * a connection may have maxInFlight queries running, waiting or with
+     * their reply not yet written at once. when it reaches that amount its
+     * reader stops reading until replies are written, so the socket buffers
+     * fill up and the client blocks on sending.
+     * a connection that sends an invalid frame is closed.
+     */
+    class PlanningServer {
+    public:
+        /**
+         * create the socket and start listening
+         *
+         * \param pathFinder answers the queries, it has to support concurrent
+         * queries, like AStarPathFinder and VisibilityGraphPathFinder do
+         * \param socketPath the path of the socket, a stale socket at the
+         * path is replaced
+         * \param threadCount the amount of workers, 0 to use all cores
+         * \param maxInFlight the amount of queries of a single connection
+         * that are accepted before its reader stops reading
+         * \throws std::runtime_error if the socket cannot be created
+         */
+        PlanningServer(PathFinder &pathFinder, const std::string &socketPath,
+                       int threadCount = 0, int maxInFlight = 256);
+
+        PlanningServer(const PlanningServer &) = delete;
+
+        PlanningServer &operator=(const PlanningServer &) = delete;
+
+        /**
+         * removes the socket, run has to have returned
+         */
+        ~PlanningServer();
+
+        /**
+         * accept and serve connections until stop is called
+         *
+         * before returning, the queries that were received are answered and
+         * all connections are closed. replies that a client does not take
+         * within STOP_WRITE_TIMEOUT_MS are dropped.
+         */
+        void run();
+
+        /**
+         * make run return, it is safe to call from a signal handler
+         */
+        void stop();
+
+        const std::string &get_socket_path() const {
+            return socketPath;
+        }
+
+        /**
+         * get the amount of queries answered since the start
+         */
+        uint64_t get_query_count() const {
+            return queryCount;
+        }
+
+        //! how long a stopping server waits for a client to take a reply
+        static const int STOP_WRITE_TIMEOUT_MS = 1000;
+
+    private:
+        struct Connection;
+        struct Batch;
+
+        void serve(std::shared_ptr<Connection> connection);
+
+        /**
+         * write the queued replies of a connection until its reader is done
+         */
+        void write_replies(std::shared_ptr<Connection> connection);
+
+        /**
+         * write a reply without blocking for longer than
+         * STOP_WRITE_TIMEOUT_MS once the server is stopping
+         *
+         * \return false if the client is gone or did not take the reply
+         */
+        bool write_reply(int socket, const std::vector<uint8_t> &frame);
+
+        void answer(std::shared_ptr<Connection> connection,
+                    std::shared_ptr<Batch> batch, std::size_t index);
+
+        PathFinder &pathFinder;
+        std::string socketPath;
+        int maxInFlight;
+        int listener;
+        //! the pipe that wakes up run when stop is called
+        int wakeRead, wakeWrite;
+        std::atomic<bool> stopping;
+        std::atomic<uint64_t> queryCount;
+        std::vector<std::shared_ptr<Connection>> connections;
+        // the pool is destroyed first, so no worker outlives the rest
+        ThreadPool pool;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_PLANNINGSERVER_HPP
@@ -0,0 +1,215 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PortfolioPathFinder.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Portfolio pathfinder
+//!
+//! A pathfinder that races several planner configurations on a query and
+//! keeps the first or best result.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_PORTFOLIOPATHFINDER_HPP
+#define R2D2_PATHFINDING_PORTFOLIOPATHFINDER_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "AStarPathFinder.hpp"
+#include "CancellationToken.hpp"
+#include "PathFinder.hpp"
+#include "ThreadPool.hpp"
+
+namespace r2d2 {
+
+    /**
+     * a planner configuration of a PortfolioPathFinder
+     *
+     * the planner should stop soon after the token is cancelled. a planner
+     * that ignores the token works as well, its late result is dropped.
+     */
+    typedef std::function<bool(Coordinate start, Coordinate goal,
+                               std::vector<Coordinate> &path,
+                               const CancellationToken &token)>
+            PortfolioPlanner;
+
+    /**
+     * how a configuration of a PortfolioPathFinder did so far
+     */
+    struct PortfolioStatistics {
+        std::string name;
+        //! the queries that were answered with the path of the configuration
+        int wins;
+        //! the runs that found a path before the query was answered
+        int found;
+        //! the runs that finished without a path before the query was
+        //! answered
+        int notFound;
+        //! the runs that finished after the query was answered, which were
+        //! cancelled or too late
+        int cancelled;
+        //! the total time of the runs that finished before the query was
+        //! answered
+        std::chrono::nanoseconds time;
+    };
+
+    /**
+     * races several planner configurations on every query
+     *
+     * no single configuration is best everywhere: a coarse lattice or an
+     * inflated heuristic is fast in open space, but fails or takes detours
+     * in narrow passages where the exact search succeeds. every query is
+     * given to all configurations at once on a thread pool. without a
+     * deadline, the first path found answers the query. with a deadline,
+     * the shortest path found before it does, or the first one after it when
+     * none was found in time. the other runs are cancelled.
+     * the statistics show which configurations win, so the ones that never
+     * do can be removed.
+     */
+    class PortfolioPathFinder : public PathFinder {
+    public:
+        /**
+         * constructor
+         *
+         * \param map the map of the queries
+         * \param robotBox the size of the robot
+         * \param threadCount the amount of worker threads, 0 for all cores.
+         * with fewer threads than configurations, the last configurations
+         * only start when others finished
+         */
+        PortfolioPathFinder(SharedObject<ReadOnlyMap> &map, Box robotBox,
+                            int threadCount = 0);
+
+        /**
+         * make a planner of a configuration of an AStarPathFinder
+         *
+         * the configurations of a single AStarPathFinder read the map
+         * together, while separate pathfinders on a locking map would take
+         * turns.
+         * \param pathFinder the pathfinder, which must outlive the planner
+         * \param settings the settings of its queries
+         */
+        static PortfolioPlanner make_planner(AStarPathFinder &pathFinder,
+                                             SearchSettings settings);
+
+        /**
+         * add a configuration to the portfolio
+         *
+         * \param name the name of its statistics
+         * \param planner the planner that answers queries
+         */
+        void add_configuration(const std::string &name,
+                               PortfolioPlanner planner);
+
+        /**
+         * remove a configuration, the runs it has going finish unseen
+         *
+         * \return false if there is no configuration with the name
+         */
+        bool remove_configuration(const std::string &name);
+
+        /**
+         * remove the configurations with the fewest wins
+         *
+         * \param keep the amount of configurations that is kept, the ones
+         * added first win ties
+         */
+        void prune(std::size_t keep);
+
+        /**
+         * choose how long a query waits for shorter paths
+         *
+         * \param deadline the time after the start of a query at which the
+         * shortest path found is used, 0 to use the first path found
+         */
+        void set_deadline(std::chrono::nanoseconds deadline);
+
+        virtual bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path) override;
+
+        /**
+         * Returns a path between two points, unless the query is cancelled
+         *
+         * \param start The start coordinate
+         * \param goal The goal coordinate
+         * \param path Vector where the path need to be written to
+         * \param token stops the query and all its runs
+         * \param winner if not nullptr, receives the name of the
+         * configuration whose path was used
+         * \return If a configuration found a path, false when cancelled
+         */
+        bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path,
+                const CancellationToken &token,
+                std::string *winner = nullptr);
+
+        /**
+         * get the statistics of the current configurations, in the order
+         * they were added
+         */
+        std::vector<PortfolioStatistics> get_statistics() const;
+
+    private:
+        struct Configuration {
+            PortfolioPlanner planner;
+            //! guarded by statisticsMutex
+            PortfolioStatistics statistics;
+        };
+
+        struct Race;
+
+        mutable std::mutex mutex;
+        std::vector<std::shared_ptr<Configuration>> configurations;
+        std::chrono::nanoseconds deadline;
+        //! guards the statistics, which late runs update after their query
+        mutable std::mutex statisticsMutex;
+        //! destroyed first, so runs finish while the rest still exists
+        ThreadPool pool;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_PORTFOLIOPATHFINDER_HPP
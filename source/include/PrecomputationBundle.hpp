@@ -0,0 +1,257 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PrecomputationBundle.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Serialized precomputed indices
+//!
+//! A versioned binary file holding the indices that planners derive from a
+//! map, tied to a hash of the map content and memory mapped when read.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_PRECOMPUTATIONBUNDLE_HPP
+#define R2D2_PATHFINDING_PRECOMPUTATIONBUNDLE_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <MapInterface.hpp>
+
+namespace r2d2 {
+
+    /**
+     * a set of named sections of precomputed data for a single map
+     *
+     * the file starts with a header holding the format version and the byte
+     * order, followed by a table of the sections with their checksums and a
+     * hash of the map content they were made from. the data of every
+     * section starts at a
+     * multiple of 8 bytes. numbers are stored in the byte order of the
+     * machine that wrote the bundle, a bundle with another byte order is
+     * rejected.
+     * a bundle that is read from a file is memory mapped, so only the
+     * sections that are used are read from disk.
+     */
+    class PrecomputationBundle {
+    public:
+        //! the format version that is written
+        static const uint32_t FORMAT_VERSION = 2;
+
+        /**
+         * appends values to the data of a section
+         */
+        class Writer {
+        public:
+            Writer(std::vector<uint8_t> &out) : out(out) {
+            }
+
+            template<typename T>
+            void put(const T &value) {
+                const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+                out.insert(out.end(), bytes, bytes + sizeof(T));
+            }
+
+            void put_length(Length length) {
+                put(length / Length::METER);
+            }
+
+            /**
+             * write the size of a vector followed by its elements
+             */
+            template<typename T>
+            void put_vector(const std::vector<T> &values) {
+                put(uint64_t(values.size()));
+                const uint8_t *bytes =
+                        reinterpret_cast<const uint8_t *>(values.data());
+                out.insert(out.end(), bytes, bytes + values.size() * sizeof(T));
+            }
+
+        private:
+            std::vector<uint8_t> &out;
+        };
+
+        /**
+         * reads values from the data of a section
+         *
+         * every function throws std::runtime_error when the data ends early
+         */
+        class Reader {
+        public:
+            Reader(const uint8_t *data, std::size_t size) :
+                    data(data),
+                    end(data + size) {
+            }
+
+            template<typename T>
+            T get() {
+                T value;
+                std::memcpy(&value, take(sizeof(T)), sizeof(T));
+                return value;
+            }
+
+            Length get_length() {
+                return get<double>() * Length::METER;
+            }
+
+            template<typename T>
+            void get_vector(std::vector<T> &values) {
+                uint64_t count = get<uint64_t>();
+                if (count > uint64_t(end - data) / sizeof(T)) {
+                    throw std::runtime_error("bundle section too short");
+                }
+                values.resize(std::size_t(count));
+                std::memcpy(values.data(), take(values.size() * sizeof(T)),
+                            values.size() * sizeof(T));
+            }
+
+        private:
+            const uint8_t *data, *end;
+
+            const uint8_t *take(std::size_t size) {
+                if (size > std::size_t(end - data)) {
+                    throw std::runtime_error("bundle section too short");
+                }
+                const uint8_t *result = data;
+                data += size;
+                return result;
+            }
+        };
+
+        /**
+         * create an empty bundle
+         */
+        PrecomputationBundle();
+
+        PrecomputationBundle(const PrecomputationBundle &) = delete;
+
+        PrecomputationBundle &operator=(const PrecomputationBundle &) = delete;
+
+        ~PrecomputationBundle();
+
+        /**
+         * hash the content of a map
+         *
+         * a GridMap is hashed by its cells. other maps are hashed by the
+         * box info of every cell of the given size over their bounding box,
+         * which takes a single box query per cell.
+         * \param map the map to hash
+         * \param cellSize the size of the cells that are queried
+         * \return the hash
+         */
+        static uint64_t compute_map_hash(ReadOnlyMap &map,
+                                         Length cellSize = Length::METER);
+
+        /**
+         * read a bundle from a file
+         *
+         * the header and the checksums of all sections are checked.
+         * \param path the file to read
+         * \return the bundle
+         * \throws std::runtime_error if the file cannot be read, is not a
+         * bundle of this format version, or is corrupt
+         */
+        static std::shared_ptr<const PrecomputationBundle> open(
+                const std::string &path);
+
+        /**
+         * write the bundle to a file
+         *
+         * \param path the file to write
+         * \throws std::runtime_error if the file cannot be written
+         */
+        void save(const std::string &path) const;
+
+        /**
+         * check whether every section was made from the current content of
+         * a map
+         *
+         * \param map the map to compare with, which is hashed again at the
+         * cell sizes of the sections
+         */
+        bool matches(ReadOnlyMap &map) const;
+
+        /**
+         * add a section, replacing a section with the same name
+         *
+         * the section keeps the hash of the map it was made from.
+         * \param name the name of the section, at most 15 characters
+         * \param data the content of the section
+         * \param map the map the content was made from
+         * \param hashCellSize the size of the smallest detail of the map the
+         * content depends on, maps that are not a GridMap are hashed with
+         * cells of this size
+         */
+        void add_section(const std::string &name, std::vector<uint8_t> data,
+                         ReadOnlyMap &map, Length hashCellSize);
+
+        /**
+         * get the content of a section
+         *
+         * \param name the name of the section
+         * \param size receives the size of the section in bytes
+         * \return the data, which lives as long as the bundle, or nullptr if
+         * the bundle has no such section
+         */
+        const uint8_t *get_section(const std::string &name,
+                                   std::size_t &size) const;
+
+    private:
+        struct Section {
+            std::string name;
+            const uint8_t *data;
+            std::size_t size;
+            uint64_t mapHash;
+            Length hashCellSize;
+            // the content of sections that were added instead of read
+            std::vector<uint8_t> owned;
+        };
+
+        std::vector<Section> sections;
+        // the mapped file, or a copy of it where mapping is not supported
+        void *mapping;
+        std::size_t mappingSize;
+        std::vector<uint8_t> buffer;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_PRECOMPUTATIONBUNDLE_HPP
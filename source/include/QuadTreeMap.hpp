@@ -0,0 +1,180 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QuadTreeMap.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Region quadtree map
+//!
+//! A map stored as a region quadtree over grid cells.
+//! Every node knows which kinds of cells it contains, so box queries only
+//! descend into regions that are mixed.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_QUADTREEMAP_HPP
+#define R2D2_PATHFINDING_QUADTREEMAP_HPP
+
+#include <cstdint>
+#include <vector>
+#include <MapInterface.hpp>
+#include "GridMap.hpp"
+#include "VersionedMap.hpp"
+
+namespace r2d2 {
+
+    /**
+     * map stored as a region quadtree
+     *
+     * the tree is built from the cells of a GridMap. four children that are
+     * all uniform with the same value are merged into a single leaf, so large
+     * free or occupied areas take a single node. every node stores which
+     * values occur below it, which lets get_box_info skip uniform regions and
+     * regions that lie completely inside the queried box.
+     * the leaves can be walked as a graph, see QuadTreePathFinder.
+     */
+    class QuadTreeMap : public ReadOnlyMap, public VersionedMap {
+    public:
+        /**
+         * constructor
+         *
+         * \param grid the cells to build the tree from, at most 65536 cells
+         * wide and high
+         * \throws std::invalid_argument if the grid is too large
+         */
+        QuadTreeMap(const GridMap &grid = GridMap{});
+
+        /**
+         * rebuild the tree from other cells, incrementing the map version
+         *
+         * \param grid the cells to build the tree from
+         */
+        void assign(const GridMap &grid);
+
+        /**
+         * get the leaf that contains a coordinate
+         *
+         * \param coord the coordinate to look up
+         * \return the index of the leaf, or -1 if the coordinate is outside
+         * of the grid
+         */
+        int find_leaf(const Coordinate &coord) const;
+
+        /**
+         * get the leaves that touch a leaf, at a side or at a corner
+         *
+         * \param leaf the index of the leaf
+         * \param adjacent vector the leaves get appended to
+         */
+        void get_adjacent_leaves(int leaf, std::vector<int> &adjacent) const;
+
+        /**
+         * get the area a leaf covers
+         *
+         * \param leaf the index of the leaf
+         */
+        Box get_leaf_box(int leaf) const;
+
+        /**
+         * get the value of all cells of a leaf
+         *
+         * \param leaf the index of the leaf
+         * \return one of GridMap::FREE, OBSTACLE or UNKNOWN
+         */
+        uint8_t get_leaf_value(int leaf) const;
+
+        Coordinate get_origin() const {
+            return origin;
+        }
+
+        Length get_cell_size() const {
+            return cellSize;
+        }
+
+        int get_node_count() const {
+            return int(nodes.size());
+        }
+
+        int get_leaf_count() const {
+            return leafCount;
+        }
+
+        /**
+         * get the amount of memory used by the tree
+         *
+         * \return the size in bytes
+         */
+        std::size_t get_memory_usage() const;
+
+        virtual const BoxInfo get_box_info(const Box box) override;
+
+        virtual const Box get_map_bounding_box() override;
+
+        virtual uint64_t get_map_version() const override;
+
+    private:
+        //! the bits of QuadNode::contents
+        static const uint8_t HAS_FREE = 1, HAS_OBSTACLE = 2, HAS_UNKNOWN = 4;
+
+        struct QuadNode {
+            // the first of four consecutive children, -1 for a leaf
+            int32_t children;
+            // the bottom left cell, the square is 2^level cells wide
+            uint16_t x, y;
+            uint8_t level;
+            uint8_t contents;
+        };
+
+        Coordinate origin;
+        Length cellSize;
+        int width, height;
+        int leafCount;
+        std::vector<QuadNode> nodes;
+        uint64_t version;
+
+        void build(const GridMap &grid, int node);
+
+        int find_cell(int x, int y) const;
+
+        int get_size(int node) const {
+            return 1 << nodes[node].level;
+        }
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_QUADTREEMAP_HPP
@@ -0,0 +1,193 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QuadTreePathFinder.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Pathfinder over quadtree leaves
+//!
+//! Searches over the free leaves of a quadtree instead of a regular lattice,
+//! so open areas take only a few search nodes.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_QUADTREEPATHFINDER_HPP
+#define R2D2_PATHFINDING_QUADTREEPATHFINDER_HPP
+
+#include <mutex>
+#include "PathFinder.hpp"
+#include "Astar.hpp"
+#include "MapAccessGroup.hpp"
+#include "QuadTreeMap.hpp"
+
+namespace r2d2 {
+
+    /**
+     * pathfinder that searches over the free leaves of a quadtree
+     *
+     * the map is first copied into a quadtree of the positions the robot
+     * can be on: a cell is free when the robot fits on every position in
+     * it. every free leaf of that tree is a search node, and two leaves are
+     * connected when they touch. because a leaf is convex, the robot can go
+     * in a straight line from a leaf center to the middle of the border with
+     * the next leaf and on to its center. the path is smoothed afterwards.
+     * the copy is cached as long as the map version does not change.
+     * the paths are not the shortest possible, but large open areas take
+     * only a single node.
+     */
+    class QuadTreePathFinder : public PathFinder {
+    public:
+        /**
+         * constructor
+         *
+         * \param map the map to search on
+         * \param robotBox the size of the robot
+         * \param cellSize the cell size of the quadtree of robot positions,
+         * the cell size of the map itself is used for a QuadTreeMap
+         */
+        QuadTreePathFinder(SharedObject<ReadOnlyMap> &map, Box robotBox,
+                           Length cellSize = Length::METER);
+
+        virtual bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path) override;
+
+        /**
+         * get the quadtree of the positions the robot can be on
+         *
+         * \return the tree, built from the current map when needed
+         */
+        std::shared_ptr<const QuadTreeMap> get_free_space();
+
+    private:
+        /**
+         * the state of a single query, shared by all nodes of its search
+         */
+        struct SearchContext {
+            const QuadTreeMap &space;
+            Coordinate start;
+            int startLeaf;
+            std::vector<int> adjacent;
+        };
+
+        /**
+         * implementation of the astar node from Astar.hpp
+         */
+        class LeafNode : public Node<LeafNode> {
+        public:
+            LeafNode(SearchContext &context, int leaf, Coordinate point,
+                     Coordinate portal,
+                     Length g = r2d2::Length::METER *
+                                std::numeric_limits<double>::infinity(),
+                     std::weak_ptr<LeafNode> parent = {});
+
+            virtual bool operator==(const LeafNode &lhs) const override;
+
+            virtual std::vector<LeafNode> get_available_nodes(
+                    std::shared_ptr<LeafNode> &self) override;
+
+            std::reference_wrapper<SearchContext> context;
+            int leaf;
+            // where the robot stands in the leaf
+            Coordinate point;
+            // the middle of the border with the parent leaf
+            Coordinate portal;
+        };
+        friend struct std::hash<LeafNode>;
+
+        MapAccessGroup mapAccess;
+        const Translation robotBox;
+        const Length cellSize;
+
+        std::mutex freeSpaceMutex;
+        std::shared_ptr<const QuadTreeMap> freeSpace;
+        uint64_t freeSpaceVersion;
+
+        /**
+         * get the free space tree for a map
+         *
+         * \param map the map the tree has to match
+         * \return the cached tree, or a new one if the map changed
+         */
+        std::shared_ptr<const QuadTreeMap> get_free_space(ReadOnlyMap &map);
+
+        /**
+         * test whether the robot can travel in a straight line
+         *
+         * \param map the map to test on
+         * \param from the coordinate that will be travelled from
+         * \param to the coordinate that will be travelled to
+         * \return true if the robot stays clear of obstacles and unknown space
+         */
+        bool can_travel(ReadOnlyMap &map, const Coordinate &from,
+                        const Coordinate &to) const;
+
+        /**
+         * get the middle of the border that two touching boxes share
+         */
+        static Coordinate get_portal(const Box &a, const Box &b);
+
+        /**
+         * strips a path of all unnecessary nodes
+         *
+         * \param map the map to check the smoothed path against
+         * \param path the path to smooth
+         * \param start the original start coordinate
+         */
+        void smooth_path(ReadOnlyMap &map, std::vector<Coordinate> &path,
+                         Coordinate start) const;
+    };
+
+}
+
+namespace std {
+
+    /**
+     * hash for the leaf node class, used for set insertion
+     */
+    template<>
+    struct hash<r2d2::QuadTreePathFinder::LeafNode> {
+        std::size_t operator()(
+                const r2d2::QuadTreePathFinder::LeafNode &node) const {
+            return std::hash<int>()(node.leaf);
+        }
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_QUADTREEPATHFINDER_HPP
@@ -0,0 +1,180 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QueryTrace.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Query trace recording
+//!
+//! Binary trace of map states and pathfinding queries, used for recording
+//! production workloads and replaying them offline.
+//!
+//! A trace starts with the magic "R2PT" and a format version, followed by
+//! records. Every record starts with a type byte:
+//! - a map snapshot holds the grid geometry and the run length encoded cells
+//! - a map delta holds the cells that changed since the previous map record
+//! - a query holds the query, its result and how long it took
+//! All numbers are little endian, counts and cell runs are stored as varints.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_QUERYTRACE_HPP
+#define R2D2_PATHFINDING_QUERYTRACE_HPP
+
+#include <chrono>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include "GridMap.hpp"
+
+namespace r2d2 {
+
+    /**
+     * a single recorded query
+     */
+    struct TraceQuery {
+        Coordinate start, goal;
+        //! the size of the robot the query was done for
+        Translation robotBox;
+        bool found;
+        //! the amount of waypoints in the resulting path
+        uint32_t pathLength;
+        //! how long the query took
+        uint64_t durationNs;
+        //! when the query was started, relative to the start of the trace
+        uint64_t timestampNs;
+    };
+
+    /**
+     * writes a trace to a stream
+     *
+     * all functions can be called from multiple threads, records are written
+     * in the order the calls are made.
+     */
+    class QueryTraceWriter {
+    public:
+        //! the format version that is written
+        static const uint32_t FORMAT_VERSION = 1;
+
+        /**
+         * constructor, writes the trace header
+         *
+         * \param out the stream to write the trace to, opened in binary mode
+         */
+        QueryTraceWriter(std::ostream &out);
+
+        /**
+         * record the current state of the map
+         *
+         * if the map has the same geometry as the previously written map and
+         * only a small part of it changed, only the changed cells are written
+         * \param map the map state queries will be done on next
+         */
+        void write_map(const GridMap &map);
+
+        /**
+         * record a query
+         */
+        void write_query(const TraceQuery &query);
+
+        /**
+         * get the time since the trace was started, for TraceQuery::timestampNs
+         */
+        uint64_t get_timestamp() const;
+
+    private:
+        std::mutex mutex;
+        std::ostream &out;
+        std::chrono::steady_clock::time_point started;
+        GridMap last;
+        bool hasMap;
+    };
+
+    /**
+     * reads a trace from a stream
+     *
+     * the reader keeps the map state of the trace up to date while reading,
+     * so the map can be used for replaying the queries that follow it.
+     */
+    class QueryTraceReader {
+    public:
+        //! the kinds of records in a trace
+        enum class Record {
+            MAP, QUERY, END
+        };
+
+        /**
+         * constructor, reads the trace header
+         *
+         * \param in the stream to read from, opened in binary mode
+         * \throws std::runtime_error if the stream does not contain a trace
+         */
+        QueryTraceReader(std::istream &in);
+
+        /**
+         * read the next record
+         *
+         * after a MAP record the map returned by get_map has been updated,
+         * after a QUERY record the query can be read with get_query.
+         * \return the kind of record read, END at the end of the trace
+         * \throws std::runtime_error if the trace is corrupt
+         */
+        Record next();
+
+        /**
+         * get the map state
+         *
+         * the same object is updated in place for every map record, so it can
+         * be shared with a pathfinder for the whole trace
+         */
+        GridMap &get_map() {
+            return map;
+        }
+
+        const TraceQuery &get_query() const {
+            return query;
+        }
+
+    private:
+        std::istream &in;
+        GridMap map;
+        TraceQuery query;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_QUERYTRACE_HPP
@@ -0,0 +1,254 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ScenarioGenerator.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Seeded procedural maps for performance testing
+//!
+//! Generates maps of several kinds from a seed, the same on every machine
+//! and for any amount of threads, with solvable queries and their costs.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_SCENARIOGENERATOR_HPP
+#define R2D2_PATHFINDING_SCENARIOGENERATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "GridMap.hpp"
+
+namespace r2d2 {
+
+    /**
+     * the kinds of maps a ScenarioGenerator makes
+     */
+    enum class ScenarioKind {
+        //! every cell is an obstacle with the density as probability
+        RANDOM,
+        //! rooms of 16 cells, with a door of 3 cells in every wall
+        ROOMS,
+        //! a maze with passages of 3 cells and walls of 1 cell
+        MAZE,
+        //! blobs of rock from smoothed noise, the density is the threshold
+        CAVES,
+        //! rows of racks with aisles of 2 and 3 cells in between
+        WAREHOUSE,
+        //! a network of corridors of 2 cells through solid rock, with loops
+        CORRIDORS
+    };
+
+    /**
+     * get the lower case name of a kind, like "rooms"
+     */
+    const char *get_scenario_kind_name(ScenarioKind kind);
+
+    /**
+     * find the kind with a name made by get_scenario_kind_name
+     *
+     * \return false if there is no kind with the name
+     */
+    bool parse_scenario_kind(const std::string &name, ScenarioKind &kind);
+
+    /**
+     * a query between two free cells of a scenario
+     */
+    struct ScenarioQuery {
+        Coordinate start, goal;
+        //! the length of the shortest path between the cell centers, see
+        //! ScenarioGenerator::find_reference_cost
+        Length referenceCost;
+    };
+
+    /**
+     * a generated map with its queries
+     */
+    struct Scenario {
+        GridMap map;
+        std::vector<ScenarioQuery> queries;
+    };
+
+    /**
+     * generates maps from a seed
+     *
+     * the value of every cell is computed from the seed and its position
+     * only, using a hash instead of a random generator with a state. the
+     * result is the same for every amount of threads and on every platform,
+     * and any band of rows can be generated on its own, so maps that do not
+     * fit in memory can be written out in parts.
+     * the cells are a meter wide, the map starts at the origin.
+     */
+    class ScenarioGenerator {
+    public:
+        /**
+         * constructor
+         *
+         * \param kind the kind of map
+         * \param width the amount of cells in the x direction
+         * \param height the amount of cells in the y direction
+         * \param seed the seed every cell is derived from
+         * \param density the share of obstacles for RANDOM, and the noise
+         * threshold for CAVES, where .45 gives large open caves. the other
+         * kinds do not use it
+         */
+        ScenarioGenerator(ScenarioKind kind, int width, int height,
+                          uint64_t seed, double density = .25);
+
+        /**
+         * get the value of a single cell
+         *
+         * \return GridMap::FREE or GridMap::OBSTACLE, cells outside of the
+         * map are obstacles
+         */
+        uint8_t get_cell(int x, int y) const;
+
+        /**
+         * generate a band of rows
+         *
+         * \param firstRow the first row to generate
+         * \param rowCount the amount of rows
+         * \param cells receives rowCount * width cells, row by row
+         * \param threadCount the amount of threads, 0 to use all cores
+         */
+        void generate_rows(int firstRow, int rowCount, uint8_t *cells,
+                           int threadCount = 0) const;
+
+        /**
+         * generate the whole map
+         *
+         * \param threadCount the amount of threads, 0 to use all cores
+         */
+        GridMap generate(int threadCount = 0) const;
+
+        /**
+         * pick queries between connected free cells of a generated map
+         *
+         * candidate pairs are drawn from the seed, at least a quarter of
+         * the map size apart, and kept when find_reference_cost finds a
+         * path. the candidates are checked in parallel, but taken in order,
+         * so the queries do not depend on the amount of threads.
+         * \param map the map made by generate
+         * \param count the amount of queries
+         * \param threadCount the amount of threads, 0 to use all cores
+         * \param maxExpansions the amount of cells a single reference search
+         * may expand before its candidate is skipped
+         * \return the queries, fewer than count if not enough candidates
+         * were solvable
+         */
+        std::vector<ScenarioQuery> make_queries(const GridMap &map, int count,
+                                                int threadCount = 0,
+                                                int maxExpansions = 1 << 22)
+                                                const;
+
+        /**
+         * generate the map and its queries
+         */
+        Scenario make_scenario(int queryCount, int threadCount = 0) const;
+
+        /**
+         * find the length of the shortest path between two cell centers
+         *
+         * the path goes from cell center to cell center over free cells, to
+         * the eight neighbours, where a diagonal step also needs both cells
+         * beside it to be free. every path of a robot that fits in a cell
+         * corresponds to such a path, so the cost is a reference for the
+         * pathfinders.
+         * \param map the map to search
+         * \param startX the x index of the start cell
+         * \param startY the y index of the start cell
+         * \param goalX the x index of the goal cell
+         * \param goalY the y index of the goal cell
+         * \param maxExpansions the amount of cells expanded before giving up
+         * \return the cost in cells, or a negative value if there is no path
+         */
+        static double find_reference_cost(const GridMap &map, int startX,
+                                          int startY, int goalX, int goalY,
+                                          int maxExpansions = 1 << 22);
+
+        ScenarioKind get_kind() const {
+            return kind;
+        }
+
+        int get_width() const {
+            return width;
+        }
+
+        int get_height() const {
+            return height;
+        }
+
+        uint64_t get_seed() const {
+            return seed;
+        }
+
+    private:
+        ScenarioKind kind;
+        int width, height;
+        uint64_t seed;
+        double density;
+
+        /**
+         * hash a position with the seed
+         *
+         * \param x the first coordinate
+         * \param y the second coordinate
+         * \param salt separates the hashes used for different decisions
+         */
+        uint64_t hash(int64_t x, int64_t y, uint64_t salt) const;
+
+        /**
+         * hash a position to a number in [0, 1)
+         */
+        double random(int64_t x, int64_t y, uint64_t salt) const {
+            return double(hash(x, y, salt) >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+        /**
+         * the direction a block of a binary tree maze opens to
+         *
+         * \return 1 for east, 2 for north, 0 for the last block
+         */
+        int get_opening(int blockX, int blockY, int blocksX,
+                        int blocksY) const;
+
+        double get_noise(int x, int y) const;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_SCENARIOGENERATOR_HPP
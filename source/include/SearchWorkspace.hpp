@@ -0,0 +1,194 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   SearchWorkspace.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Reusable search memory
+//!
+//! The hash table and open list of a lattice search, kept between queries so a
+//! search does not allocate memory once the buffers are large enough.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_SEARCHWORKSPACE_HPP
+#define R2D2_PATHFINDING_SEARCHWORKSPACE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace r2d2 {
+
+    /**
+     * scratch memory of a lattice search, reused between queries
+     *
+     * the visited nodes are kept in an open addressing hash table. instead of
+     * clearing the table for every query, every entry stores the generation
+     * of the search that wrote it, and starting a new search increments the
+     * generation. the table and the open list keep their capacity, so once
+     * they are large enough a search no longer allocates memory.
+     * a workspace can only be used by one search at a time.
+     */
+    class SearchWorkspace {
+    public:
+        //! a lattice position, packed with make_key
+        typedef int64_t Key;
+
+        //! keys that are not a lattice position
+        static const Key NO_KEY = INT64_MIN, START_KEY = INT64_MAX;
+
+        struct Visited {
+            Key key;
+            Key parent;
+            double g;
+            uint32_t generation;
+            //! set by searches that need to know which nodes were expanded
+            bool closed;
+        };
+
+        struct OpenNode {
+            double f;
+            double g;
+            Key key;
+
+            bool operator<(const OpenNode &rhs) const {
+                // std heaps put the largest element first, so the lowest f
+                // goes first, and the highest g on ties
+                return f > rhs.f || (f == rhs.f && g < rhs.g);
+            }
+        };
+
+        SearchWorkspace();
+
+        /**
+         * get the workspace of the calling thread
+         */
+        static SearchWorkspace &get_thread_workspace();
+
+        static Key make_key(int x, int y) {
+            return Key(uint64_t(uint32_t(x)) << 32 | uint32_t(y));
+        }
+
+        static int get_key_x(Key key) {
+            return int(int32_t(uint64_t(key) >> 32));
+        }
+
+        static int get_key_y(Key key) {
+            return int(int32_t(uint32_t(uint64_t(key))));
+        }
+
+        /**
+         * forget the previous search, keeping the memory
+         */
+        void reset();
+
+        /**
+         * find a node visited during the current search
+         *
+         * \param key the node to look for
+         * \return the node, or nullptr if it was not visited
+         */
+        Visited *find(Key key);
+
+        /**
+         * find a node visited during the current search, or add it
+         *
+         * a new node has an infinite g and no parent. adding a node can move
+         * the other nodes, so earlier returned pointers become invalid.
+         * \param key the node to look for
+         * \return the node
+         */
+        Visited &insert(Key key);
+
+        void push(const OpenNode &node);
+
+        /**
+         * take the node with the lowest f from the open list
+         *
+         * \param node receives the node
+         * \return false if the open list is empty
+         */
+        bool pop(OpenNode &node);
+
+        /**
+         * get the node with the lowest f without taking it
+         *
+         * \return the node, or nullptr if the open list is empty
+         */
+        const OpenNode *peek() const {
+            return open.empty() ? nullptr : &open.front();
+        }
+
+        /**
+         * compute the f of every open node again, for a search that
+         * continues towards another target
+         *
+         * \param heuristic returns the new heuristic of a key
+         */
+        template<typename Heuristic>
+        void retarget(Heuristic heuristic) {
+            for (OpenNode &node : open) {
+                node.f = node.g + heuristic(node.key);
+            }
+            std::make_heap(open.begin(), open.end());
+        }
+
+        /**
+         * get the amount of memory held by the workspace
+         *
+         * \return the size in bytes
+         */
+        std::size_t get_memory_usage() const;
+
+    private:
+        std::vector<Visited> table;
+        std::size_t count;
+        uint32_t generation;
+        std::vector<OpenNode> open;
+
+        std::size_t get_slot(Key key) const {
+            uint64_t hash = uint64_t(key) * 0x9E3779B97F4A7C15ull;
+            return std::size_t(hash ^ (hash >> 32)) & (table.size() - 1);
+        }
+
+        void grow();
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_SEARCHWORKSPACE_HPP
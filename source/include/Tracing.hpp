@@ -0,0 +1,238 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   Tracing.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Timeline tracing of the planner
+//!
+//! Trace points around the phases of a query, recorded into per-thread ring
+//! buffers and exported as Chrome trace event JSON. The trace points are only
+//! compiled in when R2D2_PATHFINDING_TRACING is defined.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_TRACING_HPP
+#define R2D2_PATHFINDING_TRACING_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+#ifdef R2D2_PATHFINDING_TRACING
+//! trace the rest of the enclosing scope as an event
+#define R2D2_TRACE_SCOPE(var, name) r2d2::TraceScope var{name}
+//! end the event of a trace scope before the scope ends
+#define R2D2_TRACE_END(var) var.end()
+//! end the event of a trace scope every TraceScope::CHUNK calls, starting
+//! a new one with the same name
+#define R2D2_TRACE_CHUNK(var) var.chunk()
+//! trace the rest of the enclosing scope as part of a burst of map queries
+#define R2D2_TRACE_BOX_QUERY(var) r2d2::TraceBoxQuery var{}
+#else
+#define R2D2_TRACE_SCOPE(var, name)
+#define R2D2_TRACE_END(var)
+#define R2D2_TRACE_CHUNK(var)
+#define R2D2_TRACE_BOX_QUERY(var)
+#endif
+
+namespace r2d2 {
+
+    /**
+     * fixed size buffer of the latest events of a single thread
+     *
+     * only the owning thread records events, other threads can read them at
+     * any time without locking. when the buffer is full the oldest events
+     * are overwritten, and a reader skips events that were overwritten
+     * while it read them.
+     */
+    class TraceBuffer {
+    public:
+        //! the amount of events kept, a power of two
+        static const std::size_t CAPACITY = 1 << 15;
+
+        /**
+         * constructor
+         *
+         * \param threadId the id of the thread in the exported trace
+         */
+        TraceBuffer(int threadId);
+
+        /**
+         * record an event, only called by the owning thread
+         *
+         * \param name the name of the event, a string that lives as long as
+         * the program
+         * \param begin the start of the event, see TraceLog::now
+         * \param duration the duration of the event in nanoseconds
+         * \param count the amount of operations in the event, 0 for none
+         */
+        void record(const char *name, uint64_t begin, uint64_t duration,
+                    uint64_t count = 0);
+
+        /**
+         * write all events that are not cleared as trace event objects
+         *
+         * \param out the stream to write to
+         * \param first whether no event was written before
+         * \return whether no event was written, including before
+         */
+        bool write(std::ostream &out, bool first) const;
+
+        /**
+         * forget the events recorded so far
+         */
+        void clear();
+
+        int get_thread_id() const {
+            return threadId;
+        }
+
+    private:
+        struct Slot {
+            std::atomic<const char *> name;
+            std::atomic<uint64_t> begin, duration, count;
+        };
+
+        int threadId;
+        std::unique_ptr<Slot[]> slots;
+        // the amount of events ever recorded, the amount of which recording
+        // started, and the first one not cleared
+        std::atomic<uint64_t> head, writing, tail;
+    };
+
+    /**
+     * the collection of the trace buffers of all threads
+     */
+    class TraceLog {
+    public:
+        /**
+         * get the trace buffer of the calling thread
+         *
+         * the buffer is taken on first use. when the thread ends, its last
+         * burst of map queries is recorded and the buffer is handed on to
+         * the next thread that starts tracing, so there are only as many
+         * buffers as threads that trace at the same time. the events of the
+         * ended thread are exported until they are overwritten.
+         */
+        static TraceBuffer &get_thread_buffer();
+
+        /**
+         * get the current time for events
+         *
+         * \return the nanoseconds since the first call
+         */
+        static uint64_t now();
+
+        /**
+         * write the events of all threads as Chrome trace event JSON
+         *
+         * the result can be opened in chrome://tracing or Perfetto. events
+         * that are being recorded while writing might be left out.
+         * \param out the stream to write to
+         */
+        static void write_chrome_trace(std::ostream &out);
+
+        /**
+         * forget the events of all threads
+         */
+        static void clear();
+    };
+
+    /**
+     * records the time from its construction until it ends as an event
+     */
+    class TraceScope {
+    public:
+        //! the amount of chunk calls per event
+        static const int CHUNK = 1024;
+
+        TraceScope(const char *name);
+
+        TraceScope(const TraceScope &) = delete;
+
+        TraceScope &operator=(const TraceScope &) = delete;
+
+        ~TraceScope();
+
+        /**
+         * record the event, if it was not recorded already
+         */
+        void end();
+
+        /**
+         * count a step of a loop, recording an event for every CHUNK steps
+         */
+        void chunk();
+
+    private:
+        const char *name;
+        uint64_t begin;
+        int steps;
+        bool ended;
+    };
+
+    /**
+     * records a map query, merging queries that follow each other closely
+     * into a single event
+     *
+     * the merged event is recorded when a query starts after a gap, or when
+     * a TraceScope on the same thread ends.
+     */
+    class TraceBoxQuery {
+    public:
+        //! the longest gap between queries of a single event, in nanoseconds
+        static const uint64_t MAX_GAP = 2000;
+
+        TraceBoxQuery();
+
+        TraceBoxQuery(const TraceBoxQuery &) = delete;
+
+        TraceBoxQuery &operator=(const TraceBoxQuery &) = delete;
+
+        ~TraceBoxQuery();
+
+        /**
+         * record the current burst of queries of the calling thread
+         */
+        static void flush();
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_TRACING_HPP
@@ -0,0 +1,98 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   TracingPathFinder.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Query trace recording pathfinder
+//!
+//! A pathfinder that passes queries on to another pathfinder while recording
+//! them, together with the state of the map, to a query trace.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_TRACINGPATHFINDER_HPP
+#define R2D2_PATHFINDING_TRACINGPATHFINDER_HPP
+
+#include "PathFinder.hpp"
+#include "QueryTrace.hpp"
+
+namespace r2d2 {
+
+    /**
+     * records the queries of another pathfinder to a trace
+     *
+     * before every query the map version is checked, and when it changed a
+     * grid copy of the map is written to the trace. maps that do not
+     * implement VersionedMap are only written once. the copy is made just
+     * before the query runs, so a change made in between is not recorded.
+     */
+    class TracingPathFinder : public PathFinder {
+    public:
+        /**
+         * constructor
+         *
+         * \param map the map the wrapped pathfinder works on
+         * \param robotBox the robot size of the wrapped pathfinder
+         * \param pathFinder the pathfinder answering the queries
+         * \param writer the trace to write to
+         * \param cellSize the cell size of the map copies in the trace
+         */
+        TracingPathFinder(SharedObject<ReadOnlyMap> &map, Box robotBox,
+                          PathFinder &pathFinder, QueryTraceWriter &writer,
+                          Length cellSize = Length::METER);
+
+        virtual bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path) override;
+
+    private:
+        SharedObject<ReadOnlyMap> &map;
+        Translation robotBox;
+        PathFinder &pathFinder;
+        QueryTraceWriter &writer;
+        Length cellSize;
+
+        std::mutex mutex;
+        bool mapWritten;
+        uint64_t writtenVersion;
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_TRACINGPATHFINDER_HPP
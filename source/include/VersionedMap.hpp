@@ -0,0 +1,99 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   VersionedMap.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Map content versioning
+//!
+//! Optional interface for maps that can tell when their content changed.
+//! Pathfinder structures that are derived from the map (such as distance fields)
+//! use the version to detect that they have become stale.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_VERSIONEDMAP_HPP
+#define R2D2_PATHFINDING_VERSIONEDMAP_HPP
+
+#include <cstdint>
+#include <MapInterface.hpp>
+
+namespace r2d2 {
+
+    /**
+     * interface for maps that keep track of changes to their content
+     *
+     * a map implementing this interface increments its version every time its
+     * content changes. maps that do not implement it are considered static by
+     * the pathfinder.
+     */
+    class VersionedMap {
+    public:
+        virtual ~VersionedMap() { }
+
+        /**
+         * get the current version of the map content
+         *
+         * \return a number that changes whenever the content of the map changes
+         */
+        virtual uint64_t get_map_version() const = 0;
+
+        /**
+         * check whether a map keeps track of its changes
+         *
+         * \param map the map to check
+         * \return whether the map implements this interface
+         */
+        static bool is_versioned(ReadOnlyMap &map) {
+            return dynamic_cast<VersionedMap *>(&map) != nullptr;
+        }
+
+        /**
+         * get the version of a map, or 0 if the map is not versioned
+         *
+         * \param map the map to query
+         * \return the version of the map content
+         */
+        static uint64_t get_version_of(ReadOnlyMap &map) {
+            VersionedMap *versioned = dynamic_cast<VersionedMap *>(&map);
+            return versioned == nullptr ? 0 : versioned->get_map_version();
+        }
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_VERSIONEDMAP_HPP
@@ -0,0 +1,211 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   VisibilityGraph.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Visibility graph of the free space
+//!
+//! A graph between the corners of the obstacles of a map, inflated by the robot
+//! size, used for finding shortest any-angle paths.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_VISIBILITYGRAPH_HPP
+#define R2D2_PATHFINDING_VISIBILITYGRAPH_HPP
+
+#include <cstdint>
+#include <vector>
+#include <MapInterface.hpp>
+#include "PrecomputationBundle.hpp"
+
+namespace r2d2 {
+
+    /**
+     * visibility graph between the corners of the inflated obstacles
+     *
+     * the map is first sampled into a grid of robot positions: a cell is
+     * free when the robot fits on every position in it, including its
+     * border. the corners of the blocked areas are the vertices, and two
+     * vertices are connected when the straight line between them only
+     * passes free cells. edges that do not go around the corners on both
+     * ends can never be part of a shortest path, and are left out.
+     * the graph is made once and can then answer any amount of queries,
+     * also from multiple threads at once. it suits maps with few, large
+     * obstacles, as the amount of edges grows with the square of the amount
+     * of corners.
+     */
+    class VisibilityGraph {
+    public:
+        /**
+         * build the graph of a map
+         *
+         * \param map the map to build the graph of
+         * \param robotBox the size of the robot
+         * \param cellSize the size of the cells of robot positions, smaller
+         * cells leave more room around obstacles but give more corners
+         * \param threadCount the amount of threads used for sampling the map
+         * and finding the edges, 0 to use all cores
+         */
+        VisibilityGraph(ReadOnlyMap &map, Translation robotBox,
+                        Length cellSize = Length::METER, int threadCount = 0);
+
+        /**
+         * read a graph written by serialize
+         *
+         * \param in the data of the graph
+         * \param mapVersion the version of the map the graph is used for,
+         * which the caller has checked against the bundle
+         * \throws std::runtime_error if the data is not a valid graph
+         */
+        VisibilityGraph(PrecomputationBundle::Reader &in, uint64_t mapVersion);
+
+        /**
+         * write the graph, so it can be read again without the map
+         *
+         * \param out receives the data of the graph
+         */
+        void serialize(PrecomputationBundle::Writer &out) const;
+
+        /**
+         * find the shortest path between two positions
+         *
+         * the start and the goal are connected to all vertices they can see,
+         * after which the graph is searched with A*.
+         * \param start the start coordinate
+         * \param goal the goal coordinate
+         * \param path receives the path without the start, ending at the goal
+         * \param pathCost if not nullptr, receives the length of the path
+         * \return whether there is a path
+         */
+        bool find_path(const Coordinate &start, const Coordinate &goal,
+                       std::vector<Coordinate> &path,
+                       Length *pathCost = nullptr) const;
+
+        /**
+         * check whether the robot fits on a position
+         */
+        bool is_free(const Coordinate &coord) const;
+
+        /**
+         * check whether the robot can travel in a straight line
+         */
+        bool is_visible(const Coordinate &from, const Coordinate &to) const;
+
+        Length get_cell_size() const {
+            return cellSize;
+        }
+
+        int get_vertex_count() const {
+            return int(vertices.size());
+        }
+
+        Coordinate get_vertex(int vertex) const;
+
+        /**
+         * get the amount of edges, counting both directions once
+         */
+        int get_edge_count() const {
+            return int(targets.size() / 2);
+        }
+
+        /**
+         * get the vertices connected to a vertex
+         *
+         * \param vertex the vertex
+         * \param neighbours receives the connected vertices, in order
+         */
+        void get_neighbours(int vertex, std::vector<int> &neighbours) const;
+
+        /**
+         * get the version of the map the graph was made of
+         */
+        uint64_t get_map_version() const {
+            return mapVersion;
+        }
+
+        /**
+         * get the amount of memory used by the graph
+         *
+         * \return the size in bytes
+         */
+        std::size_t get_memory_usage() const;
+
+    private:
+        struct Vertex {
+            // the grid point of the corner
+            int x, y;
+            // the direction of the blocked cell at the corner
+            int dirX, dirY;
+        };
+
+        Coordinate origin;
+        Length cellSize;
+        int width, height;
+        std::vector<uint8_t> blocked;
+        std::vector<Vertex> vertices;
+        // the edges of vertex i are in [firstEdge[i], firstEdge[i + 1])
+        std::vector<int> firstEdge, targets;
+        std::vector<double> lengths;
+        uint64_t mapVersion;
+
+        bool is_blocked(int x, int y) const {
+            return x < 0 || y < 0 || x >= width || y >= height ||
+                   blocked[std::size_t(y) * std::size_t(width) + std::size_t(x)];
+        }
+
+        /**
+         * check whether a point in grid units lies on a free cell
+         */
+        bool is_covered(double x, double y) const;
+
+        /**
+         * check whether a line in grid units only passes free cells
+         */
+        bool is_visible(double fromX, double fromY, double toX,
+                        double toY) const;
+
+        /**
+         * check whether a line through a vertex goes around its corner,
+         * instead of into the blocked cell or away from it
+         */
+        static bool is_taut(const Vertex &vertex, double dx, double dy);
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_VISIBILITYGRAPH_HPP
@@ -0,0 +1,126 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   VisibilityGraphPathFinder.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Visibility graph pathfinder
+//!
+//! A pathfinder for static maps that searches a precomputed visibility graph
+//! between the corners of the obstacles.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_VISIBILITYGRAPHPATHFINDER_HPP
+#define R2D2_PATHFINDING_VISIBILITYGRAPHPATHFINDER_HPP
+
+#include <memory>
+#include <mutex>
+#include "PathFinder.hpp"
+#include "MapAccessGroup.hpp"
+#include "VisibilityGraph.hpp"
+
+namespace r2d2 {
+
+    /**
+     * pathfinder that searches a visibility graph of the map
+     *
+     * the graph is made on the first query, and again whenever the map
+     * version changed, so this pathfinder is meant for maps that rarely
+     * change. the paths are the shortest any-angle paths around the
+     * obstacles, as far as the cells of the graph allow.
+     */
+    class VisibilityGraphPathFinder : public PathFinder {
+    public:
+        /**
+         * constructor
+         *
+         * \param map the map to search on
+         * \param robotBox the size of the robot
+         * \param cellSize the cell size of the graph, see VisibilityGraph
+         * \param threadCount the amount of threads used for making the
+         * graph, 0 to use all cores
+         */
+        VisibilityGraphPathFinder(SharedObject<ReadOnlyMap> &map, Box robotBox,
+                                  Length cellSize = Length::METER,
+                                  int threadCount = 0);
+
+        virtual bool get_path_to_coordinate(
+                Coordinate start,
+                Coordinate goal,
+                std::vector<Coordinate> &path) override;
+
+        /**
+         * get the visibility graph of the map
+         *
+         * \return the graph, made from the current map when needed
+         */
+        std::shared_ptr<const VisibilityGraph> get_graph();
+
+        /**
+         * add the visibility graph of the current map to a bundle
+         *
+         * \param bundle the bundle that receives a "visibility" section
+         */
+        void save_precomputation(PrecomputationBundle &bundle);
+
+        /**
+         * use the visibility graph of a bundle instead of making it
+         *
+         * \param bundle the bundle to read
+         * \return whether the graph was taken from the bundle, which is not
+         * the case when it does not match the current map content, the
+         * robot size or the cell size
+         * \throws std::runtime_error if the section is not a valid graph
+         */
+        bool load_precomputation(const PrecomputationBundle &bundle);
+
+    private:
+        MapAccessGroup mapAccess;
+        const Translation robotBox;
+        const Length cellSize;
+        const int threadCount;
+
+        std::mutex graphMutex;
+        std::shared_ptr<const VisibilityGraph> graph;
+
+        std::shared_ptr<const VisibilityGraph> get_graph(ReadOnlyMap &map);
+    };
+
+}
+
+#endif //R2D2_PATHFINDING_VISIBILITYGRAPHPATHFINDER_HPP
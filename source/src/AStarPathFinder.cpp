@@ -9,7 +9,7 @@
 //! \author Chiel Douwes 1666311
 //! \author Ole Achterberg 1651981
 //! \date   Created: 01-04-2016
-//! \date   Last Modified: 15-4-2016
+//! \date   Last Modified: 19-10-2026
 //! \brief  Find the path and returns the path
 //!
 //! Takes a starting point and end point and a reference to a path.
@@ -49,110 +49,700 @@
 // ~< HEADER_VERSION 2016 04 12 >~
 
 #include "../include/AStarPathFinder.hpp"
+#include "../include/BatchedMap.hpp"
+#include "../include/ParallelFor.hpp"
+#include "../include/Tracing.hpp"
+#include "../include/VersionedMap.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
 
 namespace r2d2 {
 
     AStarPathFinder::AStarPathFinder(SharedObject<ReadOnlyMap> &map, Box robotBox) :
             PathFinder{map, robotBox},
-            map(map),
-            mapAccessor{},
-            referenceCount{0},
-            robotBox{robotBox.get_axis_size()} {
+            mapAccess{map},
+            robotBox{robotBox.get_axis_size()},
+            collisionChecking{CollisionChecking::EAGER},
+            distanceFieldMutex{},
+            distanceFields{},
+            connectivityMutex{},
+            connectivityChanged{},
+            connectivity{},
+            connectivityBuilding{false},
+            connectivityThread{},
+            keptSearchBudget{0},
+            resumableMutex{},
+            resumableSearches{} {
+    }
+
+    AStarPathFinder::~AStarPathFinder() {
+        // no query runs anymore, so no other thread is started meanwhile
+        if (connectivityThread.joinable()) {
+            connectivityThread.join();
+        }
     }
 
     bool AStarPathFinder::get_path_to_coordinate(Coordinate start,
                                             Coordinate goal,
                                             std::vector<Coordinate>
                                             &path) {
+        return get_path_to_coordinate(start, goal, path,
+                                      CancellationToken::never());
+    }
+
+    bool AStarPathFinder::get_path_to_coordinate(Coordinate start,
+                                                 Coordinate goal,
+                                                 std::vector<Coordinate> &path,
+                                                 const CancellationToken &token,
+                                                 int *expandedNodes) {
+        return get_path_to_coordinate(start, goal, path, token,
+                                      SearchSettings{collisionChecking},
+                                      expandedNodes);
+    }
+
+    bool AStarPathFinder::get_path_to_coordinate(Coordinate start,
+                                                 Coordinate goal,
+                                                 std::vector<Coordinate> &path,
+                                                 const CancellationToken &token,
+                                                 const SearchSettings &settings,
+                                                 int *expandedNodes) {
+        R2D2_TRACE_SCOPE(query, "get_path_to_coordinate");
+        int expanded = 0;
+        if (expandedNodes != nullptr) {
+            *expandedNodes = 0;
+        }
         // check for the goal node being at the same coordinate as the start node
         if (overlaps(start, goal)) {
             path.clear();
             return true;
         }
+        if (token.is_cancelled()) {
+            return false;
+        }
 
-        std::shared_ptr<SharedObject<ReadOnlyMap>::Accessor> ptr{mapAccessor.lock()};
-        if (ptr == nullptr) {
-            ptr = std::make_shared<SharedObject<ReadOnlyMap>::Accessor>(map);
-            mapAccessor = ptr; // doesn't have to be atomic as it doesn't matter what pointer is stored
+        R2D2_TRACE_SCOPE(acquire, "acquire map");
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        R2D2_TRACE_END(acquire);
+        bool found = settings.maxStepScale > 1 ?
+                     find_path(map, start, goal, path, token, MAX_SEARCH_NODES,
+                               settings, &expanded) :
+                     find_path_resumed(map, start, goal, path, token, settings,
+                                       expanded);
+        if (expandedNodes != nullptr) {
+            *expandedNodes = expanded;
         }
+        return found;
+    }
 
+    bool AStarPathFinder::find_path(ReadOnlyMap &map, Coordinate start,
+                                    Coordinate goal,
+                                    std::vector<Coordinate> &path,
+                                    const CancellationToken &token,
+                                    int maxNodes,
+                                    const SearchSettings &settings,
+                                    int *expandedNodes) {
+        int expanded = 0;
+        if (expandedNodes != nullptr) {
+            *expandedNodes = 0;
+        }
+        if (overlaps(start, goal)) {
+            path.clear();
+            return true;
+        }
         // do a check for end node accessibility before starting the search
-        if (!can_travel(goal, goal)) {
+        if (!can_travel(map, goal, goal)) {
+            return false;
+        }
+        // positions in different components are never connected
+        std::shared_ptr<const ConnectivityIndex> index{get_connectivity(map)};
+        int component;
+        if (!is_connected(index.get(), start, goal, component)) {
+            return false;
+        }
+
+        SearchWorkspace &workspace = SearchWorkspace::get_thread_workspace();
+        bool found = search_lattice(map, start, goal, path, token, workspace,
+                                    index.get(), component, maxNodes,
+                                    settings, expanded);
+        if (!found && settings.maxStepScale > 1 && expanded < maxNodes &&
+            !token.is_cancelled()) {
+            // the long steps missed a passage between the lattice nodes they
+            // skipped, the fixed lattice does not
+            SearchSettings fixed{settings};
+            fixed.maxStepScale = 1;
+            int fixedExpanded = 0;
+            found = search_lattice(map, start, goal, path, token, workspace,
+                                   index.get(), component, maxNodes - expanded,
+                                   fixed, fixedExpanded);
+            expanded += fixedExpanded;
+        }
+        if (expandedNodes != nullptr) {
+            *expandedNodes = expanded;
+        }
+        if (!found) {
             return false;
         }
+        smooth_path(map, path, start);
+        return true;
+    }
 
-        // parent is at this point unknown for the start node,
-        // so construct it as unknown
-        CoordNode endNode{*this, goal, start, 0 * Length::METER},
-                startNode{*this, start, start};
-        AStarSearch<CoordNode> search{endNode};
+    bool AStarPathFinder::search_lattice(ReadOnlyMap &map, Coordinate start,
+                                         Coordinate goal,
+                                         std::vector<Coordinate> &path,
+                                         const CancellationToken &token,
+                                         SearchWorkspace &workspace,
+                                         const ConnectivityIndex *connectivity,
+                                         int component, int maxNodes,
+                                         const SearchSettings &settings,
+                                         int &expandedNodes) const {
+        R2D2_TRACE_SCOPE(search, "search");
+        typedef SearchWorkspace::Key Key;
+        Translation step{robotBox *
+                         (settings.latticeScale / SQUARES_PER_ROBOT)};
+        const double weight = settings.heuristicWeight;
+        expandedNodes = 0;
+        auto get_coordinate = [&](Key key) {
+            return key == SearchWorkspace::START_KEY ? start :
+                   goal + Translation{
+                           SearchWorkspace::get_key_x(key) * step.get_x(),
+                           SearchWorkspace::get_key_y(key) * step.get_y(),
+                           0 * Length::METER};
+        };
 
-        std::shared_ptr<CoordNode> foundStart = search.search(startNode);
-        if (foundStart != nullptr) {
-            std::vector<CoordNode> foundPath{get_path(foundStart)};
-            path.clear();
-            for (CoordNode &node : foundPath) {
-                path.push_back(node.coord);
+        // on a lattice coarser than the robot, a start can lie between the
+        // nodes without overlapping one, so it is reached from the closest
+        // node and the ones around it, like ResumableSearch::find does
+        const bool coarse = settings.latticeScale / SQUARES_PER_ROBOT > 1;
+        Translation startOffset{start - goal};
+        const int startX = int(std::floor(
+                startOffset.get_x() / step.get_x() + .5)),
+                startY = int(std::floor(
+                        startOffset.get_y() / step.get_y() + .5));
+
+        BoxBatch batch{map};
+        workspace.reset();
+        Key goalKey = SearchWorkspace::make_key(0, 0);
+        workspace.insert(goalKey).g = 0;
+        workspace.push({weight * get_heuristic(start - goal) / Length::METER,
+                        0, goalKey});
+
+        // the amount of nodes left to search before the search is abandoned
+        int giveUpCount = maxNodes;
+        SearchWorkspace::OpenNode current;
+        while (--giveUpCount >= 0 && !token.is_cancelled() &&
+               workspace.pop(current)) {
+            // skip nodes that were reached cheaper after being opened
+            SearchWorkspace::Visited *visited = workspace.find(current.key);
+            if (current.g > visited->g || visited->closed) {
+                continue;
+            }
+            visited->closed = true;
+            R2D2_TRACE_CHUNK(search);
+            expandedNodes++;
+            Coordinate coord{get_coordinate(current.key)};
+            int x = SearchWorkspace::get_key_x(current.key),
+                    y = SearchWorkspace::get_key_y(current.key);
+            // the moves to the successors are checked in one batch, the
+            // boxes of neighbouring moves overlap
+            Key childKeys[9];
+            Coordinate childPositions[9];
+            int childCount = 0;
+            // whether none of the single steps is blocked
+            bool open = settings.maxStepScale > 1;
+            bool reachesStart = false;
+            batch.clear();
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    if (dx == 0 && dy == 0) {
+                        continue;
+                    }
+                    Key childKey = SearchWorkspace::make_key(x + dx, y + dy);
+                    // an expanded node already has its final cost, skip the
+                    // map query
+                    SearchWorkspace::Visited *known = workspace.find(childKey);
+                    if (known != nullptr && known->closed) {
+                        continue;
+                    }
+                    Coordinate childPos{get_coordinate(childKey)};
+                    //check whether the successor is the end node
+                    if (overlaps(childPos, start)) {
+                        childKey = SearchWorkspace::START_KEY;
+                        childPos = start;
+                        open = false;
+                        reachesStart = true;
+                    } else if (connectivity != nullptr &&
+                               connectivity->get_component(childPos) !=
+                               component) {
+                        // the node cannot be travelled to, skip the map query
+                        open = false;
+                        continue;
+                    }
+                    childKeys[childCount] = childKey;
+                    childPositions[childCount++] = childPos;
+                    batch.add(get_travel_box(coord, childPos));
+                }
+            }
+            if (coarse && !reachesStart && std::abs(x - startX) <= 1 &&
+                std::abs(y - startY) <= 1) {
+                childKeys[childCount] = SearchWorkspace::START_KEY;
+                childPositions[childCount++] = start;
+                batch.add(get_travel_box(coord, start));
+                open = false;
             }
+            batch.query();
+            for (int i = 0; open && i < childCount; i++) {
+                open = is_clear(batch.get_info(std::size_t(i)));
+            }
+            // when all single steps are free, the step doubles while the
+            // square its moves sweep is free and stays away from the start,
+            // which is reached with single steps
+            int scale = 1;
+            if (open) {
+                Translation toStart{start - coord};
+                Length distanceX{toStart.get_x() < 0 * Length::METER ?
+                                 0 * Length::METER - toStart.get_x() :
+                                 toStart.get_x()},
+                        distanceY{toStart.get_y() < 0 * Length::METER ?
+                                  0 * Length::METER - toStart.get_y() :
+                                  toStart.get_y()};
+                while (scale * 2 <= settings.maxStepScale) {
+                    Translation reach{
+                            step.get_x() * (scale * 2) + robotBox.get_x() / 2,
+                            step.get_y() * (scale * 2) + robotBox.get_y() / 2,
+                            robotBox.get_z() / 2};
+                    if ((distanceX < reach.get_x() + robotBox.get_x() / 2 &&
+                         distanceY < reach.get_y() + robotBox.get_y() / 2) ||
+                        !is_clear(map.get_box_info(
+                                Box{coord - reach, reach * 2}))) {
+                        break;
+                    }
+                    scale *= 2;
+                }
+            }
+            if (scale > 1) {
+                // the moves lie within the free square
+                childCount = 0;
+                for (int dx = -1; dx <= 1; dx++) {
+                    for (int dy = -1; dy <= 1; dy++) {
+                        if (dx != 0 || dy != 0) {
+                            childKeys[childCount] = SearchWorkspace::make_key(
+                                    x + dx * scale, y + dy * scale);
+                            childPositions[childCount] =
+                                    get_coordinate(childKeys[childCount]);
+                            childCount++;
+                        }
+                    }
+                }
+            }
+            for (int i = 0; i < childCount; i++) {
+                // the box is checked so that it can be ensured that there
+                // is no obstacle in the path
+                if (scale == 1 && !is_clear(batch.get_info(std::size_t(i)))) {
+                    continue;
+                }
+                Key childKey = childKeys[i];
+                const Coordinate &childPos = childPositions[i];
+                double g = current.g +
+                           get_heuristic(childPos - coord) / Length::METER;
+                SearchWorkspace::Visited &child = workspace.insert(childKey);
+                if (g < child.g) {
+                    child.g = g;
+                    child.parent = current.key;
+                    workspace.push({g + weight * get_heuristic(
+                            start - childPos) / Length::METER, g, childKey});
+                }
+                if (childKey == SearchWorkspace::START_KEY) {
+                    // the search was supposed to reach the start,
+                    // follow the parents back to the goal
+                    R2D2_TRACE_END(search);
+                    R2D2_TRACE_SCOPE(extract, "extract path");
+                    path.clear();
+                    for (Key key = child.parent;
+                         key != SearchWorkspace::NO_KEY;
+                         key = workspace.find(key)->parent) {
+                        path.push_back(get_coordinate(key));
+                    }
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
 
-            smooth_path(path, start);
+    PathRepair AStarPathFinder::repair_path(Coordinate start,
+                                            std::vector<Coordinate> &path,
+                                            int window, int maxRepairNodes) {
+        typedef std::chrono::steady_clock Clock;
+        PathRepair result{PathRepair::Status::VALID, -1, {}, {}, {}};
+        if (path.empty()) {
+            return result;
         }
+        window = std::max(window, 1);
+        Coordinate goal{path.back()};
+
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        auto get_point = [&](int i) {
+            return i < 0 ? start : path[i];
+        };
+
+        Clock::time_point time{Clock::now()};
+        int segment = 0;
+        while (segment < int(path.size())) {
+            // check the segments in order, stopping at the first blocked one.
+            // they are checked in batches, which grow while every segment in
+            // them is clear
+            {
+                R2D2_TRACE_SCOPE(validate, "validate path");
+                BoxBatch batch{map};
+                std::size_t batchSize = SMOOTH_BATCH;
+                bool blocked = false;
+                while (!blocked && segment < int(path.size())) {
+                    int first = segment,
+                            end = int(std::min(path.size(),
+                                               std::size_t(segment) +
+                                               batchSize));
+                    batch.clear();
+                    for (int i = first; i < end; i++) {
+                        batch.add(get_travel_box(get_point(i - 1), path[i]));
+                    }
+                    batch.query();
+                    batchSize *= 2;
+                    while (segment < end) {
+                        if (!is_clear(batch.get_info(
+                                std::size_t(segment - first)))) {
+                            blocked = true;
+                            break;
+                        }
+                        segment++;
+                    }
+                }
+            }
+            Clock::time_point validated{Clock::now()};
+            result.validationTime += validated - time;
+            time = validated;
+            if (segment == int(path.size())) {
+                break;
+            }
+            if (result.blockedSegment < 0) {
+                result.blockedSegment = segment;
+            }
 
-        return foundStart != nullptr;
+            // search around the blocked segment between the waypoints a
+            // window before and after it
+            int from = std::max(segment - window, -1),
+                    to = std::min(segment + window - 1, int(path.size()) - 1);
+            std::vector<Coordinate> detour;
+            bool repaired;
+            {
+                R2D2_TRACE_SCOPE(repair, "repair path");
+                repaired = !overlaps(get_point(from), path[to]) &&
+                           find_path(map, get_point(from), path[to], detour,
+                                     CancellationToken::never(),
+                                     maxRepairNodes);
+            }
+            Clock::time_point searched{Clock::now()};
+            result.repairTime += searched - time;
+            time = searched;
+            if (!repaired) {
+                // replace the whole path, the goal did not change
+                int expanded;
+                bool found = find_path_resumed(
+                        map, start, goal, detour, CancellationToken::never(),
+                        SearchSettings{collisionChecking}, expanded);
+                result.replanTime += Clock::now() - time;
+                if (!found) {
+                    result.status = PathRepair::Status::NOT_FOUND;
+                    return result;
+                }
+                path = std::move(detour);
+                result.status = PathRepair::Status::REPLANNED;
+                return result;
+            }
+            path.erase(path.begin() + (from + 1), path.begin() + (to + 1));
+            path.insert(path.begin() + (from + 1), detour.begin(), detour.end());
+            result.status = PathRepair::Status::REPAIRED;
+            // the detour was checked by the search
+            segment = from + 1 + int(detour.size());
+        }
+        return result;
     }
 
-    AStarPathFinder::CoordNode::CoordNode(
-            AStarPathFinder &pathFinder, Coordinate coord,
-            Coordinate &startCoord, Length g,
-            std::weak_ptr<CoordNode> parent) :
-            Node{g, AStarPathFinder::get_heuristic(startCoord - coord),
-                 parent},
-            pathFinder(pathFinder),
-            coord(coord),
-            startNodeCoord(startCoord) {
+    PathRepair AStarPathFinder::repair_path(Coordinate start,
+                                            CompactPath &path, int window,
+                                            int maxRepairNodes) {
+        std::vector<Coordinate> points;
+        path.decode(points);
+        PathRepair result{repair_path(start, points, window, maxRepairNodes)};
+        if (result.status != PathRepair::Status::VALID) {
+            path.assign(path.get_origin(), points, path.get_resolution());
+        }
+        return result;
     }
 
-    std::vector<AStarPathFinder::CoordNode>
-    AStarPathFinder::CoordNode::get_available_nodes(
-            std::shared_ptr<AStarPathFinder::CoordNode> &self) {
-        std::vector<CoordNode> children;
-        for (int x = -1; x <= 1; x++) {
-            for (int y = -1; y <= 1; y++) {
-                if (x != 0 || y != 0) {
-                    // the grid will be relative to the end position of the search
-                    Coordinate childPos{
-                            coord + (Translation{
-                                    x * pathFinder.get().robotBox.get_x(),
-                                    y * pathFinder.get().robotBox.get_y(),
-                                    0 * Length::METER
-                            } / SQUARES_PER_ROBOT)};
-                    //check whether the successor is the end node
-                    if (pathFinder.get().overlaps(childPos, startNodeCoord)) {
-                        childPos = {startNodeCoord.get()};
+    bool AStarPathFinder::get_path_to_goal(Coordinate start,
+                                           const GoalPredicate &isGoal,
+                                           std::vector<Coordinate> &path,
+                                           const CancellationToken &token) {
+        R2D2_TRACE_SCOPE(query, "get_path_to_goal");
+        if (token.is_cancelled()) {
+            return false;
+        }
+        R2D2_TRACE_SCOPE(acquire, "acquire map");
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        R2D2_TRACE_END(acquire);
+
+        if (!can_travel(map, start, start)) {
+            return false;
+        }
+        if (!search_uniform(map, start, isGoal, path, token,
+                            SearchWorkspace::get_thread_workspace())) {
+            return false;
+        }
+        if (!path.empty()) {
+            smooth_path(map, path, start);
+        }
+        return true;
+    }
+
+    bool AStarPathFinder::get_path_to_frontier(Coordinate start,
+                                               std::vector<Coordinate> &path,
+                                               const CancellationToken &token) {
+        return get_path_to_goal(start, get_frontier_predicate(), path, token);
+    }
+
+    AStarPathFinder::GoalPredicate AStarPathFinder::get_frontier_predicate() const {
+        Translation reach{robotBox / 2 + robotBox / SQUARES_PER_ROBOT};
+        return [reach](ReadOnlyMap &map, const Coordinate &position) {
+            return map.get_box_info(Box{position - reach, position + reach})
+                    .get_has_unknown();
+        };
+    }
+
+    bool AStarPathFinder::search_uniform(ReadOnlyMap &map, Coordinate start,
+                                         const GoalPredicate &isGoal,
+                                         std::vector<Coordinate> &path,
+                                         const CancellationToken &token,
+                                         SearchWorkspace &workspace) const {
+        R2D2_TRACE_SCOPE(search, "search");
+        typedef SearchWorkspace::Key Key;
+        Translation step{robotBox / SQUARES_PER_ROBOT};
+        auto get_coordinate = [&](Key key) {
+            return start + Translation{
+                    SearchWorkspace::get_key_x(key) * step.get_x(),
+                    SearchWorkspace::get_key_y(key) * step.get_y(),
+                    0 * Length::METER};
+        };
+
+        workspace.reset();
+        Key startKey = SearchWorkspace::make_key(0, 0);
+        workspace.insert(startKey).g = 0;
+        workspace.push({0, 0, startKey});
+
+        // the amount of nodes left to search before the search is abandoned
+        int giveUpCount = MAX_SEARCH_NODES;
+        SearchWorkspace::OpenNode current;
+        while (--giveUpCount >= 0 && !token.is_cancelled() &&
+               workspace.pop(current)) {
+            // skip nodes that were reached cheaper after being opened
+            if (current.g > workspace.find(current.key)->g) {
+                continue;
+            }
+            R2D2_TRACE_CHUNK(search);
+            Coordinate coord{get_coordinate(current.key)};
+            // the nodes are taken in order of cost, so the first goal is
+            // the closest one
+            if (isGoal(map, coord)) {
+                R2D2_TRACE_END(search);
+                R2D2_TRACE_SCOPE(extract, "extract path");
+                path.clear();
+                for (Key key = current.key; key != startKey;
+                     key = workspace.find(key)->parent) {
+                    path.push_back(get_coordinate(key));
+                }
+                std::reverse(path.begin(), path.end());
+                return true;
+            }
+            int x = SearchWorkspace::get_key_x(current.key),
+                    y = SearchWorkspace::get_key_y(current.key);
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    if (dx == 0 && dy == 0) {
+                        continue;
+                    }
+                    Key childKey = SearchWorkspace::make_key(x + dx, y + dy);
+                    Coordinate childPos{get_coordinate(childKey)};
+                    if (!can_travel(map, coord, childPos)) {
+                        continue;
                     }
-                    // can_travel is used so that it can be ensured that there is no
-                    // obstacle in the path
-                    if (pathFinder.get().can_travel(coord, childPos)) {
-                        children.push_back(
-                                CoordNode{pathFinder, childPos, startNodeCoord,
-                                          g + AStarPathFinder::get_heuristic(
-                                                  childPos - coord
-                                          ), // distance from the search begin
-                                          self});
+                    double g = current.g +
+                               get_heuristic(childPos - coord) / Length::METER;
+                    SearchWorkspace::Visited &child = workspace.insert(childKey);
+                    if (g < child.g) {
+                        child.g = g;
+                        child.parent = current.key;
+                        workspace.push({g, g, childKey});
                     }
                 }
             }
         }
-        return children;
+        return false;
+    }
+
+    std::shared_ptr<const ConnectivityIndex> AStarPathFinder::get_connectivity(
+            ReadOnlyMap &map) {
+        // the version of other maps cannot tell whether an index is current
+        if (!VersionedMap::is_versioned(map)) {
+            return nullptr;
+        }
+        uint64_t version = VersionedMap::get_version_of(map);
+        std::lock_guard<std::mutex> lock{connectivityMutex};
+        if (connectivity != nullptr &&
+            connectivity->get_map_version() == version) {
+            return connectivity;
+        }
+        if (!connectivityBuilding) {
+            // the previous thread has finished its work, so it is joined
+            // right away
+            if (connectivityThread.joinable()) {
+                connectivityThread.join();
+            }
+            connectivityBuilding = true;
+            connectivityThread = std::thread{
+                    &AStarPathFinder::build_connectivity, this};
+        }
+        return nullptr;
+    }
+
+    void AStarPathFinder::build_connectivity() {
+        R2D2_TRACE_SCOPE(build, "build connectivity index");
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        std::shared_ptr<const ConnectivityIndex> current;
+        {
+            std::lock_guard<std::mutex> lock{connectivityMutex};
+            current = connectivity;
+        }
+        std::shared_ptr<ConnectivityIndex> built;
+        if (current == nullptr) {
+            built = std::make_shared<ConnectivityIndex>(map, robotBox);
+        } else if (current->get_map_version() !=
+                   VersionedMap::get_version_of(map)) {
+            // which part of the map changed is not known, so every cell is
+            // checked, but only the chunks that change are copied
+            built = std::make_shared<ConnectivityIndex>(*current);
+            built->update(map, map.get_map_bounding_box());
+        }
+        R2D2_TRACE_END(build);
+        std::lock_guard<std::mutex> lock{connectivityMutex};
+        // an index loaded or updated meanwhile is kept
+        if (built != nullptr && connectivity == current) {
+            connectivity = built;
+        }
+        connectivityBuilding = false;
+        connectivityChanged.notify_all();
+    }
+
+    bool AStarPathFinder::is_connected(const ConnectivityIndex *index,
+                                       const Coordinate &start,
+                                       const Coordinate &goal,
+                                       int &component) {
+        component = 0;
+        if (index == nullptr) {
+            return true;
+        }
+        component = index->get_component(start);
+        return component >= 0 && component == index->get_component(goal);
+    }
+
+    void AStarPathFinder::update_connectivity(const Box &region) {
+        MapAccessGroup::Lease lease{mapAccess};
+        std::lock_guard<std::mutex> lock{connectivityMutex};
+        if (connectivity == nullptr) {
+            return;
+        }
+        // running queries might still use the old index, the copy shares
+        // the parts of it that the update does not change
+        std::shared_ptr<ConnectivityIndex> updated{
+                std::make_shared<ConnectivityIndex>(*connectivity)};
+        updated->update(lease.access(), region);
+        connectivity = updated;
+    }
+
+    void AStarPathFinder::wait_for_connectivity() {
+        std::unique_lock<std::mutex> lock{connectivityMutex};
+        connectivityChanged.wait(lock, [this]() {
+            return !connectivityBuilding;
+        });
+    }
+
+    void AStarPathFinder::save_precomputation(PrecomputationBundle &bundle) {
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        bool versioned = VersionedMap::is_versioned(map);
+        uint64_t version = VersionedMap::get_version_of(map);
+        std::shared_ptr<const ConnectivityIndex> index;
+        if (versioned) {
+            std::lock_guard<std::mutex> lock{connectivityMutex};
+            if (connectivity != nullptr &&
+                connectivity->get_map_version() == version) {
+                index = connectivity;
+            }
+        }
+        // the index is made here rather than in the background, which could
+        // have to wait for the lease of this call, and is kept for queries
+        if (index == nullptr) {
+            index = std::make_shared<ConnectivityIndex>(map, robotBox);
+            if (versioned) {
+                std::lock_guard<std::mutex> lock{connectivityMutex};
+                connectivity = index;
+            }
+        }
+        std::vector<uint8_t> data;
+        PrecomputationBundle::Writer out{data};
+        index->serialize(out);
+        // the index has cells of half a robot
+        bundle.add_section("connectivity", std::move(data), map,
+                           std::min(robotBox.get_x(), robotBox.get_y()) / 2);
     }
 
-    bool AStarPathFinder::CoordNode::operator==(
-            const AStarPathFinder::CoordNode &lhs) const {
-        return (coord - lhs.coord).get_length() / Length::METER == 0;
+    bool AStarPathFinder::load_precomputation(
+            const PrecomputationBundle &bundle) {
+        std::size_t size;
+        const uint8_t *data = bundle.get_section("connectivity", size);
+        if (data == nullptr) {
+            return false;
+        }
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        if (!VersionedMap::is_versioned(map) || !bundle.matches(map)) {
+            return false;
+        }
+        PrecomputationBundle::Reader in{data, size};
+        std::shared_ptr<const ConnectivityIndex> loaded{
+                std::make_shared<ConnectivityIndex>(
+                        in, VersionedMap::get_version_of(map))};
+        if ((loaded->get_robot_box() - robotBox).get_length() / Length::METER
+            != 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock{connectivityMutex};
+        connectivity = loaded;
+        return true;
+    }
+
+    bool AStarPathFinder::can_travel(ReadOnlyMap &map, const Coordinate &from,
+                                     const Coordinate &to) const {
+        R2D2_TRACE_BOX_QUERY(boxQuery);
+        return is_clear(map.get_box_info(get_travel_box(from, to)));
     }
 
-    bool AStarPathFinder::can_travel(const Coordinate &from,
-                                const Coordinate &to) {
+    Box AStarPathFinder::get_travel_box(const Coordinate &from,
+                                        const Coordinate &to) const {
         Coordinate minCoord{
                 (from.get_x() < to.get_x() ? from.get_x() : to.get_x()),
                 (from.get_y() < to.get_y() ? from.get_y() : to.get_y()),
@@ -161,12 +751,11 @@ namespace r2d2 {
                 (from.get_x() > to.get_x() ? from.get_x() : to.get_x()),
                 (from.get_y() > to.get_y() ? from.get_y() : to.get_y()),
                 0 * Length::METER} - minCoord) + robotBox};
-        BoxInfo info{mapAccessor.lock()->access().get_box_info(Box{minCoord - (robotBox / 2), size})};
-        return !(info.get_has_obstacle() || info.get_has_unknown());
+        return Box{minCoord - (robotBox / 2), size};
     }
 
     bool AStarPathFinder::overlaps(const Coordinate &c1,
-                              const Coordinate &c2) {
+                              const Coordinate &c2) const {
         Translation diff = c1 - c2;
         return (diff.get_x() < 0 * Length::METER ?
                 0 * Length::METER - diff.get_x() :
@@ -199,33 +788,318 @@ namespace r2d2 {
         return (shortDist * SQ_ROOT_2) + (longDist - shortDist);
     }
 
-    std::vector<AStarPathFinder::CoordNode> AStarPathFinder::get_path(
-            std::shared_ptr<AStarPathFinder::CoordNode> start) {
-        std::shared_ptr<CoordNode> curNode = start;
-        std::vector<CoordNode> path;
-        while (!curNode->parent.expired()) { // while next != nullptr
-            curNode = std::shared_ptr<CoordNode>(curNode->parent);
-            path.emplace_back(*curNode);
+    void AStarPathFinder::smooth_path(ReadOnlyMap &map,
+                                      std::vector<Coordinate> &path,
+                                      Coordinate start) const {
+        R2D2_TRACE_SCOPE(smooth, "smooth_path");
+        if (path.empty()) {
+            return;
+        }
+        BoxBatch batch{map};
+        Coordinate lastPos = start;
+        // path[current] is the last kept node, path[next] the first node
+        // that is not checked yet
+        std::size_t current = 0, next = 1, window = SMOOTH_BATCH;
+        while (next < path.size()) {
+            // the moves from the anchor node to the following nodes are
+            // checked in one batch per anchor. the batch grows while every
+            // move in it is clear, the moves after the first blocked one are
+            // not needed
+            std::size_t end = std::min(path.size(), next + window);
+            batch.clear();
+            for (std::size_t i = next; i < end; i++) {
+                batch.add(get_travel_box(lastPos, path[i]));
+            }
+            batch.query();
+            window *= 2;
+            for (std::size_t i = 0; next < end; i++) {
+                if (is_clear(batch.get_info(i))) {
+                    // remove the node(s) in between
+                    path[current] = path[next++];
+                } else {
+                    // make the node that cannot be reached the new anchor
+                    lastPos = path[next];
+                    path[++current] = path[next++];
+                    window = SMOOTH_BATCH;
+                    break;
+                }
+            }
         }
-        return path;
+        path.resize(current + 1);
     }
 
-    void AStarPathFinder::smooth_path(std::vector<Coordinate> &path,
-                                 Coordinate start) {
-        Coordinate lastPos = start;
-        auto it = path.begin();
-        auto current = it++;
-        while (it != path.end()) {
-            // check if the is a path from the current anchor node to the next
-            if (can_travel(lastPos, *it)) {
-                // if so, remove the node(s) in between
-                path.erase(current);
-            } else {
-                // if not, make the current node the new anchor node
-                lastPos = *it;
-                current = it++;
+
+    std::shared_ptr<const DistanceField> AStarPathFinder::get_distance_field(
+            Coordinate goal, int threadCount) {
+        MapAccessGroup::Lease lease{mapAccess};
+        uint64_t version = VersionedMap::get_version_of(lease.access());
+        {
+            std::lock_guard<std::mutex> lock{distanceFieldMutex};
+            // a field of another version can never be returned again,
+            // queries that still hold it keep it alive themselves
+            distanceFields.erase(std::remove_if(
+                    distanceFields.begin(), distanceFields.end(),
+                    [version](const std::shared_ptr<const DistanceField> &old) {
+                        return old->get_map_version() != version;
+                    }), distanceFields.end());
+            for (auto it = distanceFields.begin(); it != distanceFields.end();
+                 ++it) {
+                if (((*it)->get_goal() - goal).get_length() /
+                    Length::METER == 0) {
+                    // move the field to the back, as the most recently used
+                    std::shared_ptr<const DistanceField> field{*it};
+                    distanceFields.erase(it);
+                    distanceFields.push_back(field);
+                    return field;
+                }
+            }
+        }
+
+        // the field is computed without holding the mutex, so other goals
+        // can be served in the meantime
+        std::shared_ptr<const DistanceField> field{
+                compute_distance_field(lease.access(), goal, threadCount)};
+        if (field != nullptr) {
+            std::lock_guard<std::mutex> lock{distanceFieldMutex};
+            // replace the fields for this goal, which another query may
+            // have computed meanwhile, and the fields that are out of date
+            distanceFields.erase(std::remove_if(
+                    distanceFields.begin(), distanceFields.end(),
+                    [&goal, version](
+                            const std::shared_ptr<const DistanceField> &old) {
+                        return (old->get_goal() - goal).get_length() /
+                               Length::METER == 0 ||
+                               old->get_map_version() != version;
+                    }), distanceFields.end());
+            distanceFields.push_back(field);
+
+            // drop the least recently used fields until the others fit
+            std::size_t memory = 0;
+            for (const std::shared_ptr<const DistanceField> &cached :
+                    distanceFields) {
+                memory += cached->get_memory_usage();
+            }
+            while (distanceFields.size() > 1 &&
+                   (int(distanceFields.size()) > MAX_DISTANCE_FIELDS ||
+                    memory > DISTANCE_FIELD_MEMORY)) {
+                memory -= distanceFields.front()->get_memory_usage();
+                distanceFields.erase(distanceFields.begin());
             }
         }
+        return field;
+    }
+
+    bool AStarPathFinder::get_path_from_field(const DistanceField &field,
+                                              Coordinate start,
+                                              std::vector<Coordinate> &path) {
+        if (overlaps(start, field.get_goal())) {
+            path.clear();
+            return true;
+        }
+
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &currentMap = lease.access();
+        if (field.get_map_version() !=
+            VersionedMap::get_version_of(currentMap)) {
+            return false;
+        }
+
+        // the start coordinate generally lies in between lattice nodes,
+        // connect it to the surrounding node with the lowest total cost
+        Translation offset{start - field.get_goal()};
+        int centerX = int(std::floor(
+                offset.get_x() / field.get_step().get_x() + 0.5)),
+                centerY = int(std::floor(
+                offset.get_y() / field.get_step().get_y() + 0.5));
+        int x = 0, y = 0;
+        float best = std::numeric_limits<float>::infinity();
+        for (int nx = centerX - 1; nx <= centerX + 1; nx++) {
+            for (int ny = centerY - 1; ny <= centerY + 1; ny++) {
+                Coordinate node{field.get_coordinate(nx, ny)};
+                float total = field.get_cost(nx, ny) +
+                              float(get_heuristic(node - start) /
+                                    Length::METER);
+                if (total < best && can_travel(currentMap, start, node)) {
+                    best = total;
+                    x = nx;
+                    y = ny;
+                }
+            }
+        }
+        if (best == std::numeric_limits<float>::infinity()) {
+            return false;
+        }
+
+        path.clear();
+        for (;;) {
+            path.push_back(field.get_coordinate(x, y));
+            uint8_t direction = field.get_direction(x, y);
+            if (direction == DistanceField::NO_DIRECTION) {
+                break;
+            }
+            x += DistanceField::DIRECTION_X[direction];
+            y += DistanceField::DIRECTION_Y[direction];
+        }
+
+        smooth_path(currentMap, path, start);
+        return true;
+    }
+
+    std::shared_ptr<DistanceField> AStarPathFinder::compute_distance_field(
+            ReadOnlyMap &map, Coordinate goal, int threadCount) const {
+        const int *dirX = DistanceField::DIRECTION_X,
+                *dirY = DistanceField::DIRECTION_Y;
+        Translation step{robotBox / SQUARES_PER_ROBOT};
+        if (!(step.get_x() > 0 * Length::METER) ||
+            !(step.get_y() > 0 * Length::METER) ||
+            !can_travel(map, goal, goal)) {
+            return nullptr;
+        }
+
+        // span the lattice over the whole map, relative to the goal
+        Box bounds{map.get_map_bounding_box()};
+        Translation low{bounds.get_bottom_left() - goal},
+                high{bounds.get_top_right() - goal};
+        int minX = int(std::floor(low.get_x() / step.get_x())),
+                minY = int(std::floor(low.get_y() / step.get_y())),
+                maxX = int(std::ceil(high.get_x() / step.get_x())),
+                maxY = int(std::ceil(high.get_y() / step.get_y()));
+        minX = std::min(minX, 0);
+        minY = std::min(minY, 0);
+        maxX = std::max(maxX, 0);
+        maxY = std::max(maxY, 0);
+        std::shared_ptr<DistanceField> field{std::make_shared<DistanceField>(
+                goal, step, minX, minY, maxX - minX + 1, maxY - minY + 1,
+                VersionedMap::get_version_of(map))};
+        int width = field->width, height = field->height,
+                count = width * height;
+        std::size_t size = std::size_t(count);
+        int threads = get_thread_count(threadCount);
+
+        // every node has the same edge costs
+        float weight[8];
+        for (int d = 0; d < 8; d++) {
+            weight[d] = float(get_heuristic(Translation{
+                    dirX[d] * step.get_x(), dirY[d] * step.get_y(),
+                    0 * Length::METER}) / Length::METER);
+        }
+
+        // determine which edges can be travelled, this is where all the map
+        // queries happen. can_travel is symmetric, so only the first four
+        // directions are queried and the others are taken from the neighbours
+        std::vector<uint8_t> forward(size, 0);
+        parallel_for(threads, height, [&](int, int begin, int end) {
+            for (int y = begin; y < end; y++) {
+                for (int x = 0; x < width; x++) {
+                    Coordinate from{field->get_coordinate(minX + x, minY + y)};
+                    uint8_t bits = 0;
+                    for (int d = 0; d < 4; d++) {
+                        int nx = x + dirX[d], ny = y + dirY[d];
+                        if (nx >= 0 && nx < width && ny < height &&
+                            can_travel(map, from, field->get_coordinate(
+                                    minX + nx, minY + ny))) {
+                            bits |= uint8_t(1 << d);
+                        }
+                    }
+                    forward[y * width + x] = bits;
+                }
+            }
+        });
+        std::vector<uint8_t> moves(size, 0);
+        parallel_for(threads, height, [&](int, int begin, int end) {
+            for (int y = begin; y < end; y++) {
+                for (int x = 0; x < width; x++) {
+                    uint8_t bits = forward[y * width + x];
+                    for (int d = 4; d < 8; d++) {
+                        int nx = x + dirX[d], ny = y + dirY[d];
+                        if (nx >= 0 && ny >= 0 && nx < width &&
+                            (forward[ny * width + nx] & (1 << (d - 4)))) {
+                            bits |= uint8_t(1 << d);
+                        }
+                    }
+                    moves[y * width + x] = bits;
+                }
+            }
+        });
+        std::vector<uint8_t>().swap(forward);
+
+        // expand a wavefront from the goal. every round the nodes that got
+        // cheaper in the previous round relax their neighbours, until nothing
+        // changes anymore. the rounds are divided over the threads, so the
+        // costs are updated with an atomic minimum
+        std::vector<std::atomic<float>> cost(size);
+        std::vector<std::atomic<int>> queuedRound(size);
+        parallel_for(threads, count, [&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                cost[i].store(std::numeric_limits<float>::infinity(),
+                              std::memory_order_relaxed);
+                queuedRound[i].store(0, std::memory_order_relaxed);
+            }
+        });
+        int goalIndex = (0 - minY) * width + (0 - minX);
+        cost[goalIndex].store(0);
+
+        std::vector<int> frontier{goalIndex};
+        std::vector<std::vector<int>> next(static_cast<std::size_t>(threads));
+        for (int round = 1; !frontier.empty(); round++) {
+            parallel_for(threads, int(frontier.size()),
+                         [&](int worker, int begin, int end) {
+                std::vector<int> &out = next[worker];
+                for (int i = begin; i < end; i++) {
+                    int node = frontier[i];
+                    float nodeCost = cost[node].load(std::memory_order_relaxed);
+                    for (int d = 0; d < 8; d++) {
+                        if (!(moves[node] & (1 << d))) {
+                            continue;
+                        }
+                        int neighbour = node + dirY[d] * width + dirX[d];
+                        float newCost = nodeCost + weight[d];
+                        float old = cost[neighbour].load(
+                                std::memory_order_relaxed);
+                        while (newCost < old &&
+                               !cost[neighbour].compare_exchange_weak(
+                                       old, newCost,
+                                       std::memory_order_relaxed)) {
+                        }
+                        if (newCost < old &&
+                            queuedRound[neighbour].exchange(
+                                    round, std::memory_order_relaxed) !=
+                            round) {
+                            out.push_back(neighbour);
+                        }
+                    }
+                }
+            }, 256);
+            frontier.clear();
+            for (std::vector<int> &part : next) {
+                frontier.insert(frontier.end(), part.begin(), part.end());
+                part.clear();
+            }
+        }
+
+        // store the costs and point every node at its cheapest neighbour
+        parallel_for(threads, count, [&](int, int begin, int end) {
+            for (int i = begin; i < end; i++) {
+                float nodeCost = cost[i].load(std::memory_order_relaxed);
+                field->cost[i] = nodeCost;
+                if (i == goalIndex ||
+                    nodeCost == std::numeric_limits<float>::infinity()) {
+                    continue;
+                }
+                float best = std::numeric_limits<float>::infinity();
+                for (int d = 0; d < 8; d++) {
+                    if (moves[i] & (1 << d)) {
+                        float via = cost[i + dirY[d] * width + dirX[d]].load(
+                                std::memory_order_relaxed) + weight[d];
+                        if (via < best) {
+                            best = via;
+                            field->direction[i] = uint8_t(d);
+                        }
+                    }
+                }
+            }
+        }, 4096);
+        return field;
     }
 
-}
\ No newline at end of file
+}
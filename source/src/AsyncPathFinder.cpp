@@ -0,0 +1,107 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   AsyncPathFinder.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Asynchronous pathfinding queries
+//!
+//! Runs pathfinding queries on a pool of threads.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/AsyncPathFinder.hpp"
+
+namespace r2d2 {
+
+    AsyncPathFinder::AsyncPathFinder(AStarPathFinder &pathFinder,
+                                     int threadCount) :
+            pathFinder(pathFinder),
+            mutex{},
+            latest{},
+            pool{threadCount} {
+    }
+
+    AsyncPathFinder::~AsyncPathFinder() {
+        std::lock_guard<std::mutex> lock{mutex};
+        for (auto &entry : latest) {
+            entry.second.cancel();
+        }
+    }
+
+    PathQuery AsyncPathFinder::submit(int robotId, Coordinate start,
+                                      Coordinate goal) {
+        CancellationToken token;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            auto result = latest.emplace(robotId, token);
+            if (!result.second) {
+                // the robot changed its mind, the old answer is not needed
+                result.first->second.cancel();
+                result.first->second = token;
+            }
+        }
+        return run(start, goal, token);
+    }
+
+    PathQuery AsyncPathFinder::submit(Coordinate start, Coordinate goal) {
+        return run(start, goal, CancellationToken{});
+    }
+
+    PathQuery AsyncPathFinder::run(Coordinate start, Coordinate goal,
+                                   CancellationToken token) {
+        // std::function has to be copyable, so the promise is shared
+        std::shared_ptr<std::promise<PathResult>> promise{
+                std::make_shared<std::promise<PathResult>>()};
+        PathQuery query{promise->get_future().share(), token};
+        AStarPathFinder &finder = pathFinder;
+        pool.submit([promise, token, start, goal, &finder]() {
+            PathResult result{PathResult::Status::CANCELLED, {}};
+            if (!token.is_cancelled()) {
+                bool found = finder.get_path_to_coordinate(
+                        start, goal, result.path, token);
+                result.status = found ? PathResult::Status::FOUND :
+                                token.is_cancelled() ?
+                                PathResult::Status::CANCELLED :
+                                PathResult::Status::NOT_FOUND;
+            }
+            promise->set_value(std::move(result));
+        });
+        return query;
+    }
+
+}
@@ -0,0 +1,565 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   BoundedSearch.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Lattice search within a memory budget
+//!
+//! A* over the search lattice of a pathfinder that keeps all of its nodes
+//! in memory reserved up front, pruning the worst leaves when it runs out.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/AStarPathFinder.hpp"
+#include "../include/Tracing.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace r2d2 {
+
+    /**
+     * A* over the search lattice of a pathfinder with a fixed amount of nodes
+     *
+     * the nodes, the hash table that finds them, the open list and the
+     * scratch space for pruning grow by doubling, but never beyond what the
+     * memory budget allows. when no node is left, an eighth of the nodes
+     * without children in memory is pruned, the ones with the highest f
+     * first. pruned nodes are forgotten instead of being backed up into
+     * their parents like SMA* does, so a search that prunes degrades into a
+     * beam search that can find nodes again.
+     * the search ends when the start is expanded, not when it is reached.
+     * the lowest g + h of all pruned nodes is kept: every path that is
+     * cheaper must lead through a node that was pruned, or through a node
+     * that is still open, so when the path costs no more than that bound it
+     * is optimal on the lattice.
+     */
+    class AStarPathFinder::BoundedSearch {
+    public:
+        BoundedSearch(const AStarPathFinder &pathFinder, ReadOnlyMap &map,
+                      Coordinate start, Coordinate goal,
+                      const ConnectivityIndex *connectivity, int component,
+                      std::size_t memoryBudget);
+
+        /**
+         * run the search
+         *
+         * \param path receives the unsmoothed path without the start, ending
+         * at the goal
+         * \param token the token that is checked once per expanded node
+         * \param maxNodes the amount of nodes expanded before giving up
+         * \param info receives the statistics of the search
+         * \return whether a path was found
+         */
+        bool run(std::vector<Coordinate> &path, const CancellationToken &token,
+                 int maxNodes, BoundedSearchInfo &info);
+
+    private:
+        typedef SearchWorkspace::Key Key;
+        static const int32_t NONE = -1;
+
+        struct Node {
+            Key key;
+            double g, f;
+            // the parent node, the next free node for a free node
+            int32_t parent;
+            // the amount of nodes in memory that have this node as parent,
+            // -1 for a free node
+            int32_t children;
+            // the position in the open list, -1 when closed
+            int32_t heapIndex;
+        };
+
+        const AStarPathFinder &pathFinder;
+        ReadOnlyMap &map;
+        const Coordinate start, goal;
+        const Translation step;
+        //! nullptr when there is no current index
+        const ConnectivityIndex *connectivity;
+        const int component;
+
+        // the most slots of the table and the most nodes
+        std::size_t maxSlots, capacity;
+        std::vector<Node> nodes;
+        std::vector<int32_t> table, heap, candidates;
+        int32_t freeNodes;
+        std::size_t used, peakMemory;
+        double prunedBound;
+        int pruned;
+
+        Coordinate get_coordinate(Key key) const {
+            return key == SearchWorkspace::START_KEY ? start :
+                   goal + Translation{
+                           SearchWorkspace::get_key_x(key) * step.get_x(),
+                           SearchWorkspace::get_key_y(key) * step.get_y(),
+                           0 * Length::METER};
+        }
+
+        std::size_t get_slot(Key key) const {
+            uint64_t hash = uint64_t(key) * 0x9E3779B97F4A7C15ull;
+            return std::size_t(hash ^ (hash >> 32)) & (table.size() - 1);
+        }
+
+        static const std::size_t NODE_SIZE = sizeof(Node) + 2 * sizeof(int32_t);
+
+        /**
+         * get the memory the search holds
+         */
+        std::size_t get_memory() const;
+
+        /**
+         * update the peak memory
+         *
+         * \param released memory that is held as well, but about to be freed
+         */
+        void note_memory(std::size_t released) {
+            peakMemory = std::max(peakMemory, get_memory() + released);
+        }
+
+        /**
+         * double the table and the room for nodes, up to the budget
+         */
+        void grow();
+
+        int32_t find(Key key) const;
+
+        /**
+         * add a node, pruning other nodes when there is no room
+         *
+         * \param key the lattice position of the node
+         * \param keep a node that may not be pruned
+         * \return the node, or NONE if nothing could be pruned
+         */
+        int32_t add(Key key, int32_t keep);
+
+        void remove(int32_t node);
+
+        /**
+         * prune the worst leaves
+         *
+         * \param keep a node that may not be pruned
+         */
+        void prune(int32_t keep);
+
+        bool is_before(int32_t a, int32_t b) const {
+            // the lowest f goes first, and the highest g on ties
+            return nodes[a].f < nodes[b].f ||
+                   (nodes[a].f == nodes[b].f && nodes[a].g > nodes[b].g);
+        }
+
+        void heap_place(std::size_t index, int32_t node) {
+            heap[index] = node;
+            nodes[node].heapIndex = int32_t(index);
+        }
+
+        void sift_up(std::size_t index);
+
+        void sift_down(std::size_t index);
+
+        void heap_push(int32_t node);
+
+        int32_t heap_pop();
+
+        void heap_remove(int32_t node);
+    };
+
+    const int32_t AStarPathFinder::BoundedSearch::NONE;
+    const std::size_t AStarPathFinder::BoundedSearch::NODE_SIZE;
+
+    AStarPathFinder::BoundedSearch::BoundedSearch(
+            const AStarPathFinder &pathFinder, ReadOnlyMap &map,
+            Coordinate start, Coordinate goal,
+            const ConnectivityIndex *connectivity, int component,
+            std::size_t memoryBudget) :
+            pathFinder(pathFinder),
+            map(map),
+            start{start},
+            goal{goal},
+            step{pathFinder.robotBox / SQUARES_PER_ROBOT},
+            connectivity{connectivity},
+            component{component},
+            maxSlots{0},
+            capacity{0},
+            nodes{},
+            table{},
+            heap{},
+            candidates{},
+            freeNodes{NONE},
+            used{0},
+            peakMemory{0},
+            prunedBound{std::numeric_limits<double>::infinity()},
+            pruned{0} {
+        // a node takes its own memory, an entry in the open list and one in
+        // the pruning scratch space, and the table has at least twice as
+        // many slots as there are nodes. growing a structure copies it, so
+        // the structures may only take two thirds of the budget
+        std::size_t budget = memoryBudget > sizeof(*this) ?
+                             (memoryBudget - sizeof(*this)) / 3 * 2 : 0;
+        maxSlots = 1;
+        while ((maxSlots * 2) * sizeof(int32_t) + maxSlots * NODE_SIZE <=
+               budget && maxSlots < (std::size_t(1) << 30)) {
+            maxSlots *= 2;
+        }
+        capacity = std::min(maxSlots / 2,
+                            (budget - std::min(budget,
+                                               maxSlots * sizeof(int32_t))) /
+                            NODE_SIZE);
+        if (capacity < 16) {
+            capacity = 0;
+            return;
+        }
+        table.assign(std::min(maxSlots, std::size_t(1024)), NONE);
+        nodes.reserve(std::min(capacity, table.size() / 2));
+        heap.reserve(nodes.capacity());
+        note_memory(0);
+    }
+
+    std::size_t AStarPathFinder::BoundedSearch::get_memory() const {
+        return sizeof(*this) + table.capacity() * sizeof(int32_t) +
+               nodes.capacity() * sizeof(Node) +
+               (heap.capacity() + candidates.capacity()) * sizeof(int32_t);
+    }
+
+    void AStarPathFinder::BoundedSearch::grow() {
+        // the old table is kept until all nodes are in the new one
+        std::vector<int32_t> old{std::move(table)};
+        table.assign(std::min(old.size() * 2, maxSlots), NONE);
+        note_memory(old.capacity() * sizeof(int32_t));
+        for (std::size_t i = 0; i < nodes.size(); i++) {
+            if (nodes[i].children >= 0) {
+                std::size_t slot = get_slot(nodes[i].key);
+                while (table[slot] != NONE) {
+                    slot = (slot + 1) & (table.size() - 1);
+                }
+                table[slot] = int32_t(i);
+            }
+        }
+        old = std::vector<int32_t>{};
+
+        std::size_t limit = std::min(capacity, table.size() / 2),
+                oldSize = nodes.capacity() * sizeof(Node);
+        nodes.reserve(limit);
+        note_memory(oldSize);
+        oldSize = heap.capacity() * sizeof(int32_t);
+        heap.reserve(limit);
+        note_memory(oldSize);
+    }
+
+    int32_t AStarPathFinder::BoundedSearch::find(Key key) const {
+        for (std::size_t slot = get_slot(key);;
+             slot = (slot + 1) & (table.size() - 1)) {
+            if (table[slot] == NONE || nodes[table[slot]].key == key) {
+                return table[slot];
+            }
+        }
+    }
+
+    int32_t AStarPathFinder::BoundedSearch::add(Key key, int32_t keep) {
+        if (used == nodes.capacity() && used < capacity) {
+            grow();
+        }
+        if (used == capacity) {
+            prune(keep);
+            if (used == capacity) {
+                return NONE;
+            }
+        }
+        int32_t node;
+        if (freeNodes != NONE) {
+            node = freeNodes;
+            freeNodes = nodes[node].parent;
+        } else {
+            node = int32_t(nodes.size());
+            nodes.emplace_back();
+        }
+        nodes[node] = Node{key, std::numeric_limits<double>::infinity(),
+                           std::numeric_limits<double>::infinity(), NONE, 0,
+                           NONE};
+        std::size_t slot = get_slot(key);
+        while (table[slot] != NONE) {
+            slot = (slot + 1) & (table.size() - 1);
+        }
+        table[slot] = node;
+        used++;
+        return node;
+    }
+
+    void AStarPathFinder::BoundedSearch::remove(int32_t node) {
+        Node &removed = nodes[node];
+        if (removed.heapIndex != NONE) {
+            heap_remove(node);
+        }
+        if (removed.parent != NONE) {
+            nodes[removed.parent].children--;
+        }
+
+        // remove the node from the table, moving the nodes after it that
+        // would no longer be found into the gap
+        std::size_t mask = table.size() - 1, gap = get_slot(removed.key);
+        while (table[gap] != node) {
+            gap = (gap + 1) & mask;
+        }
+        table[gap] = NONE;
+        for (std::size_t slot = (gap + 1) & mask; table[slot] != NONE;
+             slot = (slot + 1) & mask) {
+            std::size_t home = get_slot(nodes[table[slot]].key);
+            // whether home lies cyclically in (gap, slot]
+            bool reachable = gap < slot ? home > gap && home <= slot :
+                             home > gap || home <= slot;
+            if (!reachable) {
+                table[gap] = table[slot];
+                table[slot] = NONE;
+                gap = slot;
+            }
+        }
+
+        removed.children = -1;
+        removed.parent = freeNodes;
+        freeNodes = node;
+        used--;
+    }
+
+    void AStarPathFinder::BoundedSearch::prune(int32_t keep) {
+        R2D2_TRACE_SCOPE(prune, "prune nodes");
+        if (candidates.capacity() < capacity) {
+            candidates.reserve(capacity);
+            note_memory(0);
+        }
+        candidates.clear();
+        for (std::size_t i = 0; i < nodes.size(); i++) {
+            // the root of the search and the parents of other nodes stay
+            if (nodes[i].children == 0 && nodes[i].parent != NONE &&
+                int32_t(i) != keep) {
+                candidates.push_back(int32_t(i));
+            }
+        }
+        std::size_t count = std::min(candidates.size(),
+                                     std::max(capacity / 8, std::size_t(1)));
+        auto worse = [this](int32_t a, int32_t b) {
+            return is_before(b, a);
+        };
+        std::nth_element(candidates.begin(), candidates.begin() + count,
+                         candidates.end(), worse);
+        // the parents of the pruned nodes only become leaves afterwards, so
+        // they are kept for a next round
+        for (std::size_t i = 0; i < count; i++) {
+            Node &node = nodes[candidates[i]];
+            prunedBound = std::min(
+                    prunedBound,
+                    node.g + get_heuristic(start - get_coordinate(node.key)) /
+                             Length::METER);
+            remove(candidates[i]);
+        }
+        pruned += int(count);
+    }
+
+    void AStarPathFinder::BoundedSearch::sift_up(std::size_t index) {
+        int32_t node = heap[index];
+        while (index > 0 && is_before(node, heap[(index - 1) / 2])) {
+            heap_place(index, heap[(index - 1) / 2]);
+            index = (index - 1) / 2;
+        }
+        heap_place(index, node);
+    }
+
+    void AStarPathFinder::BoundedSearch::sift_down(std::size_t index) {
+        int32_t node = heap[index];
+        for (;;) {
+            std::size_t child = index * 2 + 1;
+            if (child >= heap.size()) {
+                break;
+            }
+            if (child + 1 < heap.size() && is_before(heap[child + 1], heap[child])) {
+                child++;
+            }
+            if (!is_before(heap[child], node)) {
+                break;
+            }
+            heap_place(index, heap[child]);
+            index = child;
+        }
+        heap_place(index, node);
+    }
+
+    void AStarPathFinder::BoundedSearch::heap_push(int32_t node) {
+        heap.push_back(node);
+        sift_up(heap.size() - 1);
+    }
+
+    int32_t AStarPathFinder::BoundedSearch::heap_pop() {
+        int32_t node = heap.front();
+        heap_remove(node);
+        return node;
+    }
+
+    void AStarPathFinder::BoundedSearch::heap_remove(int32_t node) {
+        std::size_t index = std::size_t(nodes[node].heapIndex);
+        nodes[node].heapIndex = NONE;
+        int32_t last = heap.back();
+        heap.pop_back();
+        if (last != node) {
+            heap_place(index, last);
+            sift_up(index);
+            sift_down(std::size_t(nodes[last].heapIndex));
+        }
+    }
+
+    bool AStarPathFinder::BoundedSearch::run(std::vector<Coordinate> &path,
+                                             const CancellationToken &token,
+                                             int maxNodes,
+                                             BoundedSearchInfo &info) {
+        info = BoundedSearchInfo{false, 0, 0, 0};
+        if (capacity == 0) {
+            return false;
+        }
+        int32_t root = add(SearchWorkspace::make_key(0, 0), NONE);
+        nodes[root].g = 0;
+        nodes[root].f = get_heuristic(start - goal) / Length::METER;
+        heap_push(root);
+
+        bool found = false;
+        int giveUpCount = maxNodes;
+        while (!heap.empty() && --giveUpCount >= 0 && !token.is_cancelled()) {
+            int32_t current = heap_pop();
+            info.expandedNodes++;
+            Key key = nodes[current].key;
+            if (key == SearchWorkspace::START_KEY) {
+                // follow the parents back to the goal
+                path.clear();
+                for (int32_t node = nodes[current].parent; node != NONE;
+                     node = nodes[node].parent) {
+                    path.push_back(get_coordinate(nodes[node].key));
+                }
+                info.optimal = nodes[current].g <= prunedBound;
+                found = true;
+                break;
+            }
+            Coordinate coord{get_coordinate(key)};
+            int x = SearchWorkspace::get_key_x(key),
+                    y = SearchWorkspace::get_key_y(key);
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    if (dx == 0 && dy == 0) {
+                        continue;
+                    }
+                    Key childKey = SearchWorkspace::make_key(x + dx, y + dy);
+                    Coordinate childPos{get_coordinate(childKey)};
+                    if (pathFinder.overlaps(childPos, start)) {
+                        childKey = SearchWorkspace::START_KEY;
+                        childPos = start;
+                    } else if (connectivity != nullptr &&
+                               connectivity->get_component(childPos) !=
+                               component) {
+                        continue;
+                    }
+                    double g = nodes[current].g +
+                               get_heuristic(childPos - coord) / Length::METER;
+                    int32_t child = find(childKey);
+                    if (child != NONE && g >= nodes[child].g) {
+                        continue;
+                    }
+                    if (!pathFinder.can_travel(map, coord, childPos)) {
+                        continue;
+                    }
+                    double f = g + get_heuristic(start - childPos) /
+                                   Length::METER;
+                    if (child == NONE) {
+                        child = add(childKey, current);
+                        if (child == NONE) {
+                            // without room the child is dropped, which is
+                            // pruning it
+                            prunedBound = std::min(prunedBound, f);
+                            pruned++;
+                            continue;
+                        }
+                    } else if (nodes[child].parent != NONE) {
+                        nodes[nodes[child].parent].children--;
+                    }
+                    nodes[child].g = g;
+                    nodes[child].f = f;
+                    nodes[child].parent = current;
+                    nodes[current].children++;
+                    if (nodes[child].heapIndex == NONE) {
+                        heap_push(child);
+                    } else {
+                        sift_up(std::size_t(nodes[child].heapIndex));
+                    }
+                }
+            }
+        }
+        info.peakMemory = peakMemory;
+        info.prunedNodes = pruned;
+        return found;
+    }
+
+    bool AStarPathFinder::get_path_to_coordinate_bounded(
+            Coordinate start, Coordinate goal, std::vector<Coordinate> &path,
+            std::size_t memoryBudget, BoundedSearchInfo *info,
+            const CancellationToken &token) {
+        BoundedSearchInfo result{true, 0, 0, 0};
+        if (info != nullptr) {
+            *info = result;
+        }
+        if (overlaps(start, goal)) {
+            path.clear();
+            return true;
+        }
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        if (!can_travel(map, goal, goal)) {
+            return false;
+        }
+        std::shared_ptr<const ConnectivityIndex> index{get_connectivity(map)};
+        int component;
+        if (!is_connected(index.get(), start, goal, component)) {
+            return false;
+        }
+
+        BoundedSearch search{*this, map, start, goal, index.get(), component,
+                             memoryBudget};
+        bool found = search.run(path, token, MAX_SEARCH_NODES, result);
+        if (info != nullptr) {
+            *info = result;
+        }
+        if (!found) {
+            return false;
+        }
+        smooth_path(map, path, start);
+        return true;
+    }
+
+}
@@ -0,0 +1,164 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CoalescingPathFinder.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Coalescing pathfinder
+//!
+//! A pathfinder that answers equivalent queries that run at the same time
+//! with a single search.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/CoalescingPathFinder.hpp"
+#include "../include/VersionedMap.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace r2d2 {
+
+    CoalescingPathFinder::CoalescingPathFinder(SharedObject<ReadOnlyMap> &map,
+                                               Box robotBox,
+                                               PathFinder &pathFinder,
+                                               MapAccessGroup &mapAccess,
+                                               Length cellSize) :
+            PathFinder{map, robotBox},
+            pathFinder(pathFinder),
+            mapAccess(mapAccess),
+            cellSize{cellSize},
+            mutex{},
+            finished{},
+            flights{},
+            statistics{0, 0, 0, 0} {
+    }
+
+    std::size_t CoalescingPathFinder::KeyHash::operator()(
+            const Key &key) const {
+        // combines the fields like boost::hash_combine
+        std::size_t hash = 0;
+        for (uint64_t field : {uint64_t(key.startX), uint64_t(key.startY),
+                               uint64_t(key.goalX), uint64_t(key.goalY),
+                               key.version}) {
+            hash ^= std::hash<uint64_t>{}(field) + 0x9e3779b97f4a7c15ULL +
+                    (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+
+    int64_t CoalescingPathFinder::get_cell(Length position) const {
+        return int64_t(std::floor(position / cellSize));
+    }
+
+    bool CoalescingPathFinder::get_path_to_coordinate(
+            Coordinate start, Coordinate goal, std::vector<Coordinate> &path) {
+        uint64_t version;
+        {
+            // the lease is released before the search, which takes its own
+            MapAccessGroup::Lease lease{mapAccess};
+            version = VersionedMap::get_version_of(lease.access());
+        }
+        Key key{get_cell(start.get_x()), get_cell(start.get_y()),
+                get_cell(goal.get_x()), get_cell(goal.get_y()), version};
+
+        std::shared_ptr<Flight> flight;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            statistics.queries++;
+            auto it = flights.find(key);
+            if (it != flights.end()) {
+                flight = it->second;
+                flight->queries++;
+                statistics.coalesced++;
+                statistics.largestGroup = std::max(statistics.largestGroup,
+                                                   flight->queries);
+                finished.wait(lock, [&flight]() {
+                    return flight->finished;
+                });
+                path = flight->path;
+                return flight->found;
+            }
+            flight = std::make_shared<Flight>();
+            flight->queries = 1;
+            flight->finished = false;
+            flight->found = false;
+            flights.emplace(key, flight);
+            statistics.searches++;
+            statistics.largestGroup = std::max<uint64_t>(
+                    statistics.largestGroup, 1);
+        }
+
+        std::vector<Coordinate> result;
+        bool found = false;
+        try {
+            found = pathFinder.get_path_to_coordinate(start, goal, result);
+        } catch (...) {
+            // the waiting queries get no path rather than waiting forever
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                flights.erase(key);
+                flight->finished = true;
+            }
+            finished.notify_all();
+            throw;
+        }
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            flights.erase(key);
+            flight->found = found;
+            // only copied when a query waits for it
+            if (flight->queries > 1) {
+                flight->path = result;
+            }
+            flight->finished = true;
+        }
+        finished.notify_all();
+        path = std::move(result);
+        return found;
+    }
+
+    CoalescingStatistics CoalescingPathFinder::get_statistics() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        return statistics;
+    }
+
+    void CoalescingPathFinder::reset_statistics() {
+        std::lock_guard<std::mutex> lock{mutex};
+        statistics = CoalescingStatistics{0, 0, 0, 0};
+    }
+
+}
@@ -0,0 +1,249 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CompactPath.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Compact path
+//!
+//! A path stored as an origin and quantized deltas, which is decoded while it
+//! is iterated.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/CompactPath.hpp"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace r2d2 {
+
+    namespace {
+
+        const std::size_t RESOLUTION_OFFSET = 16, COUNT_OFFSET = 24;
+
+        void put_varint(std::vector<uint8_t> &out, int64_t value) {
+            // zigzag, so small negative values are short as well
+            uint64_t bits = (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+            while (bits >= 0x80) {
+                out.push_back(uint8_t(bits | 0x80));
+                bits >>= 7;
+            }
+            out.push_back(uint8_t(bits));
+        }
+
+        std::size_t get_varint_size(int64_t value) {
+            uint64_t bits = (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+            std::size_t size = 1;
+            while (bits >= 0x80) {
+                bits >>= 7;
+                size++;
+            }
+            return size;
+        }
+
+        int64_t get_varint(const uint8_t *&in) {
+            uint64_t bits = 0;
+            for (int shift = 0; ; shift += 7) {
+                uint8_t byte = *in++;
+                bits |= uint64_t(byte & 0x7f) << shift;
+                if (byte < 0x80) {
+                    break;
+                }
+            }
+            return int64_t(bits >> 1) ^ -int64_t(bits & 1);
+        }
+
+        template<typename T>
+        T get_value(const uint8_t *data) {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        template<typename T>
+        void put_value(std::vector<uint8_t> &out, const T &value) {
+            const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+    }
+
+    CompactPathView::Iterator::Iterator(const CompactPathView &view,
+                                        uint32_t index) :
+            next{view.bytes + HEADER_SIZE},
+            originX{get_value<double>(view.bytes)},
+            originY{get_value<double>(view.bytes + 8)},
+            resolution{get_value<double>(view.bytes + RESOLUTION_OFFSET)},
+            x{0},
+            y{0},
+            index{index},
+            count{view.count} {
+        if (index < count) {
+            read();
+        }
+    }
+
+    Coordinate CompactPathView::Iterator::operator*() const {
+        return Coordinate{(originX + double(x) * resolution) * Length::METER,
+                          (originY + double(y) * resolution) * Length::METER,
+                          0 * Length::METER};
+    }
+
+    CompactPathView::Iterator &CompactPathView::Iterator::operator++() {
+        if (++index < count) {
+            read();
+        }
+        return *this;
+    }
+
+    void CompactPathView::Iterator::read() {
+        x += get_varint(next);
+        y += get_varint(next);
+    }
+
+    CompactPathView::CompactPathView(const uint8_t *data, std::size_t size) :
+            bytes{data},
+            byteSize{size},
+            count{0} {
+        if (size < HEADER_SIZE) {
+            throw std::runtime_error("compact path too short");
+        }
+        double resolution = get_value<double>(data + RESOLUTION_OFFSET);
+        if (!(resolution > 0) || std::isinf(resolution)) {
+            throw std::runtime_error("invalid compact path resolution");
+        }
+        count = get_value<uint32_t>(data + COUNT_OFFSET);
+        // every varint must end within the data, the last one at its end
+        const uint8_t *in = data + HEADER_SIZE, *end = data + size;
+        for (uint64_t i = 0; i < 2 * uint64_t(count); i++) {
+            int length = 1;
+            while (in < end && *in >= 0x80) {
+                in++;
+                length++;
+            }
+            if (in == end || length > 10) {
+                throw std::runtime_error("compact path ends early");
+            }
+            in++;
+        }
+        if (in != end) {
+            throw std::runtime_error("compact path has trailing data");
+        }
+    }
+
+    CompactPathView CompactPathView::trust(const uint8_t *data,
+                                           std::size_t size) {
+        return CompactPathView{data, size,
+                               get_value<uint32_t>(data + COUNT_OFFSET)};
+    }
+
+    Coordinate CompactPathView::get_origin() const {
+        return Coordinate{get_value<double>(bytes) * Length::METER,
+                          get_value<double>(bytes + 8) * Length::METER,
+                          0 * Length::METER};
+    }
+
+    Length CompactPathView::get_resolution() const {
+        return get_value<double>(bytes + RESOLUTION_OFFSET) * Length::METER;
+    }
+
+    void CompactPathView::decode(std::vector<Coordinate> &path) const {
+        path.clear();
+        path.reserve(count);
+        for (Iterator it = begin(); it != end(); ++it) {
+            path.push_back(*it);
+        }
+    }
+
+    CompactPath::CompactPath() :
+            bytes{} {
+        assign(Coordinate{}, {});
+    }
+
+    CompactPath::CompactPath(Coordinate origin,
+                             const std::vector<Coordinate> &path,
+                             Length resolution) :
+            bytes{} {
+        assign(origin, path, resolution);
+    }
+
+    CompactPath::CompactPath(const CompactPathView &view) :
+            bytes{view.data(), view.data() + view.get_byte_size()} {
+    }
+
+    void CompactPath::assign(Coordinate origin,
+                             const std::vector<Coordinate> &path,
+                             Length resolution) {
+        double originX = origin.get_x() / Length::METER,
+                originY = origin.get_y() / Length::METER,
+                step = resolution / Length::METER;
+        if (!(step > 0) || std::isinf(step)) {
+            throw std::invalid_argument("invalid compact path resolution");
+        }
+        auto quantize = [&](const Coordinate &point, int64_t &x, int64_t &y) {
+            // rounded from the origin, so the errors do not add up
+            x = std::llround((point.get_x() / Length::METER - originX) / step);
+            y = std::llround((point.get_y() / Length::METER - originY) / step);
+        };
+        // the exact size is reserved, so a stored path wastes no capacity
+        std::size_t size = CompactPathView::HEADER_SIZE;
+        int64_t lastX = 0, lastY = 0, x, y;
+        for (const Coordinate &point : path) {
+            quantize(point, x, y);
+            size += get_varint_size(x - lastX) + get_varint_size(y - lastY);
+            lastX = x;
+            lastY = y;
+        }
+        bytes.clear();
+        bytes.reserve(size);
+        put_value(bytes, originX);
+        put_value(bytes, originY);
+        put_value(bytes, step);
+        put_value(bytes, uint32_t(path.size()));
+        lastX = 0;
+        lastY = 0;
+        for (const Coordinate &point : path) {
+            quantize(point, x, y);
+            put_varint(bytes, x - lastX);
+            put_varint(bytes, y - lastY);
+            lastX = x;
+            lastY = y;
+        }
+    }
+
+}
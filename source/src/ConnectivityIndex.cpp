@@ -0,0 +1,427 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ConnectivityIndex.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Connected components of the free space
+//!
+//! Labels the positions the robot can possibly be on with connected components,
+//! so queries between different components can be rejected without a search.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/ConnectivityIndex.hpp"
+#include "../include/VersionedMap.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace r2d2 {
+
+    const int32_t ConnectivityIndex::BLOCKED, ConnectivityIndex::UNLABELLED;
+    const int ConnectivityIndex::CHUNK_BITS;
+
+    ConnectivityIndex::ConnectivityIndex(ReadOnlyMap &map,
+                                         Translation robotBox) :
+            robotBox(robotBox),
+            cellSize{robotBox / 2},
+            origin{},
+            width{0},
+            height{0},
+            chunks{},
+            components{},
+            unused{},
+            mapVersion{VersionedMap::get_version_of(map)} {
+        if (!(cellSize.get_x() > 0 * Length::METER) ||
+            !(cellSize.get_y() > 0 * Length::METER)) {
+            return;
+        }
+        Box bounds{map.get_map_bounding_box()};
+        Translation margin{get_margin()};
+        Translation size{bounds.get_axis_size() + margin * 2};
+        origin = bounds.get_bottom_left() - margin;
+        width = int(std::ceil(size.get_x() / cellSize.get_x()));
+        height = int(std::ceil(size.get_y() / cellSize.get_y()));
+
+        allocate_chunks();
+        std::vector<int> seeds;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int i = y * width + x;
+                if (!is_blocked(map, x, y)) {
+                    set_label(i, UNLABELLED);
+                    seeds.push_back(i);
+                }
+            }
+        }
+        label(seeds);
+    }
+
+    ConnectivityIndex::ConnectivityIndex(PrecomputationBundle::Reader &in,
+                                         uint64_t mapVersion) :
+            robotBox{},
+            cellSize{},
+            origin{},
+            width{0},
+            height{0},
+            chunks{},
+            components{},
+            unused{},
+            mapVersion{mapVersion} {
+        Length robotX{in.get_length()}, robotY{in.get_length()};
+        robotBox = Translation{robotX, robotY, 0 * Length::METER};
+        cellSize = robotBox / 2;
+        Length originX{in.get_length()}, originY{in.get_length()};
+        origin = Coordinate{originX, originY, 0 * Length::METER};
+        width = in.get<int32_t>();
+        height = in.get<int32_t>();
+        std::vector<int32_t> labels;
+        in.get_vector(labels);
+        in.get_vector(components);
+        in.get_vector(unused);
+
+        // the labels index the components, so they are checked before use
+        if (width < 0 || height < 0 ||
+            labels.size() != std::size_t(width) * std::size_t(height)) {
+            throw std::runtime_error("connectivity index has a wrong size");
+        }
+        for (int32_t label : labels) {
+            if (label < BLOCKED || label >= int32_t(components.size())) {
+                throw std::runtime_error("connectivity index is corrupt");
+            }
+        }
+        for (int32_t label : unused) {
+            if (label < 0 || label >= int32_t(components.size())) {
+                throw std::runtime_error("connectivity index is corrupt");
+            }
+        }
+        allocate_chunks();
+        for (std::size_t i = 0; i < labels.size(); i++) {
+            set_label(int(i), labels[i]);
+        }
+    }
+
+    void ConnectivityIndex::serialize(PrecomputationBundle::Writer &out) const {
+        out.put_length(robotBox.get_x());
+        out.put_length(robotBox.get_y());
+        out.put_length(origin.get_x());
+        out.put_length(origin.get_y());
+        out.put(int32_t(width));
+        out.put(int32_t(height));
+        std::vector<int32_t> labels(std::size_t(width) * std::size_t(height));
+        for (std::size_t i = 0; i < labels.size(); i++) {
+            labels[i] = get_label(int(i));
+        }
+        out.put_vector(labels);
+        out.put_vector(components);
+        out.put_vector(unused);
+    }
+
+    void ConnectivityIndex::set_label(int cell, int32_t label) {
+        std::shared_ptr<std::vector<int32_t>> &chunk =
+                chunks[std::size_t(cell >> CHUNK_BITS)];
+        // only this index can take new references to its chunks, so a count
+        // of one cannot go up while the chunk is written
+        if (chunk.use_count() > 1) {
+            chunk = std::make_shared<std::vector<int32_t>>(*chunk);
+        }
+        (*chunk)[std::size_t(cell & ((1 << CHUNK_BITS) - 1))] = label;
+    }
+
+    void ConnectivityIndex::allocate_chunks() {
+        std::size_t cells = std::size_t(width) * std::size_t(height),
+                chunkSize = std::size_t(1) << CHUNK_BITS;
+        chunks.resize((cells + chunkSize - 1) / chunkSize);
+        for (std::shared_ptr<std::vector<int32_t>> &chunk : chunks) {
+            chunk = std::make_shared<std::vector<int32_t>>(chunkSize, BLOCKED);
+        }
+    }
+
+    void ConnectivityIndex::grow(ReadOnlyMap &map) {
+        Box bounds{map.get_map_bounding_box()};
+        Translation margin{get_margin()};
+        Translation low{origin - (bounds.get_bottom_left() - margin)},
+                high{bounds.get_top_right() + margin - origin};
+        // whole cells are added, so the existing cells keep their place
+        int left = std::max(int(std::ceil(low.get_x() / cellSize.get_x())), 0),
+                bottom = std::max(
+                int(std::ceil(low.get_y() / cellSize.get_y())), 0),
+                right = std::max(int(std::ceil(
+                high.get_x() / cellSize.get_x())) - width, 0),
+                top = std::max(int(std::ceil(
+                high.get_y() / cellSize.get_y())) - height, 0);
+        if (left == 0 && bottom == 0 && right == 0 && top == 0) {
+            return;
+        }
+
+        std::vector<std::shared_ptr<std::vector<int32_t>>> old;
+        old.swap(chunks);
+        int oldWidth = width, oldHeight = height;
+        origin = origin - Translation{left * cellSize.get_x(),
+                                      bottom * cellSize.get_y(),
+                                      0 * Length::METER};
+        width += left + right;
+        height += bottom + top;
+        allocate_chunks();
+        for (int y = 0; y < oldHeight; y++) {
+            for (int x = 0; x < oldWidth; x++) {
+                int cell = y * oldWidth + x;
+                set_label((y + bottom) * width + x + left,
+                          (*old[std::size_t(cell >> CHUNK_BITS)])[std::size_t(
+                                  cell & ((1 << CHUNK_BITS) - 1))]);
+            }
+        }
+        for (Component &component : components) {
+            if (component.cells > 0) {
+                component.minX += left;
+                component.maxX += left;
+                component.minY += bottom;
+                component.maxY += bottom;
+            }
+        }
+
+        std::vector<int> seeds;
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                bool added = x < left || x >= left + oldWidth ||
+                             y < bottom || y >= bottom + oldHeight;
+                if (added && !is_blocked(map, x, y)) {
+                    set_label(y * width + x, UNLABELLED);
+                    seeds.push_back(y * width + x);
+                }
+            }
+        }
+        label(seeds);
+    }
+
+    bool ConnectivityIndex::is_blocked(ReadOnlyMap &map, int x, int y) const {
+        Coordinate center{origin + Translation{
+                (x + .5) * cellSize.get_x(), (y + .5) * cellSize.get_y(),
+                0 * Length::METER}};
+        // the area that the robot covers on every position in the cell,
+        // shrunk a little so rounding can never block a cell that a robot
+        // position in it would find clear
+        Translation shared{(robotBox / 2 - cellSize / 2) * .999};
+        BoxInfo info{map.get_box_info(Box{center - shared, center + shared})};
+        return info.get_has_obstacle() || info.get_has_unknown();
+    }
+
+    int ConnectivityIndex::create_component() {
+        int component;
+        if (unused.empty()) {
+            component = int(components.size());
+            components.emplace_back();
+        } else {
+            component = unused.back();
+            unused.pop_back();
+        }
+        components[component] = Component{INT_MAX, INT_MAX, INT_MIN, INT_MIN, 0};
+        return component;
+    }
+
+    void ConnectivityIndex::label(const std::vector<int> &seeds) {
+        std::vector<int> cells, touched;
+        for (int seed : seeds) {
+            if (get_label(seed) != UNLABELLED) {
+                continue;
+            }
+            int component = create_component();
+            set_label(seed, component);
+            cells.assign(1, seed);
+            touched.clear();
+            Component bounds{INT_MAX, INT_MAX, INT_MIN, INT_MIN, 0};
+            // the cells vector doubles as the queue of the flood fill
+            for (std::size_t next = 0; next < cells.size(); next++) {
+                int x = cells[next] % width, y = cells[next] / width;
+                bounds.minX = std::min(bounds.minX, x);
+                bounds.minY = std::min(bounds.minY, y);
+                bounds.maxX = std::max(bounds.maxX, x);
+                bounds.maxY = std::max(bounds.maxY, y);
+                for (int ny = std::max(y - 1, 0);
+                     ny <= std::min(y + 1, height - 1); ny++) {
+                    for (int nx = std::max(x - 1, 0);
+                         nx <= std::min(x + 1, width - 1); nx++) {
+                        int32_t neighbour = get_label(ny * width + nx);
+                        if (neighbour == UNLABELLED) {
+                            set_label(ny * width + nx, component);
+                            cells.push_back(ny * width + nx);
+                        } else if (neighbour >= 0 && neighbour != component &&
+                                   std::find(touched.begin(), touched.end(),
+                                             neighbour) == touched.end()) {
+                            touched.push_back(neighbour);
+                        }
+                    }
+                }
+            }
+            bounds.cells = int(cells.size());
+            components[component] = bounds;
+
+            // the new cells connect the components they touch, which are
+            // merged into the largest one
+            int largest = component;
+            for (int other : touched) {
+                if (components[other].cells > components[largest].cells) {
+                    largest = other;
+                }
+            }
+            if (largest != component) {
+                merge(component, largest, &cells);
+            }
+            for (int other : touched) {
+                if (other != largest) {
+                    merge(other, largest, nullptr);
+                }
+            }
+        }
+    }
+
+    void ConnectivityIndex::merge(int from, int into,
+                                  const std::vector<int> *cells) {
+        Component &source = components[from], &target = components[into];
+        if (cells != nullptr) {
+            for (int cell : *cells) {
+                set_label(cell, into);
+            }
+        } else {
+            for (int y = source.minY; y <= source.maxY; y++) {
+                for (int x = source.minX; x <= source.maxX; x++) {
+                    if (get_label(y * width + x) == from) {
+                        set_label(y * width + x, into);
+                    }
+                }
+            }
+        }
+        target.minX = std::min(target.minX, source.minX);
+        target.minY = std::min(target.minY, source.minY);
+        target.maxX = std::max(target.maxX, source.maxX);
+        target.maxY = std::max(target.maxY, source.maxY);
+        target.cells += source.cells;
+        source.cells = 0;
+        unused.push_back(from);
+    }
+
+    void ConnectivityIndex::update(ReadOnlyMap &map, const Box &region) {
+        mapVersion = VersionedMap::get_version_of(map);
+        if (chunks.empty()) {
+            return;
+        }
+        grow(map);
+        // the cells of which the shared area can overlap the region
+        Translation shared{robotBox / 2 - cellSize / 2};
+        int minX = std::max(int(std::floor((region.get_bottom_left().get_x() - shared.get_x() - origin.get_x()) / cellSize.get_x())) - 1, 0),
+                minY = std::max(int(std::floor((region.get_bottom_left().get_y() - shared.get_y() - origin.get_y()) / cellSize.get_y())) - 1, 0),
+                maxX = std::min(int(std::floor((region.get_top_right().get_x() + shared.get_x() - origin.get_x()) / cellSize.get_x())) + 1, width - 1),
+                maxY = std::min(int(std::floor((region.get_top_right().get_y() + shared.get_y() - origin.get_y()) / cellSize.get_y())) + 1, height - 1);
+
+        std::vector<int> seeds, split;
+        for (int y = minY; y <= maxY; y++) {
+            for (int x = minX; x <= maxX; x++) {
+                int cell = y * width + x;
+                int32_t label = get_label(cell);
+                bool blocked = is_blocked(map, x, y);
+                if (blocked && label != BLOCKED) {
+                    split.push_back(label);
+                    set_label(cell, BLOCKED);
+                } else if (!blocked && label == BLOCKED) {
+                    set_label(cell, UNLABELLED);
+                    seeds.push_back(cell);
+                }
+            }
+        }
+
+        // a component that lost a cell might have been split, so its cells
+        // are labelled again
+        std::sort(split.begin(), split.end());
+        split.erase(std::unique(split.begin(), split.end()), split.end());
+        for (int component : split) {
+            Component &bounds = components[component];
+            for (int y = bounds.minY; y <= bounds.maxY; y++) {
+                for (int x = bounds.minX; x <= bounds.maxX; x++) {
+                    if (get_label(y * width + x) == component) {
+                        set_label(y * width + x, UNLABELLED);
+                        seeds.push_back(y * width + x);
+                    }
+                }
+            }
+            bounds.cells = 0;
+            unused.push_back(component);
+        }
+        label(seeds);
+    }
+
+    int ConnectivityIndex::get_component(const Coordinate &coord) const {
+        if (chunks.empty()) {
+            return -1;
+        }
+        double x = std::floor((coord.get_x() - origin.get_x()) / cellSize.get_x()),
+                y = std::floor((coord.get_y() - origin.get_y()) / cellSize.get_y());
+        if (!(x >= 0 && y >= 0 && x < width && y < height)) {
+            return -1;
+        }
+        int32_t cell = get_label(int(y) * width + int(x));
+        return cell >= 0 ? cell : -1;
+    }
+
+    Box ConnectivityIndex::get_component_bounds(int component) const {
+        const Component &bounds = components[component];
+        return {origin + Translation{bounds.minX * cellSize.get_x(),
+                                     bounds.minY * cellSize.get_y(),
+                                     0 * Length::METER},
+                origin + Translation{(bounds.maxX + 1) * cellSize.get_x(),
+                                     (bounds.maxY + 1) * cellSize.get_y(),
+                                     0 * Length::METER}};
+    }
+
+    int ConnectivityIndex::get_component_count() const {
+        return int(std::count_if(components.begin(), components.end(),
+                                 [](const Component &component) {
+                                     return component.cells > 0;
+                                 }));
+    }
+
+    std::size_t ConnectivityIndex::get_memory_usage() const {
+        std::size_t labels = 0;
+        for (const std::shared_ptr<std::vector<int32_t>> &chunk : chunks) {
+            labels += chunk->capacity();
+        }
+        return sizeof(*this) + labels * sizeof(int32_t) +
+               components.capacity() * sizeof(Component) +
+               unused.capacity() * sizeof(int32_t);
+    }
+
+}
@@ -0,0 +1,340 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CooperativePlanner.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Cooperative fleet planner
+//!
+//! Plans the paths of a fleet of robots together, so that they do not collide
+//! with each other (windowed hierarchical cooperative A*).
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/CooperativePlanner.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace r2d2 {
+
+    void CooperativePlanner::Reservations::clear() {
+        vertices.clear();
+        edges.clear();
+    }
+
+    void CooperativePlanner::Reservations::reserve(
+            const std::vector<Cell> &cells, int time) {
+        for (std::size_t i = 0; i < cells.size(); i++) {
+            vertices.insert(get_key(cells[i], time + int(i)));
+            if (i > 0 && !(cells[i - 1] == cells[i])) {
+                edges.insert(get_key(cells[i - 1], cells[i],
+                                     time + int(i) - 1));
+            }
+        }
+    }
+
+    bool CooperativePlanner::Reservations::can_move(Cell from, Cell to,
+                                                    int time) const {
+        if (is_reserved(to, time + 1)) {
+            return false;
+        }
+        if (from == to) {
+            return true;
+        }
+        // a robot in the cell ahead has to leave it the same way, a robot
+        // entering the cell behind has to come the same way
+        Cell ahead{2 * to.x - from.x, 2 * to.y - from.y},
+                behind{2 * from.x - to.x, 2 * from.y - to.y};
+        return !is_moving(to, from, time) &&
+               (!is_reserved(to, time) || is_moving(to, ahead, time)) &&
+               (!is_reserved(from, time + 1) ||
+                is_moving(behind, from, time));
+    }
+
+    uint64_t CooperativePlanner::Reservations::get_key(Cell cell, int time) {
+        return (uint64_t(uint32_t(cell.x) & 0xFFFFF) << 40) |
+               (uint64_t(uint32_t(cell.y) & 0xFFFFF) << 20) |
+               uint64_t(uint32_t(time) & 0xFFFFF);
+    }
+
+    uint64_t CooperativePlanner::Reservations::get_key(Cell from, Cell to,
+                                                       int time) {
+        int direction = to.x > from.x ? 0 : to.x < from.x ? 1 :
+                                            to.y > from.y ? 2 : 3;
+        return get_key(from, time) * 4 + uint64_t(direction);
+    }
+
+    CooperativePlanner::TimedNode::TimedNode(WindowSearch &search, Cell cell,
+                                             int time, Length g,
+                                             std::weak_ptr<TimedNode> parent) :
+            Node{g, double(search.field.get_cost(cell.x - search.goal.x,
+                                                 cell.y - search.goal.y)) *
+                    Length::METER, parent},
+            search(search),
+            cell(cell),
+            time{time},
+            windowEnd{false} {
+    }
+
+    CooperativePlanner::TimedNode CooperativePlanner::TimedNode::make_window_end(
+            WindowSearch &search) {
+        TimedNode end{search, search.goal, search.endTime, 0 * Length::METER};
+        end.windowEnd = true;
+        return end;
+    }
+
+    bool CooperativePlanner::TimedNode::operator==(const TimedNode &rhs) const {
+        if (rhs.windowEnd || windowEnd) {
+            return time == rhs.time;
+        }
+        return cell == rhs.cell && time == rhs.time;
+    }
+
+    std::vector<CooperativePlanner::TimedNode>
+    CooperativePlanner::TimedNode::get_available_nodes(
+            std::shared_ptr<TimedNode> &self) {
+        static const int moveX[5] = {0, 1, -1, 0, 0},
+                moveY[5] = {0, 0, 0, 1, -1};
+        WindowSearch &window = search.get();
+        std::vector<TimedNode> children;
+        for (int i = 0; i < 5; i++) {
+            Cell next{cell.x + moveX[i], cell.y + moveY[i]};
+            if (std::isinf(window.field.get_cost(next.x - window.goal.x,
+                                                 next.y - window.goal.y)) ||
+                !window.reservations.can_move(cell, next, time)) {
+                continue;
+            }
+            // waiting costs time like a move, except at the goal
+            Length cost{i == 0 ? (cell == window.goal ? 0 * Length::METER :
+                                  std::min(window.stepX, window.stepY)) :
+                        moveX[i] != 0 ? window.stepX : window.stepY};
+            children.push_back(TimedNode{window, next, time + 1, g + cost,
+                                         self});
+        }
+        // the search ends at the first node at the end of the window it
+        // opens, which should be the cheapest one
+        std::stable_sort(children.begin(), children.end(),
+                         [](const TimedNode &a, const TimedNode &b) {
+                             return a.f < b.f;
+                         });
+        return children;
+    }
+
+    CooperativePlanner::CooperativePlanner(SharedObject<ReadOnlyMap> &map,
+                                           Box robotBox, int window,
+                                           int threadCount) :
+            pathFinder{map, robotBox},
+            robotBox{robotBox.get_axis_size()},
+            window{std::max(2, window)},
+            threadCount{threadCount} {
+    }
+
+    bool CooperativePlanner::search_window(const DistanceField &field,
+                                           Cell goal, Cell start, int time,
+                                           const Reservations &reservations,
+                                           std::vector<Cell> &cells) const {
+        Translation step{field.get_step()};
+        WindowSearch search{field, goal, time + window, reservations,
+                            step.get_x(), step.get_y()};
+        TimedNode root{search, start, time, 0 * Length::METER},
+                end{TimedNode::make_window_end(search)};
+        AStarSearch<TimedNode> astar{root};
+        std::shared_ptr<TimedNode> found = astar.search(end);
+        if (found == nullptr) {
+            return false;
+        }
+        cells.assign(std::size_t(window) + 1, start);
+        for (std::shared_ptr<TimedNode> node = found;;
+             node = std::shared_ptr<TimedNode>(node->parent)) {
+            cells[std::size_t(node->time - time)] = node->cell;
+            if (node->parent.expired()) {
+                break;
+            }
+        }
+        return true;
+    }
+
+    bool CooperativePlanner::plan(const std::vector<RobotTask> &tasks,
+                                  FleetPlan &plan, int maxSteps) {
+        std::size_t count = tasks.size();
+        plan.paths.assign(count, {});
+        plan.arrived.assign(count, false);
+        plan.searches = 0;
+        plan.restarts = 0;
+
+        // the grid is the lattice of the distance fields, anchored at the
+        // center of the bottom left cell of the map
+        Translation step{robotBox / SQUARES_PER_ROBOT};
+        Coordinate anchor;
+        {
+            MapAccessGroup::Lease lease{pathFinder.get_map_access()};
+            anchor = lease.access().get_map_bounding_box().get_bottom_left() +
+                     step / 2;
+        }
+        auto get_cell = [&](Coordinate position) {
+            Translation offset{position - anchor};
+            return Cell{int(std::floor(offset.get_x() / step.get_x() + .5)),
+                        int(std::floor(offset.get_y() / step.get_y() + .5))};
+        };
+        auto get_coordinate = [&](Cell cell) {
+            return anchor + Translation{cell.x * step.get_x(),
+                                        cell.y * step.get_y(),
+                                        0 * Length::METER};
+        };
+
+        std::vector<Cell> positions, goals;
+        for (const RobotTask &task : tasks) {
+            positions.push_back(get_cell(task.start));
+            goals.push_back(get_cell(task.goal));
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            for (std::size_t j = i + 1; j < count; j++) {
+                if (positions[i] == positions[j] || goals[i] == goals[j]) {
+                    return false;
+                }
+            }
+        }
+
+        // the fields are fetched before a lease is held, as they take their
+        // own. a robot that cannot reach its goal gets none
+        std::vector<std::shared_ptr<const DistanceField>> fields(count);
+        std::vector<std::size_t> order;
+        for (std::size_t i = 0; i < count; i++) {
+            fields[i] = pathFinder.get_distance_field(
+                    get_coordinate(goals[i]), threadCount);
+            if (fields[i] != nullptr &&
+                std::isinf(fields[i]->get_cost(positions[i].x - goals[i].x,
+                                               positions[i].y - goals[i].y))) {
+                fields[i] = nullptr;
+            }
+            if (fields[i] == nullptr) {
+                order.push_back(i);
+            }
+            plan.paths[i].push_back(get_coordinate(positions[i]));
+        }
+        // the robots that stay put are reserved first
+        std::size_t fixedCount = order.size();
+        for (std::size_t i = 0; i < count; i++) {
+            if (fields[i] != nullptr) {
+                order.push_back(i);
+            }
+        }
+
+        Reservations reservations;
+        std::vector<std::vector<Cell>> windows(count);
+        int time = 0;
+        // every robot holds its cell until it is searched, so the robots
+        // searched before it do not run into it
+        auto reserve_positions = [&]() {
+            reservations.clear();
+            for (std::size_t i = 0; i < count; i++) {
+                reservations.reserve({positions[i]}, time);
+            }
+        };
+        auto all_arrived = [&]() {
+            for (std::size_t i = 0; i < count; i++) {
+                if (!(positions[i] == goals[i])) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        bool blocked = false;
+        while (time < maxSteps && fixedCount < count && !all_arrived() &&
+               !blocked) {
+            reserve_positions();
+            std::size_t restartsLeft = count;
+            for (std::size_t k = 0; k < count; k++) {
+                std::size_t i = order[k];
+                bool found = false;
+                if (fields[i] != nullptr) {
+                    plan.searches++;
+                    found = search_window(*fields[i], goals[i], positions[i],
+                                          time, reservations, windows[i]);
+                }
+                if (!found && fields[i] != nullptr && k > fixedCount &&
+                    restartsLeft > 0) {
+                    // the robots before it left no way through, it is
+                    // searched first and the round is planned again
+                    order.erase(order.begin() + k);
+                    order.insert(order.begin() + fixedCount, i);
+                    restartsLeft--;
+                    plan.restarts++;
+                    reserve_positions();
+                    k = std::size_t(-1);
+                    continue;
+                }
+                if (!found) {
+                    windows[i].assign(std::size_t(window) + 1, positions[i]);
+                    // a robot searched before it may pass its cell later
+                    // in the window
+                    for (int t = time; t < time + window && !blocked; t++) {
+                        blocked = !reservations.can_move(positions[i],
+                                                         positions[i], t);
+                    }
+                    if (blocked) {
+                        break;
+                    }
+                }
+                reservations.reserve(windows[i], time);
+            }
+            if (blocked) {
+                break;
+            }
+
+            // half of the window is carried out, the rest is planned again
+            // with the next round
+            int steps = std::min(window / 2, maxSteps - time);
+            for (std::size_t i = 0; i < count; i++) {
+                for (int s = 1; s <= steps; s++) {
+                    plan.paths[i].push_back(
+                            get_coordinate(windows[i][std::size_t(s)]));
+                }
+                positions[i] = windows[i][std::size_t(steps)];
+            }
+            time += steps;
+        }
+
+        bool arrived = true;
+        for (std::size_t i = 0; i < count; i++) {
+            plan.arrived[i] = positions[i] == goals[i];
+            arrived = arrived && plan.arrived[i];
+        }
+        return arrived && !blocked;
+    }
+
+}
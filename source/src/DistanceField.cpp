@@ -0,0 +1,82 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   DistanceField.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Goal rooted distance field
+//!
+//! A goal rooted cost-to-go field over the search lattice of a pathfinder.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/DistanceField.hpp"
+
+namespace r2d2 {
+
+    const uint8_t DistanceField::NO_DIRECTION;
+    const int DistanceField::DIRECTION_X[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+    const int DistanceField::DIRECTION_Y[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+
+    DistanceField::DistanceField(Coordinate goal, Translation step,
+                                 int minX, int minY, int width, int height,
+                                 uint64_t mapVersion) :
+            goal(goal),
+            step(step),
+            minX{minX},
+            minY{minY},
+            width{width},
+            height{height},
+            mapVersion{mapVersion},
+            cost(std::size_t(width) * std::size_t(height),
+                 std::numeric_limits<float>::infinity()),
+            direction(std::size_t(width) * std::size_t(height),
+                      NO_DIRECTION) {
+    }
+
+    Coordinate DistanceField::get_coordinate(int x, int y) const {
+        return goal + Translation{x * step.get_x(), y * step.get_y(),
+                                  0 * Length::METER};
+    }
+
+    std::size_t DistanceField::get_memory_usage() const {
+        return sizeof(DistanceField) +
+               cost.capacity() * sizeof(float) +
+               direction.capacity() * sizeof(uint8_t);
+    }
+
+}
@@ -8,7 +8,7 @@
 //! \author Jasper Schoenmaker 1661818
 //! \author Chiel Douwes 1666311
 //! \date   Created: 05-04-2016
-//! \date   Last Modified: 15-4-2016
+//! \date   Last Modified: 19-10-2026
 //! \brief  Dummy map for pathfinding
 //!
 //! A dummy implementation of the map, without it the pathfinding module could
@@ -47,6 +47,7 @@
 // ~< HEADER_VERSION 2016 04 12 >~
 
 #include "../include/Dummy.hpp"
+#include <cmath>
 
 namespace r2d2 {
 
@@ -56,7 +57,8 @@ namespace r2d2 {
     Dummy::Dummy(int x, int y, float obstacles) :
             map{},
             sizeX{x},
-            sizeY{y} {
+            sizeY{y},
+            version{0} {
         map.reserve((unsigned long) (y));
         for (int i1 = 0; i1 < y; i1++) {
             map.emplace_back();
@@ -73,7 +75,8 @@ namespace r2d2 {
     Dummy::Dummy(std::vector<std::vector<int>> map) :
             map{map},
             sizeX{int(map[0].size())},
-            sizeY{int(map.size())} {
+            sizeY{int(map.size())},
+            version{0} {
     }
 
     void Dummy::print_map() {
@@ -85,12 +88,18 @@ namespace r2d2 {
         }
     }
 
+    void Dummy::set_cell(int x, int y, int value) {
+        map[y][x] = value;
+        version++;
+    }
+
     const BoxInfo Dummy::get_box_info(const Box box) {
         bool obstacle = false, navigable = false, unknown = false;
-        for (int i1 = int(box.get_bottom_left().get_y() / Length::METER);
-             i1 <= int(box.get_top_right().get_y() / Length::METER); i1++) {
-            for (int i2 = int(box.get_bottom_left().get_x() / Length::METER);
-                 i2 <= int(box.get_top_right().get_x() / Length::METER); i2++) {
+        // cells are selected like GridMap does, so a replay on a sampled
+        // copy sees the same cells just below zero as the original
+        CellRange range{get_cell_range(box)};
+        for (int i1 = range.minY; i1 <= range.maxY; i1++) {
+            for (int i2 = range.minX; i2 <= range.maxX; i2++) {
                 if (i1 < 0 || i1 >= sizeY ||
                     i2 < 0 || i2 >= sizeX) {
                     unknown = true;
@@ -113,8 +122,32 @@ namespace r2d2 {
         return {obstacle, navigable, unknown};
     }
 
+    void Dummy::get_box_infos(const std::vector<Box> &boxes,
+                              std::vector<BoxInfo> &infos) {
+        // the same cells are selected as by get_box_info
+        scan_cells(boxes, infos, sizeX, sizeY, get_cell_range,
+                   [this](int x, int y) {
+            return map[y][x];
+        });
+    }
+
+    BatchedMap::CellRange Dummy::get_cell_range(const Box &box) {
+        return CellRange{
+                int(std::floor(box.get_bottom_left().get_x() / Length::METER)),
+                int(std::floor(box.get_bottom_left().get_y() / Length::METER)),
+                int(std::floor(box.get_top_right().get_x() / Length::METER)),
+                int(std::floor(box.get_top_right().get_y() / Length::METER))};
+    }
+
     const Box Dummy::get_map_bounding_box() {
-        return {};
+        return {Coordinate{0 * Length::METER, 0 * Length::METER,
+                           0 * Length::METER},
+                Translation{sizeX * Length::METER, sizeY * Length::METER,
+                            0 * Length::METER}};
+    }
+
+    uint64_t Dummy::get_map_version() const {
+        return version;
     }
 
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   GridMap.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Grid based map
+//!
+//! A map stored as a grid of cells with a configurable origin and cell size.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/GridMap.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace r2d2 {
+
+    const uint8_t GridMap::FREE, GridMap::OBSTACLE, GridMap::UNKNOWN;
+
+    GridMap::GridMap(Coordinate origin, Length cellSize, int width, int height,
+                     uint8_t fill) :
+            origin(origin),
+            cellSize(cellSize),
+            width{width},
+            height{height},
+            cells(std::size_t(width) * std::size_t(height), fill),
+            version{0} {
+    }
+
+    GridMap GridMap::sample(ReadOnlyMap &map, Length cellSize) {
+        Box bounds{map.get_map_bounding_box()};
+        Translation size{bounds.get_axis_size()};
+        GridMap grid{bounds.get_bottom_left(), cellSize,
+                     int(std::ceil(size.get_x() / cellSize)),
+                     int(std::ceil(size.get_y() / cellSize))};
+        // sample the whole cell, shrunk a little so neighbouring cells that
+        // merely touch the cell border are not taken into account
+        Translation cell{cellSize, cellSize, 0 * Length::METER};
+        for (int y = 0; y < grid.height; y++) {
+            for (int x = 0; x < grid.width; x++) {
+                Coordinate corner{grid.origin + Translation{
+                        x * cellSize, y * cellSize, 0 * Length::METER}};
+                BoxInfo info{map.get_box_info(
+                        Box{corner + cell * .0005, corner + cell * .9995})};
+                grid.cells[std::size_t(y) * std::size_t(grid.width) +
+                           std::size_t(x)] =
+                        info.get_has_obstacle() ? OBSTACLE :
+                        info.get_has_unknown() ? UNKNOWN :
+                        info.get_has_navigable() ? FREE : UNKNOWN;
+            }
+        }
+        return grid;
+    }
+
+    void GridMap::set_cell(int x, int y, uint8_t value) {
+        cells[std::size_t(y) * std::size_t(width) + std::size_t(x)] = value;
+        version++;
+    }
+
+    void GridMap::set_cells(std::vector<uint8_t> values) {
+        cells = std::move(values);
+        cells.resize(std::size_t(width) * std::size_t(height), UNKNOWN);
+        version++;
+    }
+
+    void GridMap::assign(Coordinate origin, Length cellSize, int width,
+                         int height, std::vector<uint8_t> values) {
+        this->origin = origin;
+        this->cellSize = cellSize;
+        this->width = width;
+        this->height = height;
+        set_cells(std::move(values));
+    }
+
+    const BoxInfo GridMap::get_box_info(const Box box) {
+        bool obstacle = false, navigable = false, unknown = false;
+        int minX = int(std::floor((box.get_bottom_left().get_x() - origin.get_x()) / cellSize)),
+                minY = int(std::floor((box.get_bottom_left().get_y() - origin.get_y()) / cellSize)),
+                maxX = int(std::floor((box.get_top_right().get_x() - origin.get_x()) / cellSize)),
+                maxY = int(std::floor((box.get_top_right().get_y() - origin.get_y()) / cellSize));
+        // everything outside of the grid is unknown
+        if (minX < 0 || minY < 0 || maxX >= width || maxY >= height) {
+            unknown = true;
+        }
+        for (int y = std::max(minY, 0); y <= std::min(maxY, height - 1); y++) {
+            for (int x = std::max(minX, 0); x <= std::min(maxX, width - 1); x++) {
+                switch (get_cell(x, y)) {
+                    case FREE:
+                        navigable = true;
+                        break;
+                    case OBSTACLE:
+                        obstacle = true;
+                        break;
+                    default:
+                        unknown = true;
+                }
+            }
+        }
+        return {obstacle, navigable, unknown};
+    }
+
+    void GridMap::get_box_infos(const std::vector<Box> &boxes,
+                                std::vector<BoxInfo> &infos) {
+        // the same cells are selected as by get_box_info
+        scan_cells(boxes, infos, width, height, [this](const Box &box) {
+            return CellRange{
+                    int(std::floor((box.get_bottom_left().get_x() - origin.get_x()) / cellSize)),
+                    int(std::floor((box.get_bottom_left().get_y() - origin.get_y()) / cellSize)),
+                    int(std::floor((box.get_top_right().get_x() - origin.get_x()) / cellSize)),
+                    int(std::floor((box.get_top_right().get_y() - origin.get_y()) / cellSize))};
+        }, [this](int x, int y) {
+            uint8_t cell = get_cell(x, y);
+            return cell == FREE ? 0 : cell == OBSTACLE ? 1 : 2;
+        });
+    }
+
+    const Box GridMap::get_map_bounding_box() {
+        return {origin, Translation{width * cellSize, height * cellSize,
+                                    0 * Length::METER}};
+    }
+
+    uint64_t GridMap::get_map_version() const {
+        return version;
+    }
+
+}
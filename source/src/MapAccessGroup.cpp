@@ -0,0 +1,154 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   MapAccessGroup.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Shared map access for concurrent queries
+//!
+//! Shares a single map accessor between all queries that run at the same time.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/MapAccessGroup.hpp"
+#include <new>
+
+namespace r2d2 {
+
+    MapAccessGroup::MapAccessGroup(SharedObject<ReadOnlyMap> &map) :
+            map(map),
+            mutex{},
+            changed{},
+            storage{},
+            accessor{nullptr},
+            holder{},
+            request{Request::NONE},
+            users{0},
+            changing{false} {
+    }
+
+    MapAccessGroup::~MapAccessGroup() {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            if (!holder.joinable()) {
+                return;
+            }
+            // a last lease may just have asked to close the accessor
+            changed.wait(lock, [this]() {
+                return request == Request::NONE;
+            });
+            request = Request::STOP;
+        }
+        changed.notify_all();
+        holder.join();
+    }
+
+    MapAccessGroup::Lease::Lease(MapAccessGroup &group) :
+            group(group),
+            opener{false} {
+        std::unique_lock<std::mutex> lock{group.mutex};
+        // an accessor that is being opened or closed cannot be joined
+        group.changed.wait(lock, [&group]() {
+            return !group.changing;
+        });
+        if (group.accessor != nullptr) {
+            group.users++;
+            return;
+        }
+        if (!group.holder.joinable()) {
+            group.holder = std::thread{&MapAccessGroup::hold, &group};
+        }
+        group.changing = true;
+        group.request = Request::OPEN;
+        group.changed.notify_all();
+        group.changed.wait(lock, [&group]() {
+            return group.accessor != nullptr;
+        });
+        group.users = 1;
+        group.changing = false;
+        opener = true;
+        group.changed.notify_all();
+    }
+
+    MapAccessGroup::Lease::~Lease() {
+        std::lock_guard<std::mutex> lock{group.mutex};
+        group.users--;
+        if (opener) {
+            // no new queries join once the opener is done, the queries that
+            // joined it keep the accessor open until the last one leaves
+            group.changing = true;
+        }
+        if (group.users == 0 && group.changing) {
+            group.request = Request::CLOSE;
+            group.changed.notify_all();
+        }
+    }
+
+    void MapAccessGroup::hold() {
+        std::unique_lock<std::mutex> lock{mutex};
+        while (true) {
+            changed.wait(lock, [this]() {
+                return request != Request::NONE;
+            });
+            if (request == Request::STOP) {
+                return;
+            }
+            // the map is locked without holding the mutex, so the mutex is
+            // always taken after the map lock and never the other way around
+            bool open = request == Request::OPEN;
+            lock.unlock();
+            if (open) {
+                SharedObject<ReadOnlyMap>::Accessor *opened{
+                        new(&storage) SharedObject<ReadOnlyMap>::Accessor(map)};
+                lock.lock();
+                accessor = opened;
+            } else {
+                accessor->~Accessor();
+                lock.lock();
+                accessor = nullptr;
+                changing = false;
+            }
+            request = Request::NONE;
+            changed.notify_all();
+        }
+    }
+
+    ReadOnlyMap &MapAccessGroup::Lease::access() {
+        return group.accessor->access();
+    }
+
+}
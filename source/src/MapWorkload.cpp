@@ -0,0 +1,314 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   MapWorkload.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Box query workloads for map backends
+//!
+//! Generates the box queries the pathfinder makes, checks the answers of a
+//! map against a reference map, and measures the query throughput of a map.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/MapWorkload.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace r2d2 {
+
+    namespace {
+
+        const double PI = 3.14159265358979323846;
+
+        /**
+         * the box can_travel queries for a straight move
+         */
+        Box make_travel_box(double fromX, double fromY, double toX, double toY,
+                            Translation robotBox) {
+            Coordinate low{std::min(fromX, toX) * Length::METER,
+                           std::min(fromY, toY) * Length::METER,
+                           0 * Length::METER},
+                    high{std::max(fromX, toX) * Length::METER,
+                         std::max(fromY, toY) * Length::METER,
+                         0 * Length::METER};
+            return Box{low - robotBox / 2, high + robotBox / 2};
+        }
+
+        uint32_t count_cells(const Box &box, const Coordinate &origin,
+                             Length cellSize) {
+            Translation low{box.get_bottom_left() - origin},
+                    high{box.get_top_right() - origin};
+            double width = std::floor(high.get_x() / cellSize) -
+                           std::floor(low.get_x() / cellSize) + 1,
+                    height = std::floor(high.get_y() / cellSize) -
+                             std::floor(low.get_y() / cellSize) + 1;
+            return uint32_t(width * height);
+        }
+
+        bool is_inside(const Box &box, const Box &bounds) {
+            return box.get_bottom_left().get_x() >= bounds.get_bottom_left().get_x() &&
+                   box.get_bottom_left().get_y() >= bounds.get_bottom_left().get_y() &&
+                   box.get_top_right().get_x() <= bounds.get_top_right().get_x() &&
+                   box.get_top_right().get_y() <= bounds.get_top_right().get_y();
+        }
+
+        /**
+         * counts the cache references and misses of the calling thread, if
+         * the kernel allows it
+         */
+        class CacheCounters {
+        public:
+            CacheCounters() :
+                    references{-1},
+                    misses{-1} {
+#ifdef __linux__
+                references = open_counter(PERF_COUNT_HW_CACHE_REFERENCES, -1);
+                if (references >= 0) {
+                    misses = open_counter(PERF_COUNT_HW_CACHE_MISSES,
+                                          references);
+                }
+#endif
+            }
+
+            ~CacheCounters() {
+#ifdef __linux__
+                if (misses >= 0) {
+                    close(misses);
+                }
+                if (references >= 0) {
+                    close(references);
+                }
+#endif
+            }
+
+            bool is_available() const {
+                return misses >= 0;
+            }
+
+            void start() {
+#ifdef __linux__
+                if (is_available()) {
+                    ioctl(references, PERF_EVENT_IOC_RESET,
+                          PERF_IOC_FLAG_GROUP);
+                    ioctl(references, PERF_EVENT_IOC_ENABLE,
+                          PERF_IOC_FLAG_GROUP);
+                }
+#endif
+            }
+
+            void stop(uint64_t &referenceCount, uint64_t &missCount) {
+                referenceCount = 0;
+                missCount = 0;
+#ifdef __linux__
+                if (is_available()) {
+                    ioctl(references, PERF_EVENT_IOC_DISABLE,
+                          PERF_IOC_FLAG_GROUP);
+                    if (read(references, &referenceCount,
+                             sizeof(referenceCount)) != sizeof(uint64_t) ||
+                        read(misses, &missCount,
+                             sizeof(missCount)) != sizeof(uint64_t)) {
+                        referenceCount = 0;
+                        missCount = 0;
+                    }
+                }
+#endif
+            }
+
+        private:
+            int references, misses;
+
+#ifdef __linux__
+            static int open_counter(uint64_t config, int group) {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.size = sizeof(attr);
+                attr.config = config;
+                attr.disabled = group < 0 ? 1 : 0;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                return int(syscall(__NR_perf_event_open, &attr, 0, -1, group,
+                                   0));
+            }
+#endif
+        };
+
+    }
+
+    std::vector<BoxQuery> generate_box_queries(const Box &bounds,
+                                               Translation robotBox,
+                                               Length cellSize,
+                                               BoxQueryKind kind, int count,
+                                               uint64_t seed) {
+        std::mt19937_64 random{seed};
+        double left = bounds.get_bottom_left().get_x() / Length::METER,
+                bottom = bounds.get_bottom_left().get_y() / Length::METER,
+                right = bounds.get_top_right().get_x() / Length::METER,
+                top = bounds.get_top_right().get_y() / Length::METER,
+                stepX = robotBox.get_x() / Length::METER,
+                stepY = robotBox.get_y() / Length::METER;
+        double maxSegment = std::max(2 * std::max(stepX, stepY),
+                                     std::min(right - left, top - bottom) / 4);
+        std::uniform_real_distribution<double> x{left, right}, y{bottom, top},
+                unit{0, 1};
+        std::uniform_int_distribution<int> direction{0, 7};
+
+        // a move from a position in one of the eight lattice directions
+        auto successor = [&](double fromX, double fromY) {
+            int dir = direction(random);
+            int dx = dir < 3 ? -1 : dir < 5 ? 0 : 1,
+                    dy = dir % 3 == 0 ? -1 : dir % 3 == 1 ? 0 : 1;
+            if (dx == 0 && dy == 0) {
+                dy = dir == 3 ? -1 : 1;
+            }
+            return make_travel_box(fromX, fromY, fromX + dx * stepX,
+                                   fromY + dy * stepY, robotBox);
+        };
+        auto segment = [&](double fromX, double fromY) {
+            double length = 2 * std::max(stepX, stepY) +
+                            unit(random) * (maxSegment -
+                                            2 * std::max(stepX, stepY));
+            double angle = unit(random) < .7 ?
+                           int(unit(random) * 4) * PI / 2 :
+                           unit(random) * 2 * PI;
+            return make_travel_box(fromX, fromY,
+                                   fromX + std::cos(angle) * length,
+                                   fromY + std::sin(angle) * length,
+                                   robotBox);
+        };
+
+        std::vector<BoxQuery> queries;
+        queries.reserve(std::size_t(std::max(count, 0)));
+        while (int(queries.size()) < count) {
+            Box box{Coordinate{}, Coordinate{}};
+            if (kind == BoxQueryKind::SUCCESSOR) {
+                box = successor(x(random), y(random));
+            } else if (kind == BoxQueryKind::SEGMENT) {
+                box = segment(x(random), y(random));
+            } else {
+                // a position up to a robot size and two meters from an edge
+                double margin = std::max(stepX, stepY) + 2,
+                        across = (unit(random) * 2 - 1) * margin;
+                double fromX, fromY;
+                switch (direction(random) % 4) {
+                    case 0:
+                        fromX = left + across, fromY = y(random);
+                        break;
+                    case 1:
+                        fromX = right + across, fromY = y(random);
+                        break;
+                    case 2:
+                        fromX = x(random), fromY = bottom + across;
+                        break;
+                    default:
+                        fromX = x(random), fromY = top + across;
+                }
+                box = unit(random) < .75 ? successor(fromX, fromY) :
+                      segment(fromX, fromY);
+                if (is_inside(box, bounds)) {
+                    continue;
+                }
+            }
+            queries.push_back(BoxQuery{
+                    box, kind,
+                    count_cells(box, bounds.get_bottom_left(), cellSize)});
+        }
+        return queries;
+    }
+
+    MapConformance check_map_conformance(ReadOnlyMap &reference,
+                                         ReadOnlyMap &map,
+                                         const std::vector<BoxQuery> &queries) {
+        MapConformance result{int(queries.size()), 0, 0, -1};
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            BoxInfo expected{reference.get_box_info(queries[i].box)},
+                    actual{map.get_box_info(queries[i].box)};
+            bool unsafe =
+                    (expected.get_has_obstacle() || expected.get_has_unknown()) &&
+                    !(actual.get_has_obstacle() || actual.get_has_unknown());
+            if (unsafe ||
+                expected.get_has_navigable() != actual.get_has_navigable() ||
+                expected.get_has_obstacle() != actual.get_has_obstacle() ||
+                expected.get_has_unknown() != actual.get_has_unknown()) {
+                if (result.firstMismatch < 0 || (unsafe && result.unsafe == 0)) {
+                    result.firstMismatch = int(i);
+                }
+                result.mismatches++;
+                result.unsafe += unsafe ? 1 : 0;
+            }
+        }
+        return result;
+    }
+
+    MapThroughput measure_map_throughput(ReadOnlyMap &map,
+                                         const std::vector<BoxQuery> &queries,
+                                         int repeats) {
+        uint64_t cells = 0;
+        for (const BoxQuery &query : queries) {
+            cells += query.cells;
+        }
+        CacheCounters counters;
+        MapThroughput result{0, 0, counters.is_available(), 0, 0};
+        counters.start();
+        auto begin = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < repeats; repeat++) {
+            for (const BoxQuery &query : queries) {
+                map.get_box_info(query.box);
+            }
+        }
+        double seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - begin).count();
+        counters.stop(result.cacheReferences, result.cacheMisses);
+        if (seconds > 0 && !queries.empty()) {
+            result.queriesPerSecond = queries.size() * double(repeats) / seconds;
+            result.nsPerCell = seconds * 1e9 / (double(cells) * repeats);
+        }
+        return result;
+    }
+
+}
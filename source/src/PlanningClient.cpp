@@ -0,0 +1,125 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningClient.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Client of the planning daemon
+//!
+//! Sends batches of path queries to a PlanningServer on the same host.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/PlanningClient.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define R2D2_PATHFINDING_SOCKETS
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace r2d2 {
+
+    PlanningClient::PlanningClient(const std::string &socketPath) :
+            socket{-1},
+            nextBatchId{0},
+            sendBuffer{},
+            receiveBuffer{} {
+#ifdef R2D2_PATHFINDING_SOCKETS
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("socket path too long: " + socketPath);
+        }
+        std::strcpy(address.sun_path, socketPath.c_str());
+        socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket < 0 ||
+            connect(socket, reinterpret_cast<sockaddr *>(&address),
+                    sizeof(address)) < 0) {
+            std::string error{std::strerror(errno)};
+            if (socket >= 0) {
+                close(socket);
+            }
+            throw std::runtime_error("cannot connect to " + socketPath + ": " +
+                                     error);
+        }
+#else
+        throw std::runtime_error("unix domain sockets are not supported");
+#endif
+    }
+
+    PlanningClient::~PlanningClient() {
+#ifdef R2D2_PATHFINDING_SOCKETS
+        close(socket);
+#endif
+    }
+
+    uint32_t PlanningClient::send(const std::vector<PlanningQuery> &queries) {
+        if (queries.size() > PLANNING_MAX_BATCH) {
+            throw std::runtime_error("planning batch too large");
+        }
+        uint32_t batchId = nextBatchId++;
+        encode_planning_request(batchId, queries, sendBuffer);
+        if (!write_planning_frame(socket, sendBuffer)) {
+            throw std::runtime_error("planning server closed the connection");
+        }
+        return batchId;
+    }
+
+    uint32_t PlanningClient::receive(std::vector<PathResult> &results) {
+        if (!read_planning_frame(socket, receiveBuffer)) {
+            throw std::runtime_error("planning server closed the connection");
+        }
+        return decode_planning_reply(receiveBuffer, results);
+    }
+
+    std::vector<PathResult> PlanningClient::plan(
+            const std::vector<PlanningQuery> &queries) {
+        uint32_t batchId = send(queries);
+        std::vector<PathResult> results;
+        if (receive(results) != batchId) {
+            throw std::runtime_error("planning reply of another batch");
+        }
+        return results;
+    }
+
+}
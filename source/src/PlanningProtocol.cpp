@@ -0,0 +1,243 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningProtocol.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Wire format of the planning daemon
+//!
+//! The binary messages a PlanningClient and a PlanningServer exchange over a
+//! Unix domain socket.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/PlanningProtocol.hpp"
+#include "../include/PrecomputationBundle.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define R2D2_PATHFINDING_SOCKETS
+#include <sys/socket.h>
+#endif
+
+namespace r2d2 {
+
+    namespace {
+
+        void begin_frame(uint32_t magic, uint32_t batchId, std::size_t count,
+                         std::vector<uint8_t> &frame) {
+            frame.clear();
+            PrecomputationBundle::Writer out{frame};
+            // the size is filled in by end_frame
+            out.put(uint32_t(0));
+            out.put(magic);
+            out.put(batchId);
+            out.put(uint32_t(count));
+        }
+
+        void end_frame(std::vector<uint8_t> &frame) {
+            uint32_t size = uint32_t(frame.size() - sizeof(uint32_t));
+            std::memcpy(frame.data(), &size, sizeof(size));
+        }
+
+        uint32_t begin_decode(PrecomputationBundle::Reader &in,
+                              uint32_t magic, uint32_t &count) {
+            if (in.get<uint32_t>() != magic) {
+                throw std::runtime_error("not a planning message");
+            }
+            uint32_t batchId = in.get<uint32_t>();
+            count = in.get<uint32_t>();
+            if (count > PLANNING_MAX_BATCH) {
+                throw std::runtime_error("planning batch too large");
+            }
+            return batchId;
+        }
+
+        Coordinate get_coordinate(PrecomputationBundle::Reader &in) {
+            Length x{in.get_length()};
+            return Coordinate{x, in.get_length(), 0 * Length::METER};
+        }
+
+#ifdef R2D2_PATHFINDING_SOCKETS
+
+        /**
+         * read exactly size bytes
+         *
+         * \return the amount of bytes read, less than size at the end of the
+         * stream
+         */
+        std::size_t read_fully(int socket, uint8_t *data, std::size_t size) {
+            std::size_t done = 0;
+            while (done < size) {
+                ssize_t count = recv(socket, data + done, size - done, 0);
+                if (count == 0) {
+                    break;
+                }
+                if (count < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error(std::string{"planning read: "} +
+                                             std::strerror(errno));
+                }
+                done += std::size_t(count);
+            }
+            return done;
+        }
+
+#endif
+
+    }
+
+    void encode_planning_request(uint32_t batchId,
+                                 const std::vector<PlanningQuery> &queries,
+                                 std::vector<uint8_t> &frame) {
+        begin_frame(PLANNING_REQUEST_MAGIC, batchId, queries.size(), frame);
+        PrecomputationBundle::Writer out{frame};
+        for (const PlanningQuery &query : queries) {
+            out.put_length(query.start.get_x());
+            out.put_length(query.start.get_y());
+            out.put_length(query.goal.get_x());
+            out.put_length(query.goal.get_y());
+        }
+        end_frame(frame);
+    }
+
+    uint32_t decode_planning_request(const std::vector<uint8_t> &frame,
+                                     std::vector<PlanningQuery> &queries) {
+        PrecomputationBundle::Reader in{frame.data(), frame.size()};
+        uint32_t count;
+        uint32_t batchId = begin_decode(in, PLANNING_REQUEST_MAGIC, count);
+        queries.clear();
+        for (uint32_t i = 0; i < count; i++) {
+            Coordinate start{get_coordinate(in)};
+            queries.push_back(PlanningQuery{start, get_coordinate(in)});
+        }
+        return batchId;
+    }
+
+    void encode_planning_reply(uint32_t batchId,
+                               const std::vector<PathResult> &results,
+                               std::vector<uint8_t> &frame) {
+        begin_frame(PLANNING_REPLY_MAGIC, batchId, results.size(), frame);
+        PrecomputationBundle::Writer out{frame};
+        std::vector<double> points;
+        for (const PathResult &result : results) {
+            out.put(uint8_t(result.status));
+            points.clear();
+            for (const Coordinate &point : result.path) {
+                points.push_back(point.get_x() / Length::METER);
+                points.push_back(point.get_y() / Length::METER);
+            }
+            out.put_vector(points);
+        }
+        end_frame(frame);
+    }
+
+    uint32_t decode_planning_reply(const std::vector<uint8_t> &frame,
+                                   std::vector<PathResult> &results) {
+        PrecomputationBundle::Reader in{frame.data(), frame.size()};
+        uint32_t count;
+        uint32_t batchId = begin_decode(in, PLANNING_REPLY_MAGIC, count);
+        results.resize(count);
+        std::vector<double> points;
+        for (PathResult &result : results) {
+            uint8_t status = in.get<uint8_t>();
+            if (status > uint8_t(PathResult::Status::CANCELLED)) {
+                throw std::runtime_error("invalid planning status");
+            }
+            result.status = PathResult::Status(status);
+            in.get_vector(points);
+            result.path.clear();
+            for (std::size_t i = 0; i + 1 < points.size(); i += 2) {
+                result.path.push_back(Coordinate{
+                        points[i] * Length::METER,
+                        points[i + 1] * Length::METER, 0 * Length::METER});
+            }
+        }
+        return batchId;
+    }
+
+    bool read_planning_frame(int socket, std::vector<uint8_t> &frame) {
+#ifdef R2D2_PATHFINDING_SOCKETS
+        uint32_t size;
+        std::size_t count = read_fully(
+                socket, reinterpret_cast<uint8_t *>(&size), sizeof(size));
+        if (count == 0) {
+            return false;
+        }
+        if (count < sizeof(size) || size > PLANNING_MAX_FRAME) {
+            throw std::runtime_error("invalid planning frame");
+        }
+        frame.resize(size);
+        if (read_fully(socket, frame.data(), size) < size) {
+            throw std::runtime_error("planning frame ends early");
+        }
+        return true;
+#else
+        throw std::runtime_error("sockets are not supported");
+#endif
+    }
+
+    bool write_planning_frame(int socket, const std::vector<uint8_t> &frame) {
+#ifdef R2D2_PATHFINDING_SOCKETS
+        int flags = 0;
+#ifdef MSG_NOSIGNAL
+        // a client that went away must not kill the server with SIGPIPE
+        flags = MSG_NOSIGNAL;
+#endif
+        std::size_t done = 0;
+        while (done < frame.size()) {
+            ssize_t count = send(socket, frame.data() + done,
+                                 frame.size() - done, flags);
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            done += std::size_t(count);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+}
@@ -0,0 +1,406 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningServer.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Planning daemon
+//!
+//! Serves path queries of other processes on the same host over a Unix domain
+//! socket, so they share a single map and pathfinder.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/PlanningServer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define R2D2_PATHFINDING_SOCKETS
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace r2d2 {
+
+    struct PlanningServer::Connection {
+        explicit Connection(int socket) :
+                socket{socket},
+                reader{},
+                mutex{},
+                finished{},
+                replyQueued{},
+                inFlight{0},
+                replies{},
+                readerDone{false},
+                broken{false},
+                done{false} {
+        }
+
+        ~Connection() {
+#ifdef R2D2_PATHFINDING_SOCKETS
+            close(socket);
+#endif
+        }
+
+        int socket;
+        std::thread reader;
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::condition_variable replyQueued;
+        //! the amount of queries accepted but whose reply is not yet written
+        std::size_t inFlight;
+        //! the replies for the writer, with the amount of queries of each
+        std::deque<std::pair<std::vector<uint8_t>, std::size_t>> replies;
+        //! set when the reader has no more replies coming
+        bool readerDone;
+        //! set when a reply could not be written
+        std::atomic<bool> broken;
+        //! set when the reader is about to return
+        std::atomic<bool> done;
+    };
+
+    struct PlanningServer::Batch {
+        uint32_t id;
+        std::vector<PlanningQuery> queries;
+        std::vector<PathResult> results;
+        std::atomic<std::size_t> remaining;
+    };
+
+#ifdef R2D2_PATHFINDING_SOCKETS
+
+    PlanningServer::PlanningServer(PathFinder &pathFinder,
+                                   const std::string &socketPath,
+                                   int threadCount, int maxInFlight) :
+            pathFinder(pathFinder),
+            socketPath{socketPath},
+            maxInFlight{std::max(maxInFlight, 1)},
+            listener{-1},
+            wakeRead{-1},
+            wakeWrite{-1},
+            stopping{false},
+            queryCount{0},
+            connections{},
+            pool{threadCount} {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("socket path too long: " + socketPath);
+        }
+        std::strcpy(address.sun_path, socketPath.c_str());
+
+        listener = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0) {
+            throw std::runtime_error(std::string{"cannot create socket: "} +
+                                     std::strerror(errno));
+        }
+        // a server that was killed leaves its socket behind
+        struct stat info;
+        if (stat(socketPath.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+            unlink(socketPath.c_str());
+        }
+        int pipeEnds[2];
+        if (bind(listener, reinterpret_cast<sockaddr *>(&address),
+                 sizeof(address)) < 0 || listen(listener, 64) < 0 ||
+            pipe(pipeEnds) < 0) {
+            std::string error{std::strerror(errno)};
+            close(listener);
+            throw std::runtime_error("cannot listen on " + socketPath + ": " +
+                                     error);
+        }
+        wakeRead = pipeEnds[0];
+        wakeWrite = pipeEnds[1];
+    }
+
+    PlanningServer::~PlanningServer() {
+        close(listener);
+        close(wakeRead);
+        close(wakeWrite);
+        unlink(socketPath.c_str());
+    }
+
+    void PlanningServer::run() {
+        pollfd descriptors[2] = {{listener, POLLIN, 0}, {wakeRead, POLLIN, 0}};
+        while (!stopping) {
+            if (poll(descriptors, 2, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            if (descriptors[1].revents != 0) {
+                break;
+            }
+            if ((descriptors[0].revents & POLLIN) == 0) {
+                continue;
+            }
+            int socket = accept(listener, nullptr, nullptr);
+            if (socket < 0) {
+                continue;
+            }
+            // clean up after the clients that left
+            for (auto it = connections.begin(); it != connections.end();) {
+                if ((*it)->done) {
+                    (*it)->reader.join();
+                    it = connections.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            std::shared_ptr<Connection> connection{
+                    std::make_shared<Connection>(socket)};
+            connection->reader = std::thread{&PlanningServer::serve, this,
+                                             connection};
+            connections.push_back(connection);
+        }
+
+        // the readers see the end of their stream and finish their batches
+        for (const std::shared_ptr<Connection> &connection : connections) {
+            shutdown(connection->socket, SHUT_RD);
+        }
+        for (const std::shared_ptr<Connection> &connection : connections) {
+            connection->reader.join();
+        }
+        connections.clear();
+    }
+
+    void PlanningServer::stop() {
+        stopping = true;
+        char wake = 1;
+        ssize_t written = write(wakeWrite, &wake, 1);
+        (void) written;
+    }
+
+    const int PlanningServer::STOP_WRITE_TIMEOUT_MS;
+
+    void PlanningServer::serve(std::shared_ptr<Connection> connection) {
+        std::thread writer{&PlanningServer::write_replies, this, connection};
+        std::vector<uint8_t> frame;
+        try {
+            while (!connection->broken &&
+                   read_planning_frame(connection->socket, frame)) {
+                std::shared_ptr<Batch> batch{std::make_shared<Batch>()};
+                batch->id = decode_planning_request(frame, batch->queries);
+                std::size_t count = batch->queries.size();
+                batch->results.resize(count);
+                batch->remaining = count;
+                if (count == 0) {
+                    std::vector<uint8_t> reply;
+                    encode_planning_reply(batch->id, batch->results, reply);
+                    std::lock_guard<std::mutex> lock{connection->mutex};
+                    connection->replies.emplace_back(std::move(reply), 0);
+                    connection->replyQueued.notify_one();
+                    continue;
+                }
+                {
+                    // a batch larger than the limit waits for an idle
+                    // connection instead of never being accepted
+                    std::unique_lock<std::mutex> lock{connection->mutex};
+                    connection->finished.wait(lock, [&]() {
+                        return connection->inFlight == 0 ||
+                               connection->inFlight + count <=
+                               std::size_t(maxInFlight);
+                    });
+                    connection->inFlight += count;
+                }
+                for (std::size_t i = 0; i < count; i++) {
+                    pool.submit([this, connection, batch, i]() {
+                        answer(connection, batch, i);
+                    });
+                }
+            }
+        } catch (const std::runtime_error &) {
+            // an invalid frame, the client cannot be trusted any more
+        }
+        {
+            std::unique_lock<std::mutex> lock{connection->mutex};
+            connection->finished.wait(lock, [&]() {
+                return connection->inFlight == 0;
+            });
+            connection->readerDone = true;
+        }
+        connection->replyQueued.notify_one();
+        writer.join();
+        shutdown(connection->socket, SHUT_RDWR);
+        connection->done = true;
+    }
+
+    void PlanningServer::write_replies(std::shared_ptr<Connection> connection) {
+        std::unique_lock<std::mutex> lock{connection->mutex};
+        while (true) {
+            connection->replyQueued.wait(lock, [&]() {
+                return !connection->replies.empty() || connection->readerDone;
+            });
+            // the queue is emptied before the writer returns
+            if (connection->replies.empty()) {
+                return;
+            }
+            std::pair<std::vector<uint8_t>, std::size_t> reply{
+                    std::move(connection->replies.front())};
+            connection->replies.pop_front();
+            lock.unlock();
+            if (!connection->broken &&
+                !write_reply(connection->socket, reply.first)) {
+                connection->broken = true;
+                // wakes up the reader, nobody reads the replies
+                shutdown(connection->socket, SHUT_RD);
+            }
+            lock.lock();
+            connection->inFlight -= reply.second;
+            connection->finished.notify_all();
+        }
+    }
+
+    bool PlanningServer::write_reply(int socket,
+                                     const std::vector<uint8_t> &frame) {
+        int flags = MSG_DONTWAIT;
+#ifdef MSG_NOSIGNAL
+        // a client that went away must not kill the server with SIGPIPE
+        flags |= MSG_NOSIGNAL;
+#endif
+        const int pollInterval = 100;
+        int waited = 0;
+        std::size_t done = 0;
+        while (done < frame.size()) {
+            ssize_t count = send(socket, frame.data() + done,
+                                 frame.size() - done, flags);
+            if (count >= 0) {
+                done += std::size_t(count);
+                waited = 0;
+                continue;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                return false;
+            }
+            // a full socket is only given up on when the server stops
+            if (stopping && waited >= STOP_WRITE_TIMEOUT_MS) {
+                return false;
+            }
+            pollfd descriptor{socket, POLLOUT, 0};
+            if (poll(&descriptor, 1, pollInterval) == 0) {
+                waited += pollInterval;
+            }
+        }
+        return true;
+    }
+
+    void PlanningServer::answer(std::shared_ptr<Connection> connection,
+                                std::shared_ptr<Batch> batch,
+                                std::size_t index) {
+        const PlanningQuery &query = batch->queries[index];
+        PathResult &result = batch->results[index];
+        try {
+            result.status = pathFinder.get_path_to_coordinate(
+                    query.start, query.goal, result.path) ?
+                            PathResult::Status::FOUND :
+                            PathResult::Status::NOT_FOUND;
+        } catch (const std::exception &) {
+            // a single query must not take the daemon down
+            result.status = PathResult::Status::NOT_FOUND;
+            result.path.clear();
+        }
+        queryCount++;
+        if (--batch->remaining != 0) {
+            return;
+        }
+
+        // the writer of the connection sends it, a worker never waits for
+        // a client
+        std::vector<uint8_t> frame;
+        encode_planning_reply(batch->id, batch->results, frame);
+        std::lock_guard<std::mutex> lock{connection->mutex};
+        connection->replies.emplace_back(std::move(frame),
+                                         batch->queries.size());
+        connection->replyQueued.notify_one();
+    }
+
+#else
+
+    PlanningServer::PlanningServer(PathFinder &pathFinder,
+                                   const std::string &socketPath,
+                                   int threadCount, int maxInFlight) :
+            pathFinder(pathFinder),
+            socketPath{socketPath},
+            maxInFlight{maxInFlight},
+            listener{-1},
+            wakeRead{-1},
+            wakeWrite{-1},
+            stopping{false},
+            queryCount{0},
+            connections{},
+            pool{1} {
+        throw std::runtime_error("unix domain sockets are not supported");
+    }
+
+    PlanningServer::~PlanningServer() {
+    }
+
+    void PlanningServer::run() {
+    }
+
+    void PlanningServer::stop() {
+    }
+
+    void PlanningServer::serve(std::shared_ptr<Connection> connection) {
+    }
+
+    void PlanningServer::write_replies(std::shared_ptr<Connection> connection) {
+    }
+
+    bool PlanningServer::write_reply(int socket,
+                                     const std::vector<uint8_t> &frame) {
+        return false;
+    }
+
+    void PlanningServer::answer(std::shared_ptr<Connection> connection,
+                                std::shared_ptr<Batch> batch,
+                                std::size_t index) {
+    }
+
+#endif
+
+}
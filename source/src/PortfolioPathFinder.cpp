@@ -0,0 +1,288 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PortfolioPathFinder.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Portfolio pathfinder
+//!
+//! A pathfinder that races several planner configurations on a query and
+//! keeps the first or best result.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/PortfolioPathFinder.hpp"
+#include <algorithm>
+#include <condition_variable>
+
+namespace r2d2 {
+
+    namespace {
+
+        double get_length(Coordinate from, const std::vector<Coordinate> &path) {
+            double length = 0;
+            for (const Coordinate &to : path) {
+                length += (to - from).get_length() / Length::METER;
+                from = to;
+            }
+            return length;
+        }
+
+    }
+
+    /**
+     * the runs of a single query
+     *
+     * the race is shared with the runs, as they can finish after the query
+     * was answered.
+     */
+    struct PortfolioPathFinder::Race {
+        enum class Status {
+            RUNNING, FOUND, NOT_FOUND
+        };
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        //! cancels the runs once the query is answered
+        CancellationToken token;
+        int running;
+        bool answered;
+        std::vector<Status> status;
+        std::vector<std::vector<Coordinate>> paths;
+    };
+
+    PortfolioPathFinder::PortfolioPathFinder(SharedObject<ReadOnlyMap> &map,
+                                             Box robotBox, int threadCount) :
+            PathFinder{map, robotBox},
+            mutex{},
+            configurations{},
+            deadline{0},
+            statisticsMutex{},
+            pool{threadCount} {
+    }
+
+    PortfolioPlanner PortfolioPathFinder::make_planner(
+            AStarPathFinder &pathFinder, SearchSettings settings) {
+        return [&pathFinder, settings](Coordinate start, Coordinate goal,
+                                       std::vector<Coordinate> &path,
+                                       const CancellationToken &token) {
+            return pathFinder.get_path_to_coordinate(start, goal, path, token,
+                                                     settings);
+        };
+    }
+
+    void PortfolioPathFinder::add_configuration(const std::string &name,
+                                                PortfolioPlanner planner) {
+        std::shared_ptr<Configuration> configuration{
+                std::make_shared<Configuration>()};
+        configuration->planner = std::move(planner);
+        configuration->statistics = PortfolioStatistics{
+                name, 0, 0, 0, 0, std::chrono::nanoseconds{0}};
+        std::lock_guard<std::mutex> lock{mutex};
+        configurations.push_back(configuration);
+    }
+
+    bool PortfolioPathFinder::remove_configuration(const std::string &name) {
+        std::lock_guard<std::mutex> lock{mutex};
+        for (auto it = configurations.begin(); it != configurations.end();
+             ++it) {
+            // the name is never changed, so it is read without the
+            // statistics mutex
+            if ((*it)->statistics.name == name) {
+                configurations.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void PortfolioPathFinder::prune(std::size_t keep) {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (configurations.size() <= keep) {
+            return;
+        }
+        std::vector<std::pair<int, std::size_t>> ranking;
+        {
+            std::lock_guard<std::mutex> statisticsLock{statisticsMutex};
+            for (std::size_t i = 0; i < configurations.size(); i++) {
+                ranking.push_back({-configurations[i]->statistics.wins, i});
+            }
+        }
+        std::sort(ranking.begin(), ranking.end());
+        std::vector<bool> kept(configurations.size(), false);
+        for (std::size_t i = 0; i < keep; i++) {
+            kept[ranking[i].second] = true;
+        }
+        std::vector<std::shared_ptr<Configuration>> remaining;
+        for (std::size_t i = 0; i < configurations.size(); i++) {
+            if (kept[i]) {
+                remaining.push_back(configurations[i]);
+            }
+        }
+        configurations = std::move(remaining);
+    }
+
+    void PortfolioPathFinder::set_deadline(std::chrono::nanoseconds deadline) {
+        std::lock_guard<std::mutex> lock{mutex};
+        this->deadline = deadline;
+    }
+
+    bool PortfolioPathFinder::get_path_to_coordinate(
+            Coordinate start, Coordinate goal, std::vector<Coordinate> &path) {
+        return get_path_to_coordinate(start, goal, path,
+                                      CancellationToken::never());
+    }
+
+    bool PortfolioPathFinder::get_path_to_coordinate(
+            Coordinate start, Coordinate goal, std::vector<Coordinate> &path,
+            const CancellationToken &token, std::string *winner) {
+        typedef std::chrono::steady_clock Clock;
+        std::vector<std::shared_ptr<Configuration>> entries;
+        std::chrono::nanoseconds wait;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            entries = configurations;
+            wait = deadline;
+        }
+        if (entries.empty()) {
+            return false;
+        }
+
+        Clock::time_point begin{Clock::now()};
+        std::shared_ptr<Race> race{std::make_shared<Race>()};
+        race->running = int(entries.size());
+        race->answered = false;
+        race->status.assign(entries.size(), Race::Status::RUNNING);
+        race->paths.resize(entries.size());
+        for (std::size_t i = 0; i < entries.size(); i++) {
+            std::shared_ptr<Configuration> entry{entries[i]};
+            pool.submit([this, race, entry, i, start, goal]() {
+                Clock::time_point runStart{Clock::now()};
+                std::vector<Coordinate> found;
+                // a run that starts after the answer is not needed
+                bool success = !race->token.is_cancelled() &&
+                               entry->planner(start, goal, found, race->token);
+                std::chrono::nanoseconds time{Clock::now() - runStart};
+                {
+                    std::lock_guard<std::mutex> lock{race->mutex};
+                    bool late = race->answered;
+                    if (!late) {
+                        race->status[i] = success ? Race::Status::FOUND :
+                                          Race::Status::NOT_FOUND;
+                        race->paths[i] = std::move(found);
+                    }
+                    race->running--;
+                    // counted before the query can see the run, so the
+                    // statistics are complete once it returns
+                    std::lock_guard<std::mutex> statisticsLock{
+                            statisticsMutex};
+                    PortfolioStatistics &statistics = entry->statistics;
+                    if (late) {
+                        statistics.cancelled++;
+                    } else {
+                        (success ? statistics.found : statistics.notFound)++;
+                        statistics.time += time;
+                    }
+                }
+                race->finished.notify_all();
+            });
+        }
+
+        int chosen = -1;
+        {
+            std::unique_lock<std::mutex> lock{race->mutex};
+            Clock::time_point until{begin + wait};
+            while (true) {
+                double bestLength = 0;
+                for (std::size_t i = 0; i < entries.size(); i++) {
+                    if (race->status[i] != Race::Status::FOUND) {
+                        continue;
+                    }
+                    double length = get_length(start, race->paths[i]);
+                    if (chosen < 0 || length < bestLength) {
+                        chosen = int(i);
+                        bestLength = length;
+                    }
+                }
+                Clock::time_point now{Clock::now()};
+                if (chosen >= 0 && (race->running == 0 || now >= until)) {
+                    break;
+                }
+                chosen = -1;
+                if (race->running == 0 || token.is_cancelled()) {
+                    break;
+                }
+                // wake up for the deadline, and regularly for the token
+                Clock::time_point wake{now + std::chrono::milliseconds(1)};
+                if (now < until) {
+                    wake = std::min(wake, until);
+                }
+                race->finished.wait_until(lock, wake);
+            }
+            race->answered = true;
+            if (chosen >= 0) {
+                path = std::move(race->paths[std::size_t(chosen)]);
+            }
+        }
+        race->token.cancel();
+        if (chosen < 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock{statisticsMutex};
+        PortfolioStatistics &statistics = entries[std::size_t(chosen)]->statistics;
+        statistics.wins++;
+        if (winner != nullptr) {
+            *winner = statistics.name;
+        }
+        return true;
+    }
+
+    std::vector<PortfolioStatistics> PortfolioPathFinder::get_statistics() const {
+        std::vector<std::shared_ptr<Configuration>> entries;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            entries = configurations;
+        }
+        std::vector<PortfolioStatistics> statistics;
+        std::lock_guard<std::mutex> lock{statisticsMutex};
+        for (const std::shared_ptr<Configuration> &entry : entries) {
+            statistics.push_back(entry->statistics);
+        }
+        return statistics;
+    }
+
+}
@@ -0,0 +1,355 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PrecomputationBundle.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Serialized precomputed indices
+//!
+//! A versioned binary file holding the indices that planners derive from a
+//! map, tied to a hash of the map content and memory mapped when read.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/PrecomputationBundle.hpp"
+#include "../include/GridMap.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define R2D2_PATHFINDING_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace r2d2 {
+
+    namespace {
+
+        const char MAGIC[4] = {'R', '2', 'P', 'B'};
+
+        // written as a number, so a bundle of another byte order reads
+        // differently
+        const uint32_t ORDER_MARK = 0x01020304;
+
+        const std::size_t NAME_SIZE = 16;
+
+        struct Header {
+            char magic[4];
+            uint32_t version;
+            uint32_t byteOrder;
+            uint32_t sectionCount;
+        };
+
+        struct TableEntry {
+            char name[NAME_SIZE];
+            uint64_t offset;
+            uint64_t size;
+            uint64_t checksum;
+            uint64_t mapHash;
+            double hashCellSize;
+        };
+
+        const uint64_t HASH_START = 14695981039346656037ull,
+                HASH_PRIME = 1099511628211ull;
+
+        /**
+         * FNV-1a over 8 byte words, with the remaining bytes one by one
+         */
+        uint64_t hash_bytes(const uint8_t *data, std::size_t size,
+                            uint64_t hash = HASH_START) {
+            std::size_t i = 0;
+            for (; i + 8 <= size; i += 8) {
+                uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                hash = (hash ^ word) * HASH_PRIME;
+            }
+            for (; i < size; i++) {
+                hash = (hash ^ data[i]) * HASH_PRIME;
+            }
+            return hash;
+        }
+
+        template<typename T>
+        uint64_t hash_value(const T &value, uint64_t hash) {
+            return hash_bytes(reinterpret_cast<const uint8_t *>(&value),
+                              sizeof(T), hash);
+        }
+
+        std::size_t align(std::size_t offset) {
+            return (offset + 7) / 8 * 8;
+        }
+
+    }
+
+    const uint32_t PrecomputationBundle::FORMAT_VERSION;
+
+    PrecomputationBundle::PrecomputationBundle() :
+            sections{},
+            mapping{nullptr},
+            mappingSize{0},
+            buffer{} {
+    }
+
+    PrecomputationBundle::~PrecomputationBundle() {
+#ifdef R2D2_PATHFINDING_MMAP
+        if (mapping != nullptr) {
+            munmap(mapping, mappingSize);
+        }
+#endif
+    }
+
+    uint64_t PrecomputationBundle::compute_map_hash(ReadOnlyMap &map,
+                                                    Length cellSize) {
+        uint64_t hash = HASH_START;
+        GridMap *grid = dynamic_cast<GridMap *>(&map);
+        if (grid != nullptr) {
+            hash = hash_value(grid->get_origin().get_x() / Length::METER, hash);
+            hash = hash_value(grid->get_origin().get_y() / Length::METER, hash);
+            hash = hash_value(grid->get_cell_size() / Length::METER, hash);
+            hash = hash_value(grid->get_width(), hash);
+            hash = hash_value(grid->get_height(), hash);
+            return hash_bytes(grid->get_cells().data(),
+                              grid->get_cells().size(), hash);
+        }
+
+        Box bounds{map.get_map_bounding_box()};
+        Translation size{bounds.get_axis_size()};
+        hash = hash_value(bounds.get_bottom_left().get_x() / Length::METER, hash);
+        hash = hash_value(bounds.get_bottom_left().get_y() / Length::METER, hash);
+        hash = hash_value(size.get_x() / Length::METER, hash);
+        hash = hash_value(size.get_y() / Length::METER, hash);
+        int width = int(std::ceil(size.get_x() / cellSize)),
+                height = int(std::ceil(size.get_y() / cellSize));
+        std::vector<uint8_t> row(std::size_t(std::max(width, 0)));
+        Translation cell{cellSize, cellSize, 0 * Length::METER};
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                Coordinate corner{bounds.get_bottom_left() + Translation{
+                        x * cellSize, y * cellSize, 0 * Length::METER}};
+                // boxes that touch the neighbouring cells would also report
+                // their content, so a change of a single cell would be missed
+                BoxInfo info{map.get_box_info(Box{corner + cell * .0005,
+                                                  corner + cell * .9995})};
+                row[x] = uint8_t((info.get_has_obstacle() ? 1 : 0) |
+                                 (info.get_has_navigable() ? 2 : 0) |
+                                 (info.get_has_unknown() ? 4 : 0));
+            }
+            hash = hash_bytes(row.data(), row.size(), hash);
+        }
+        return hash;
+    }
+
+    std::shared_ptr<const PrecomputationBundle> PrecomputationBundle::open(
+            const std::string &path) {
+        std::shared_ptr<PrecomputationBundle> bundle{new PrecomputationBundle{}};
+        const uint8_t *file;
+        std::size_t fileSize;
+#ifdef R2D2_PATHFINDING_MMAP
+        int descriptor = ::open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw std::runtime_error("cannot open bundle " + path);
+        }
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+            ::close(descriptor);
+            throw std::runtime_error("cannot read bundle " + path);
+        }
+        fileSize = std::size_t(status.st_size);
+        void *mapped = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE,
+                            descriptor, 0);
+        ::close(descriptor);
+        if (mapped == MAP_FAILED) {
+            throw std::runtime_error("cannot map bundle " + path);
+        }
+        bundle->mapping = mapped;
+        bundle->mappingSize = fileSize;
+        file = static_cast<const uint8_t *>(mapped);
+#else
+        std::ifstream in{path, std::ios::binary};
+        if (!in) {
+            throw std::runtime_error("cannot open bundle " + path);
+        }
+        bundle->buffer.assign(std::istreambuf_iterator<char>{in},
+                              std::istreambuf_iterator<char>{});
+        file = bundle->buffer.data();
+        fileSize = bundle->buffer.size();
+#endif
+
+        Header header;
+        if (fileSize < sizeof(header)) {
+            throw std::runtime_error("not a precomputation bundle");
+        }
+        std::memcpy(&header, file, sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("not a precomputation bundle");
+        }
+        if (header.byteOrder != ORDER_MARK) {
+            throw std::runtime_error("bundle has another byte order");
+        }
+        if (header.version != FORMAT_VERSION) {
+            throw std::runtime_error("unsupported bundle version");
+        }
+        if (header.sectionCount >
+            (fileSize - sizeof(header)) / sizeof(TableEntry)) {
+            throw std::runtime_error("bundle section table is truncated");
+        }
+        for (uint32_t i = 0; i < header.sectionCount; i++) {
+            TableEntry entry;
+            std::memcpy(&entry, file + sizeof(header) + i * sizeof(entry),
+                        sizeof(entry));
+            if (entry.offset % 8 != 0 || entry.offset > fileSize ||
+                entry.size > fileSize - entry.offset) {
+                throw std::runtime_error("bundle section out of range");
+            }
+            const uint8_t *data = file + entry.offset;
+            std::size_t size = std::size_t(entry.size);
+            if (hash_bytes(data, size) != entry.checksum) {
+                throw std::runtime_error("bundle section is corrupt");
+            }
+            bundle->sections.push_back(Section{
+                    std::string{entry.name, strnlen(entry.name, NAME_SIZE)},
+                    data, size, entry.mapHash,
+                    entry.hashCellSize * Length::METER, {}});
+        }
+        return bundle;
+    }
+
+    void PrecomputationBundle::save(const std::string &path) const {
+        std::ofstream out{path, std::ios::binary | std::ios::trunc};
+        Header header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = FORMAT_VERSION;
+        header.byteOrder = ORDER_MARK;
+        header.sectionCount = uint32_t(sections.size());
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+        std::size_t offset = align(sizeof(header) +
+                                   sections.size() * sizeof(TableEntry));
+        for (const Section &section : sections) {
+            std::size_t size;
+            const uint8_t *data = get_section(section.name, size);
+            TableEntry entry{};
+            std::memcpy(entry.name, section.name.data(),
+                        std::min(section.name.size(), NAME_SIZE - 1));
+            entry.offset = offset;
+            entry.size = size;
+            entry.checksum = hash_bytes(data, size);
+            entry.mapHash = section.mapHash;
+            entry.hashCellSize = section.hashCellSize / Length::METER;
+            out.write(reinterpret_cast<const char *>(&entry), sizeof(entry));
+            offset = align(offset + size);
+        }
+
+        const char padding[8] = {};
+        std::size_t written = sizeof(header) +
+                              sections.size() * sizeof(TableEntry);
+        for (const Section &section : sections) {
+            out.write(padding, std::streamsize(align(written) - written));
+            written = align(written);
+            std::size_t size;
+            const uint8_t *data = get_section(section.name, size);
+            out.write(reinterpret_cast<const char *>(data),
+                      std::streamsize(size));
+            written += size;
+        }
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("cannot write bundle " + path);
+        }
+    }
+
+    bool PrecomputationBundle::matches(ReadOnlyMap &map) const {
+        // sections of the same cell size share the hash of the map
+        std::vector<std::pair<double, uint64_t>> hashes;
+        for (const Section &section : sections) {
+            double cellSize = section.hashCellSize / Length::METER;
+            auto known = std::find_if(
+                    hashes.begin(), hashes.end(),
+                    [&](const std::pair<double, uint64_t> &hash) {
+                        return hash.first == cellSize;
+                    });
+            if (known == hashes.end()) {
+                hashes.emplace_back(cellSize, compute_map_hash(
+                        map, section.hashCellSize));
+                known = hashes.end() - 1;
+            }
+            if (known->second != section.mapHash) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void PrecomputationBundle::add_section(const std::string &name,
+                                           std::vector<uint8_t> data,
+                                           ReadOnlyMap &map,
+                                           Length hashCellSize) {
+        uint64_t mapHash = compute_map_hash(map, hashCellSize);
+        for (Section &section : sections) {
+            if (section.name == name) {
+                section.data = nullptr;
+                section.size = data.size();
+                section.mapHash = mapHash;
+                section.hashCellSize = hashCellSize;
+                section.owned = std::move(data);
+                return;
+            }
+        }
+        std::size_t size = data.size();
+        sections.push_back(Section{name.substr(0, NAME_SIZE - 1), nullptr,
+                                   size, mapHash, hashCellSize,
+                                   std::move(data)});
+    }
+
+    const uint8_t *PrecomputationBundle::get_section(const std::string &name,
+                                                     std::size_t &size) const {
+        for (const Section &section : sections) {
+            if (section.name == name) {
+                size = section.size;
+                return section.data != nullptr ? section.data :
+                       section.owned.data();
+            }
+        }
+        return nullptr;
+    }
+
+}
@@ -0,0 +1,271 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QuadTreeMap.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Region quadtree map
+//!
+//! A map stored as a region quadtree over grid cells.
+//! Every node knows which kinds of cells it contains, so box queries only
+//! descend into regions that are mixed.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/QuadTreeMap.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace r2d2 {
+
+    const uint8_t QuadTreeMap::HAS_FREE, QuadTreeMap::HAS_OBSTACLE,
+            QuadTreeMap::HAS_UNKNOWN;
+
+    QuadTreeMap::QuadTreeMap(const GridMap &grid) :
+            origin{},
+            cellSize{Length::METER},
+            width{0},
+            height{0},
+            leafCount{0},
+            nodes{},
+            version{0} {
+        assign(grid);
+    }
+
+    void QuadTreeMap::assign(const GridMap &grid) {
+        origin = grid.get_origin();
+        cellSize = grid.get_cell_size();
+        width = grid.get_width();
+        height = grid.get_height();
+        leafCount = 0;
+        nodes.clear();
+        if (width > 65536 || height > 65536) {
+            throw std::invalid_argument("grid too large for a quadtree");
+        }
+        if (width > 0 && height > 0) {
+            // the root is the smallest power of two square covering the grid
+            int level = 0;
+            while ((1 << level) < width || (1 << level) < height) {
+                level++;
+            }
+            nodes.push_back(QuadNode{-1, 0, 0, uint8_t(level), 0});
+            build(grid, 0);
+            nodes.shrink_to_fit();
+        }
+        version++;
+    }
+
+    void QuadTreeMap::build(const GridMap &grid, int node) {
+        // the nodes vector grows during the build, so nodes are only
+        // accessed through their index
+        int x = nodes[node].x, y = nodes[node].y, level = nodes[node].level;
+        if (x >= width || y >= height) {
+            // padding outside of the grid
+            nodes[node].contents = HAS_UNKNOWN;
+            leafCount++;
+            return;
+        }
+        if (level == 0) {
+            switch (grid.get_cell(x, y)) {
+                case GridMap::FREE:
+                    nodes[node].contents = HAS_FREE;
+                    break;
+                case GridMap::OBSTACLE:
+                    nodes[node].contents = HAS_OBSTACLE;
+                    break;
+                default:
+                    nodes[node].contents = HAS_UNKNOWN;
+            }
+            leafCount++;
+            return;
+        }
+
+        int first = int(nodes.size()), half = 1 << (level - 1);
+        for (int i = 0; i < 4; i++) {
+            nodes.push_back(QuadNode{-1, uint16_t(x + (i & 1) * half),
+                                     uint16_t(y + (i >> 1) * half),
+                                     uint8_t(level - 1), 0});
+        }
+        uint8_t contents = 0;
+        bool leaves = true;
+        for (int i = 0; i < 4; i++) {
+            build(grid, first + i);
+            contents |= nodes[first + i].contents;
+            leaves = leaves && nodes[first + i].children < 0;
+        }
+        nodes[node].contents = contents;
+        if (leaves && (contents & (contents - 1)) == 0) {
+            // four uniform children with the same value, which are the last
+            // nodes in the vector, are merged into this node
+            nodes.resize(std::size_t(first));
+            leafCount -= 3;
+        } else {
+            nodes[node].children = first;
+        }
+    }
+
+    int QuadTreeMap::find_cell(int x, int y) const {
+        if (x < 0 || y < 0 || x >= width || y >= height) {
+            return -1;
+        }
+        int node = 0;
+        while (nodes[node].children >= 0) {
+            int half = get_size(node) / 2;
+            node = nodes[node].children + (x >= nodes[node].x + half ? 1 : 0) +
+                   (y >= nodes[node].y + half ? 2 : 0);
+        }
+        return node;
+    }
+
+    int QuadTreeMap::find_leaf(const Coordinate &coord) const {
+        return find_cell(
+                int(std::floor((coord.get_x() - origin.get_x()) / cellSize)),
+                int(std::floor((coord.get_y() - origin.get_y()) / cellSize)));
+    }
+
+    void QuadTreeMap::get_adjacent_leaves(int leaf,
+                                          std::vector<int> &adjacent) const {
+        std::size_t begin = adjacent.size();
+        auto add = [&](int found) {
+            if (found >= 0 && std::find(adjacent.begin() + begin,
+                                        adjacent.end(), found) == adjacent.end()) {
+                adjacent.push_back(found);
+            }
+        };
+        const QuadNode &node = nodes[leaf];
+        int right = node.x + get_size(leaf), top = node.y + get_size(leaf);
+        // walk along the sides, skipping over the cells of larger neighbours
+        for (int y = node.y; y < top;) {
+            int found = find_cell(node.x - 1, y);
+            add(found);
+            int next = find_cell(right, y);
+            add(next);
+            y = std::min(found < 0 ? y + 1 : nodes[found].y + get_size(found),
+                         next < 0 ? y + 1 : nodes[next].y + get_size(next));
+        }
+        for (int x = node.x; x < right;) {
+            int found = find_cell(x, node.y - 1);
+            add(found);
+            int next = find_cell(x, top);
+            add(next);
+            x = std::min(found < 0 ? x + 1 : nodes[found].x + get_size(found),
+                         next < 0 ? x + 1 : nodes[next].x + get_size(next));
+        }
+        add(find_cell(node.x - 1, node.y - 1));
+        add(find_cell(right, node.y - 1));
+        add(find_cell(node.x - 1, top));
+        add(find_cell(right, top));
+    }
+
+    Box QuadTreeMap::get_leaf_box(int leaf) const {
+        const QuadNode &node = nodes[leaf];
+        return {origin + Translation{node.x * cellSize, node.y * cellSize,
+                                     0 * Length::METER},
+                Translation{get_size(leaf) * cellSize, get_size(leaf) * cellSize,
+                            0 * Length::METER}};
+    }
+
+    uint8_t QuadTreeMap::get_leaf_value(int leaf) const {
+        uint8_t contents = nodes[leaf].contents;
+        return contents == HAS_FREE ? GridMap::FREE :
+               contents == HAS_OBSTACLE ? GridMap::OBSTACLE :
+               GridMap::UNKNOWN;
+    }
+
+    std::size_t QuadTreeMap::get_memory_usage() const {
+        return sizeof(*this) + nodes.capacity() * sizeof(QuadNode);
+    }
+
+    const BoxInfo QuadTreeMap::get_box_info(const Box box) {
+        // the same cells are selected as by GridMap::get_box_info
+        int minX = int(std::floor((box.get_bottom_left().get_x() - origin.get_x()) / cellSize)),
+                minY = int(std::floor((box.get_bottom_left().get_y() - origin.get_y()) / cellSize)),
+                maxX = int(std::floor((box.get_top_right().get_x() - origin.get_x()) / cellSize)),
+                maxY = int(std::floor((box.get_top_right().get_y() - origin.get_y()) / cellSize));
+        uint8_t contents = 0;
+        // everything outside of the grid is unknown
+        if (minX < 0 || minY < 0 || maxX >= width || maxY >= height) {
+            contents |= HAS_UNKNOWN;
+        }
+        minX = std::max(minX, 0);
+        minY = std::max(minY, 0);
+        maxX = std::min(maxX, width - 1);
+        maxY = std::min(maxY, height - 1);
+        const uint8_t all = HAS_FREE | HAS_OBSTACLE | HAS_UNKNOWN;
+        // depth first over the nodes that overlap the box. a node that is a
+        // leaf or lies completely inside the box adds its contents without
+        // descending. the depth is at most 17, so three children per level
+        // fit on the stack
+        int stack[64];
+        int size = 0;
+        if (!nodes.empty() && minX <= maxX && minY <= maxY) {
+            stack[size++] = 0;
+        }
+        while (size > 0 && contents != all) {
+            const QuadNode &node = nodes[stack[--size]];
+            int right = node.x + (1 << node.level) - 1,
+                    top = node.y + (1 << node.level) - 1;
+            if (node.x > maxX || node.y > maxY || right < minX || top < minY ||
+                (node.contents | contents) == contents) {
+                // outside of the box, or nothing new to find
+                continue;
+            }
+            if (node.children < 0 ||
+                (node.x >= minX && node.y >= minY && right <= maxX &&
+                 top <= maxY)) {
+                contents |= node.contents;
+                continue;
+            }
+            for (int i = 0; i < 4; i++) {
+                stack[size++] = node.children + i;
+            }
+        }
+        return {(contents & HAS_OBSTACLE) != 0, (contents & HAS_FREE) != 0,
+                (contents & HAS_UNKNOWN) != 0};
+    }
+
+    const Box QuadTreeMap::get_map_bounding_box() {
+        return {origin, Translation{width * cellSize, height * cellSize,
+                                    0 * Length::METER}};
+    }
+
+    uint64_t QuadTreeMap::get_map_version() const {
+        return version;
+    }
+
+}
@@ -0,0 +1,237 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QuadTreePathFinder.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Pathfinder over quadtree leaves
+//!
+//! Searches over the free leaves of a quadtree instead of a regular lattice,
+//! so open areas take only a few search nodes.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/QuadTreePathFinder.hpp"
+#include <cmath>
+
+namespace r2d2 {
+
+    QuadTreePathFinder::QuadTreePathFinder(SharedObject<ReadOnlyMap> &map,
+                                           Box robotBox, Length cellSize) :
+            PathFinder{map, robotBox},
+            mapAccess{map},
+            robotBox{robotBox.get_axis_size()},
+            cellSize{cellSize},
+            freeSpaceMutex{},
+            freeSpace{},
+            freeSpaceVersion{0} {
+    }
+
+    bool QuadTreePathFinder::get_path_to_coordinate(
+            Coordinate start, Coordinate goal, std::vector<Coordinate> &path) {
+        if ((start - goal).get_length() / Length::METER == 0) {
+            path.clear();
+            return true;
+        }
+
+        MapAccessGroup::Lease lease{mapAccess};
+        std::shared_ptr<const QuadTreeMap> space{get_free_space(lease.access())};
+        int startLeaf = space->find_leaf(start),
+                goalLeaf = space->find_leaf(goal);
+        if (startLeaf < 0 || goalLeaf < 0 ||
+            space->get_leaf_value(startLeaf) != GridMap::FREE ||
+            space->get_leaf_value(goalLeaf) != GridMap::FREE) {
+            return false;
+        }
+        path.assign(1, goal);
+        if (startLeaf == goalLeaf) {
+            return true;
+        }
+
+        // search from the goal towards the start, like AStarPathFinder
+        SearchContext context{*space, start, startLeaf, {}};
+        LeafNode endNode{context, goalLeaf, goal, goal, 0 * Length::METER},
+                startNode{context, startLeaf, start, start};
+        AStarSearch<LeafNode> search{endNode};
+        std::shared_ptr<LeafNode> found = search.search(startNode);
+        if (found == nullptr) {
+            return false;
+        }
+
+        path.clear();
+        std::shared_ptr<LeafNode> node = found;
+        path.push_back(node->portal);
+        while (!node->parent.expired()) {
+            node = std::shared_ptr<LeafNode>(node->parent);
+            path.push_back(node->point);
+            if (!node->parent.expired()) {
+                path.push_back(node->portal);
+            }
+        }
+        smooth_path(lease.access(), path, start);
+        return true;
+    }
+
+    std::shared_ptr<const QuadTreeMap> QuadTreePathFinder::get_free_space() {
+        MapAccessGroup::Lease lease{mapAccess};
+        return get_free_space(lease.access());
+    }
+
+    std::shared_ptr<const QuadTreeMap> QuadTreePathFinder::get_free_space(
+            ReadOnlyMap &map) {
+        uint64_t version = VersionedMap::get_version_of(map);
+        std::lock_guard<std::mutex> lock{freeSpaceMutex};
+        if (freeSpace != nullptr && freeSpaceVersion == version) {
+            return freeSpace;
+        }
+
+        Box bounds{map.get_map_bounding_box()};
+        Length size = cellSize;
+        QuadTreeMap *tree = dynamic_cast<QuadTreeMap *>(&map);
+        if (tree != nullptr) {
+            size = tree->get_cell_size();
+        }
+        Translation axis{bounds.get_axis_size()};
+        GridMap grid{bounds.get_bottom_left(), size,
+                     int(std::ceil(axis.get_x() / size)),
+                     int(std::ceil(axis.get_y() / size))};
+        // a cell is free when the robot fits on all of its positions, so
+        // the robot box is added around the cell
+        Translation cell{size, size, 0 * Length::METER};
+        std::vector<uint8_t> cells;
+        cells.reserve(std::size_t(grid.get_width()) *
+                      std::size_t(grid.get_height()));
+        for (int y = 0; y < grid.get_height(); y++) {
+            for (int x = 0; x < grid.get_width(); x++) {
+                Coordinate corner{grid.get_origin() + Translation{
+                        x * size, y * size, 0 * Length::METER}};
+                BoxInfo info{map.get_box_info(
+                        Box{corner - robotBox / 2, corner + cell + robotBox / 2})};
+                cells.push_back(info.get_has_obstacle() ||
+                                info.get_has_unknown() ?
+                                GridMap::OBSTACLE : GridMap::FREE);
+            }
+        }
+        grid.set_cells(std::move(cells));
+        freeSpace = std::make_shared<const QuadTreeMap>(grid);
+        freeSpaceVersion = version;
+        return freeSpace;
+    }
+
+    QuadTreePathFinder::LeafNode::LeafNode(
+            SearchContext &context, int leaf, Coordinate point,
+            Coordinate portal, Length g, std::weak_ptr<LeafNode> parent) :
+            Node{g, (context.start - point).get_length(), parent},
+            context(context),
+            leaf{leaf},
+            point(point),
+            portal(portal) {
+    }
+
+    bool QuadTreePathFinder::LeafNode::operator==(
+            const QuadTreePathFinder::LeafNode &lhs) const {
+        return leaf == lhs.leaf;
+    }
+
+    std::vector<QuadTreePathFinder::LeafNode>
+    QuadTreePathFinder::LeafNode::get_available_nodes(
+            std::shared_ptr<QuadTreePathFinder::LeafNode> &self) {
+        SearchContext &search = context.get();
+        std::vector<int> &adjacent = search.adjacent;
+        adjacent.clear();
+        search.space.get_adjacent_leaves(leaf, adjacent);
+
+        Box box{search.space.get_leaf_box(leaf)};
+        std::vector<LeafNode> children;
+        for (int next : adjacent) {
+            if (search.space.get_leaf_value(next) != GridMap::FREE) {
+                continue;
+            }
+            // both parts of the move stay within a free leaf
+            Box nextBox{search.space.get_leaf_box(next)};
+            Coordinate border{get_portal(box, nextBox)},
+                    nextPoint{next == search.startLeaf ? search.start :
+                              nextBox.get_bottom_left() +
+                              nextBox.get_axis_size() / 2};
+            children.push_back(LeafNode{
+                    search, next, nextPoint, border,
+                    g + (border - point).get_length() +
+                    (nextPoint - border).get_length(), self});
+        }
+        return children;
+    }
+
+    bool QuadTreePathFinder::can_travel(ReadOnlyMap &map,
+                                        const Coordinate &from,
+                                        const Coordinate &to) const {
+        Coordinate minCoord{
+                (from.get_x() < to.get_x() ? from.get_x() : to.get_x()),
+                (from.get_y() < to.get_y() ? from.get_y() : to.get_y()),
+                0 * Length::METER};
+        Translation size{(Coordinate{
+                (from.get_x() > to.get_x() ? from.get_x() : to.get_x()),
+                (from.get_y() > to.get_y() ? from.get_y() : to.get_y()),
+                0 * Length::METER} - minCoord) + robotBox};
+        BoxInfo info{map.get_box_info(Box{minCoord - (robotBox / 2), size})};
+        return !(info.get_has_obstacle() || info.get_has_unknown());
+    }
+
+    Coordinate QuadTreePathFinder::get_portal(const Box &a, const Box &b) {
+        // the overlap of touching boxes is a line along a side, or a corner
+        Length minX = std::max(a.get_bottom_left().get_x(), b.get_bottom_left().get_x()),
+                minY = std::max(a.get_bottom_left().get_y(), b.get_bottom_left().get_y()),
+                maxX = std::min(a.get_top_right().get_x(), b.get_top_right().get_x()),
+                maxY = std::min(a.get_top_right().get_y(), b.get_top_right().get_y());
+        return {(minX + maxX) / 2, (minY + maxY) / 2, 0 * Length::METER};
+    }
+
+    void QuadTreePathFinder::smooth_path(ReadOnlyMap &map,
+                                         std::vector<Coordinate> &path,
+                                         Coordinate start) const {
+        Coordinate anchor = start;
+        std::size_t i = 0;
+        while (i + 1 < path.size()) {
+            if (can_travel(map, anchor, path[i + 1])) {
+                path.erase(path.begin() + i);
+            } else {
+                anchor = path[i];
+                i++;
+            }
+        }
+    }
+
+}
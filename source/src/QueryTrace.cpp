@@ -0,0 +1,289 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QueryTrace.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Query trace recording
+//!
+//! Binary trace of map states and pathfinding queries.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/QueryTrace.hpp"
+#include <cstring>
+#include <stdexcept>
+
+namespace r2d2 {
+
+    namespace {
+
+        const char MAGIC[4] = {'R', '2', 'P', 'T'};
+
+        const uint8_t RECORD_SNAPSHOT = 1, RECORD_DELTA = 2, RECORD_QUERY = 3;
+
+        //! the largest snapshot a reader accepts, so a corrupt size does not
+        //! make it allocate the whole memory
+        const uint64_t MAX_SNAPSHOT_SIDE = uint64_t(1) << 16,
+                MAX_SNAPSHOT_CELLS = uint64_t(1) << 28;
+
+        void write_u8(std::ostream &out, uint8_t value) {
+            out.put(char(value));
+        }
+
+        void write_varint(std::ostream &out, uint64_t value) {
+            while (value >= 0x80) {
+                write_u8(out, uint8_t(value | 0x80));
+                value >>= 7;
+            }
+            write_u8(out, uint8_t(value));
+        }
+
+        void write_double(std::ostream &out, double value) {
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            for (int i = 0; i < 8; i++) {
+                write_u8(out, uint8_t(bits >> (i * 8)));
+            }
+        }
+
+        void write_length(std::ostream &out, Length length) {
+            write_double(out, length / Length::METER);
+        }
+
+        uint8_t read_u8(std::istream &in) {
+            int value = in.get();
+            if (value == std::char_traits<char>::eof()) {
+                throw std::runtime_error("unexpected end of trace");
+            }
+            return uint8_t(value);
+        }
+
+        uint64_t read_varint(std::istream &in) {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                uint8_t byte = read_u8(in);
+                value |= uint64_t(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) {
+                    return value;
+                }
+            }
+            throw std::runtime_error("invalid varint in trace");
+        }
+
+        double read_double(std::istream &in) {
+            uint64_t bits = 0;
+            for (int i = 0; i < 8; i++) {
+                bits |= uint64_t(read_u8(in)) << (i * 8);
+            }
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        Length read_length(std::istream &in) {
+            return read_double(in) * Length::METER;
+        }
+
+    }
+
+    const uint32_t QueryTraceWriter::FORMAT_VERSION;
+
+    QueryTraceWriter::QueryTraceWriter(std::ostream &out) :
+            mutex{},
+            out(out),
+            started{std::chrono::steady_clock::now()},
+            last{},
+            hasMap{false} {
+        out.write(MAGIC, sizeof(MAGIC));
+        write_varint(out, FORMAT_VERSION);
+    }
+
+    void QueryTraceWriter::write_map(const GridMap &map) {
+        std::lock_guard<std::mutex> lock{mutex};
+        const std::vector<uint8_t> &cells = map.get_cells();
+        bool sameGeometry = hasMap &&
+                            map.get_width() == last.get_width() &&
+                            map.get_height() == last.get_height() &&
+                            map.get_cell_size() / Length::METER ==
+                            last.get_cell_size() / Length::METER &&
+                            (map.get_origin() - last.get_origin()).get_length() /
+                            Length::METER == 0;
+        if (sameGeometry) {
+            std::vector<uint32_t> changed;
+            for (std::size_t i = 0; i < cells.size(); i++) {
+                if (cells[i] != last.get_cells()[i]) {
+                    changed.push_back(uint32_t(i));
+                }
+            }
+            // a delta costs a few bytes per cell, a snapshot usually a lot
+            // less than a byte per cell, so deltas only pay off when small
+            if (changed.size() * 16 < cells.size()) {
+                write_u8(out, RECORD_DELTA);
+                write_varint(out, changed.size());
+                uint32_t previous = 0;
+                for (uint32_t index : changed) {
+                    write_varint(out, index - previous);
+                    write_u8(out, cells[index]);
+                    previous = index;
+                }
+                last.set_cells(cells);
+                out.flush();
+                return;
+            }
+        }
+
+        write_u8(out, RECORD_SNAPSHOT);
+        write_length(out, map.get_origin().get_x());
+        write_length(out, map.get_origin().get_y());
+        write_length(out, map.get_cell_size());
+        write_varint(out, uint64_t(map.get_width()));
+        write_varint(out, uint64_t(map.get_height()));
+        for (std::size_t i = 0; i < cells.size();) {
+            std::size_t run = 1;
+            while (i + run < cells.size() && cells[i + run] == cells[i]) {
+                run++;
+            }
+            write_varint(out, run);
+            write_u8(out, cells[i]);
+            i += run;
+        }
+        last.assign(map.get_origin(), map.get_cell_size(), map.get_width(),
+                    map.get_height(), cells);
+        hasMap = true;
+        out.flush();
+    }
+
+    void QueryTraceWriter::write_query(const TraceQuery &query) {
+        std::lock_guard<std::mutex> lock{mutex};
+        write_u8(out, RECORD_QUERY);
+        write_length(out, query.start.get_x());
+        write_length(out, query.start.get_y());
+        write_length(out, query.goal.get_x());
+        write_length(out, query.goal.get_y());
+        write_length(out, query.robotBox.get_x());
+        write_length(out, query.robotBox.get_y());
+        write_u8(out, query.found ? 1 : 0);
+        write_varint(out, query.pathLength);
+        write_varint(out, query.durationNs);
+        write_varint(out, query.timestampNs);
+        out.flush();
+    }
+
+    uint64_t QueryTraceWriter::get_timestamp() const {
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - started).count());
+    }
+
+    QueryTraceReader::QueryTraceReader(std::istream &in) :
+            in(in),
+            map{},
+            query{} {
+        char magic[sizeof(MAGIC)];
+        in.read(magic, sizeof(magic));
+        if (!in || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("not a query trace");
+        }
+        if (read_varint(in) != QueryTraceWriter::FORMAT_VERSION) {
+            throw std::runtime_error("unsupported query trace version");
+        }
+    }
+
+    QueryTraceReader::Record QueryTraceReader::next() {
+        int type = in.get();
+        if (type == std::char_traits<char>::eof()) {
+            return Record::END;
+        }
+        switch (type) {
+            case RECORD_SNAPSHOT: {
+                Length x{read_length(in)}, y{read_length(in)},
+                        cellSize{read_length(in)};
+                uint64_t width = read_varint(in), height = read_varint(in);
+                if (!(cellSize > 0 * Length::METER) || width == 0 ||
+                    height == 0 || width > MAX_SNAPSHOT_SIDE ||
+                    height > MAX_SNAPSHOT_SIDE ||
+                    width * height > MAX_SNAPSHOT_CELLS) {
+                    throw std::runtime_error("invalid map snapshot size");
+                }
+                std::size_t count = std::size_t(width * height);
+                std::vector<uint8_t> cells;
+                cells.reserve(count);
+                while (cells.size() < count) {
+                    uint64_t run = read_varint(in);
+                    uint8_t value = read_u8(in);
+                    if (run > count - cells.size()) {
+                        throw std::runtime_error("map snapshot overflows");
+                    }
+                    cells.insert(cells.end(), std::size_t(run), value);
+                }
+                map.assign(Coordinate{x, y, 0 * Length::METER}, cellSize,
+                           int(width), int(height), std::move(cells));
+                return Record::MAP;
+            }
+            case RECORD_DELTA: {
+                std::vector<uint8_t> cells{map.get_cells()};
+                uint64_t count = read_varint(in), index = 0;
+                for (uint64_t i = 0; i < count; i++) {
+                    index += read_varint(in);
+                    uint8_t value = read_u8(in);
+                    if (index >= cells.size()) {
+                        throw std::runtime_error("map delta out of range");
+                    }
+                    cells[std::size_t(index)] = value;
+                }
+                map.set_cells(std::move(cells));
+                return Record::MAP;
+            }
+            case RECORD_QUERY: {
+                Length sx{read_length(in)}, sy{read_length(in)},
+                        gx{read_length(in)}, gy{read_length(in)},
+                        rx{read_length(in)}, ry{read_length(in)};
+                query.start = Coordinate{sx, sy, 0 * Length::METER};
+                query.goal = Coordinate{gx, gy, 0 * Length::METER};
+                query.robotBox = Translation{rx, ry, 0 * Length::METER};
+                query.found = read_u8(in) != 0;
+                query.pathLength = uint32_t(read_varint(in));
+                query.durationNs = read_varint(in);
+                query.timestampNs = read_varint(in);
+                return Record::QUERY;
+            }
+            default:
+                throw std::runtime_error("unknown record in query trace");
+        }
+    }
+
+}
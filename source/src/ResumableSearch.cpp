@@ -0,0 +1,525 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ResumableSearch.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Goal rooted search kept between queries
+//!
+//! A lattice search from a goal that answers queries from successive starts,
+//! continuing where the previous query stopped.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/AStarPathFinder.hpp"
+#include "../include/BatchedMap.hpp"
+#include "../include/Tracing.hpp"
+#include "../include/VersionedMap.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace r2d2 {
+
+    /**
+     * A* over the search lattice from a goal, that can be kept between
+     * queries
+     *
+     * a kept search has a workspace of its own, a search for a single query
+     * uses the workspace of its thread. the search never ends at a start, a
+     * start is connected to the lattice nodes around it instead. with a
+     * consistent heuristic, every node is expanded with its final cost,
+     * whichever start the heuristic pointed to at the time. a query is
+     * answered once the lattice node closest to its start is expanded, once
+     * all nodes around the start are, or once the open list proves that no
+     * cheaper path exists.
+     * before continuing towards another start, the open list is ordered
+     * again with the heuristic towards that start.
+     * with lazy collision checking, a node is checked against its parent
+     * only when it is taken from the open list, see
+     * AStarPathFinder::set_collision_checking. closed nodes are always
+     * checked, so their cost stays final.
+     * a heuristic weight above one makes the heuristic inconsistent. closed
+     * nodes are not opened again, so their cost can be up to the weight
+     * times too high, and so can the paths.
+     */
+    class AStarPathFinder::ResumableSearch {
+    public:
+        /**
+         * \param borrowedWorkspace the workspace to search in, which the
+         * search has to itself until it is destroyed, or nullptr to give the
+         * search a workspace of its own, so it can be kept
+         */
+        ResumableSearch(const AStarPathFinder &pathFinder, Coordinate goal,
+                        uint64_t mapVersion,
+                        std::shared_ptr<const ConnectivityIndex> connectivity,
+                        int component, SearchSettings settings,
+                        SearchWorkspace *borrowedWorkspace);
+
+        /**
+         * whether the search can answer queries towards a goal
+         *
+         * a search made before the connectivity index was there skips no
+         * nodes, so it stays valid once the index is made in the background
+         */
+        bool is_for(const Coordinate &otherGoal, uint64_t otherVersion,
+                    const std::shared_ptr<const ConnectivityIndex> &index,
+                    const SearchSettings &otherSettings) const {
+            return (otherGoal - goal).get_length() / Length::METER == 0 &&
+                   otherVersion == mapVersion &&
+                   (connectivity == nullptr || index == connectivity) &&
+                   otherSettings == settings;
+        }
+
+        const Coordinate &get_goal() const {
+            return goal;
+        }
+
+        const SearchSettings &get_settings() const {
+            return settings;
+        }
+
+        /**
+         * answer a query, continuing the search when needed
+         *
+         * \param map the map to search on, of the version the search is for
+         * \param start the start coordinate, in the component of the goal
+         * \param path receives the unsmoothed path without the start, ending
+         * at the goal
+         * \param token the token that is checked once per expanded node
+         * \param maxNodes the amount of nodes expanded before giving up
+         * \param expandedNodes receives the amount of expanded nodes
+         * \return whether a path was found
+         */
+        bool find(ReadOnlyMap &map, Coordinate start,
+                  std::vector<Coordinate> &path,
+                  const CancellationToken &token, int maxNodes,
+                  int &expandedNodes);
+
+        /**
+         * get the memory held by the workspace of the search
+         *
+         * \return the size in bytes
+         */
+        std::size_t get_memory_usage() const {
+            return workspace.get_memory_usage();
+        }
+
+        //! held by the query that uses the search
+        std::mutex mutex;
+        //! the memory of the search after its last query, guarded by the
+        //! resumableMutex of the pathfinder
+        std::size_t keptMemory;
+
+    private:
+        typedef SearchWorkspace::Key Key;
+
+        /**
+         * a lattice node the start can be reached from
+         */
+        struct Entry {
+            Key key;
+            //! the cost from the node to the start
+            double cost;
+            bool closed;
+        };
+
+        const AStarPathFinder &pathFinder;
+        const Coordinate goal;
+        const uint64_t mapVersion;
+        const std::shared_ptr<const ConnectivityIndex> connectivity;
+        const int component;
+        const SearchSettings settings;
+        //! whether the open nodes are checked when they are expanded
+        const bool lazy;
+        const double weight;
+        const Translation step;
+        const std::unique_ptr<SearchWorkspace> ownWorkspace;
+        SearchWorkspace &workspace;
+        //! the start the open list is ordered for
+        Coordinate target;
+        bool hasTarget;
+
+        Coordinate get_coordinate(Key key) const {
+            return goal + Translation{
+                    SearchWorkspace::get_key_x(key) * step.get_x(),
+                    SearchWorkspace::get_key_y(key) * step.get_y(),
+                    0 * Length::METER};
+        }
+
+        void expand(BoxBatch &batch, const SearchWorkspace::OpenNode &node);
+
+        /**
+         * give a node whose edge from its parent is blocked the cheapest
+         * expanded neighbour it can be reached from as parent, and open it
+         * again, or drop it when there is none
+         */
+        void reconnect(ReadOnlyMap &map, Key key);
+    };
+
+    AStarPathFinder::ResumableSearch::ResumableSearch(
+            const AStarPathFinder &pathFinder, Coordinate goal,
+            uint64_t mapVersion,
+            std::shared_ptr<const ConnectivityIndex> connectivity,
+            int component, SearchSettings settings,
+            SearchWorkspace *borrowedWorkspace) :
+            mutex{},
+            keptMemory{0},
+            pathFinder(pathFinder),
+            goal{goal},
+            mapVersion{mapVersion},
+            connectivity{connectivity},
+            component{component},
+            settings(settings),
+            lazy{settings.collisionChecking == CollisionChecking::LAZY},
+            weight{settings.heuristicWeight},
+            step{pathFinder.robotBox *
+                 (settings.latticeScale / SQUARES_PER_ROBOT)},
+            ownWorkspace{borrowedWorkspace == nullptr ? new SearchWorkspace{} :
+                         nullptr},
+            workspace(borrowedWorkspace == nullptr ? *ownWorkspace :
+                      *borrowedWorkspace),
+            target{goal},
+            hasTarget{false} {
+        workspace.reset();
+        Key goalKey = SearchWorkspace::make_key(0, 0);
+        workspace.insert(goalKey).g = 0;
+        // the f is set when the first start is known
+        workspace.push({0, 0, goalKey});
+    }
+
+    bool AStarPathFinder::ResumableSearch::find(
+            ReadOnlyMap &map, Coordinate start, std::vector<Coordinate> &path,
+            const CancellationToken &token, int maxNodes,
+            int &expandedNodes) {
+        R2D2_TRACE_SCOPE(search, "resumed search");
+        expandedNodes = 0;
+        if (!hasTarget || (start - target).get_length() / Length::METER != 0) {
+            workspace.retarget([&](Key key) {
+                return weight * get_heuristic(start - get_coordinate(key)) /
+                       Length::METER;
+            });
+            target = start;
+            hasTarget = true;
+        }
+
+        // the start is reached from the closest lattice node and the ones
+        // around it
+        Translation offset{start - goal};
+        int centerX = int(std::floor(offset.get_x() / step.get_x() + .5)),
+                centerY = int(std::floor(offset.get_y() / step.get_y() + .5));
+        Entry entries[9];
+        int entryCount = 0;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                Key key = SearchWorkspace::make_key(centerX + dx,
+                                                    centerY + dy);
+                Coordinate position{get_coordinate(key)};
+                if ((connectivity != nullptr &&
+                     connectivity->get_component(position) != component) ||
+                    !pathFinder.can_travel(map, position, start)) {
+                    continue;
+                }
+                SearchWorkspace::Visited *visited = workspace.find(key);
+                entries[entryCount++] = Entry{
+                        key, get_heuristic(start - position) / Length::METER,
+                        visited != nullptr && visited->closed};
+            }
+        }
+
+        double best = std::numeric_limits<double>::infinity();
+        Key bestEntry = SearchWorkspace::NO_KEY;
+        // a start whose closest node is expanded is settled, like the
+        // start replaced the closest node in a search towards it
+        Key centerKey = SearchWorkspace::make_key(centerX, centerY);
+        SearchWorkspace::Visited *center = workspace.find(centerKey);
+        bool settled = center != nullptr && center->closed;
+        int unexpanded = 0;
+        for (int i = 0; i < entryCount; i++) {
+            const Entry &entry = entries[i];
+            if (entry.closed) {
+                double cost = workspace.find(entry.key)->g + entry.cost;
+                if (cost < best) {
+                    best = cost;
+                    bestEntry = entry.key;
+                }
+            } else {
+                unexpanded++;
+            }
+        }
+
+        BoxBatch batch{map};
+        // every path to the start through a node that is not expanded costs
+        // at least the lowest f of the open list
+        const SearchWorkspace::OpenNode *next;
+        while ((!settled || bestEntry == SearchWorkspace::NO_KEY) &&
+               unexpanded > 0 && (next = workspace.peek()) != nullptr &&
+               next->f < best) {
+            if (expandedNodes >= maxNodes || token.is_cancelled()) {
+                return false;
+            }
+            SearchWorkspace::OpenNode current;
+            workspace.pop(current);
+            SearchWorkspace::Visited *visited = workspace.find(current.key);
+            // skip nodes that were reached another way after being opened
+            if (visited->closed || current.g != visited->g) {
+                continue;
+            }
+            if (lazy && visited->parent != SearchWorkspace::NO_KEY &&
+                !pathFinder.can_travel(map, get_coordinate(visited->parent),
+                                       get_coordinate(current.key))) {
+                reconnect(map, current.key);
+                continue;
+            }
+            visited->closed = true;
+            expandedNodes++;
+            R2D2_TRACE_CHUNK(search);
+            for (int i = 0; i < entryCount; i++) {
+                Entry &entry = entries[i];
+                if (entry.key == current.key) {
+                    entry.closed = true;
+                    unexpanded--;
+                    if (current.g + entry.cost < best) {
+                        best = current.g + entry.cost;
+                        bestEntry = entry.key;
+                    }
+                }
+            }
+            settled = settled || current.key == centerKey;
+            expand(batch, current);
+        }
+        if (bestEntry == SearchWorkspace::NO_KEY) {
+            return false;
+        }
+
+        R2D2_TRACE_END(search);
+        R2D2_TRACE_SCOPE(extract, "extract path");
+        path.clear();
+        for (Key key = bestEntry; key != SearchWorkspace::NO_KEY;
+             key = workspace.find(key)->parent) {
+            path.push_back(get_coordinate(key));
+        }
+        return true;
+    }
+
+    void AStarPathFinder::ResumableSearch::expand(
+            BoxBatch &batch, const SearchWorkspace::OpenNode &node) {
+        Coordinate coord{get_coordinate(node.key)};
+        int x = SearchWorkspace::get_key_x(node.key),
+                y = SearchWorkspace::get_key_y(node.key);
+        Key childKeys[8];
+        Coordinate childPositions[8];
+        int childCount = 0;
+        batch.clear();
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                if (dx == 0 && dy == 0) {
+                    continue;
+                }
+                Key childKey = SearchWorkspace::make_key(x + dx, y + dy);
+                SearchWorkspace::Visited *known = workspace.find(childKey);
+                // an expanded node already has its final cost, skip the
+                // map query
+                if (known != nullptr && known->closed) {
+                    continue;
+                }
+                Coordinate childPos{get_coordinate(childKey)};
+                if (connectivity != nullptr &&
+                    connectivity->get_component(childPos) != component) {
+                    continue;
+                }
+                childKeys[childCount] = childKey;
+                childPositions[childCount++] = childPos;
+                if (!lazy) {
+                    batch.add(pathFinder.get_travel_box(coord, childPos));
+                }
+            }
+        }
+        // the eager moves are checked in one batch
+        if (!lazy) {
+            batch.query();
+        }
+        for (int i = 0; i < childCount; i++) {
+            if (!lazy && !is_clear(batch.get_info(std::size_t(i)))) {
+                continue;
+            }
+            double g = node.g + get_heuristic(childPositions[i] - coord) /
+                                Length::METER;
+            SearchWorkspace::Visited &child = workspace.insert(childKeys[i]);
+            if (g < child.g) {
+                child.g = g;
+                child.parent = node.key;
+                workspace.push({g + weight * get_heuristic(
+                        target - childPositions[i]) / Length::METER, g,
+                                childKeys[i]});
+            }
+        }
+    }
+
+    void AStarPathFinder::ResumableSearch::reconnect(ReadOnlyMap &map,
+                                                     Key key) {
+        Coordinate coord{get_coordinate(key)};
+        int x = SearchWorkspace::get_key_x(key),
+                y = SearchWorkspace::get_key_y(key);
+        // the expanded neighbours, cheapest first, so the first one that
+        // can be travelled from is the best
+        std::pair<double, Key> parents[8];
+        int parentCount = 0;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                Key neighbourKey = SearchWorkspace::make_key(x + dx, y + dy);
+                SearchWorkspace::Visited *neighbour =
+                        workspace.find(neighbourKey);
+                if ((dx != 0 || dy != 0) && neighbour != nullptr &&
+                    neighbour->closed) {
+                    parents[parentCount++] = {
+                            neighbour->g + get_heuristic(
+                                    coord - get_coordinate(neighbourKey)) /
+                                           Length::METER, neighbourKey};
+                }
+            }
+        }
+        std::sort(parents, parents + parentCount);
+
+        SearchWorkspace::Visited *visited = workspace.find(key);
+        visited->g = std::numeric_limits<double>::infinity();
+        visited->parent = SearchWorkspace::NO_KEY;
+        for (int i = 0; i < parentCount; i++) {
+            if (pathFinder.can_travel(map, get_coordinate(parents[i].second),
+                                      coord)) {
+                visited->g = parents[i].first;
+                visited->parent = parents[i].second;
+                workspace.push({visited->g + weight * get_heuristic(
+                        target - coord) / Length::METER, visited->g, key});
+                return;
+            }
+        }
+    }
+
+    bool AStarPathFinder::find_path_resumed(ReadOnlyMap &map,
+                                            Coordinate start, Coordinate goal,
+                                            std::vector<Coordinate> &path,
+                                            const CancellationToken &token,
+                                            const SearchSettings &settings,
+                                            int &expandedNodes) {
+        expandedNodes = 0;
+        if (overlaps(start, goal)) {
+            path.clear();
+            return true;
+        }
+        if (!can_travel(map, goal, goal)) {
+            return false;
+        }
+        std::shared_ptr<const ConnectivityIndex> index{get_connectivity(map)};
+        int component;
+        if (!is_connected(index.get(), start, goal, component)) {
+            return false;
+        }
+
+        uint64_t version = VersionedMap::get_version_of(map);
+        std::size_t budget = keptSearchBudget;
+        std::shared_ptr<ResumableSearch> kept;
+        // a search kept for a map without a version could be answering
+        // from a map that has changed since
+        if (budget > 0 && VersionedMap::is_versioned(map)) {
+            std::lock_guard<std::mutex> lock{resumableMutex};
+            for (auto it = resumableSearches.begin();
+                 it != resumableSearches.end(); ++it) {
+                if (((*it)->get_goal() - goal).get_length() / Length::METER ==
+                    0 && (*it)->get_settings() == settings) {
+                    if ((*it)->is_for(goal, version, index, settings)) {
+                        kept = *it;
+                    }
+                    // an outdated search is replaced
+                    resumableSearches.erase(it);
+                    break;
+                }
+            }
+            if (kept == nullptr) {
+                kept = std::make_shared<ResumableSearch>(
+                        *this, goal, version, index, component, settings,
+                        nullptr);
+            }
+            resumableSearches.push_back(kept);
+            if (int(resumableSearches.size()) > MAX_RESUMABLE_SEARCHES) {
+                resumableSearches.erase(resumableSearches.begin());
+            }
+        }
+
+        // only one query at a time continues a kept search, the queries
+        // towards the same goal that run meanwhile search anew
+        std::unique_lock<std::mutex> keptLock;
+        if (kept != nullptr) {
+            keptLock = std::unique_lock<std::mutex>{kept->mutex,
+                                                    std::try_to_lock};
+        }
+        bool found;
+        if (keptLock.owns_lock()) {
+            found = kept->find(map, start, path, token, MAX_SEARCH_NODES,
+                               expandedNodes);
+            std::size_t memory = kept->get_memory_usage();
+            keptLock.unlock();
+
+            // the least recently used searches are dropped until the others
+            // fit in the budget, which can be this one as well
+            std::lock_guard<std::mutex> lock{resumableMutex};
+            kept->keptMemory = memory;
+            std::size_t total = 0;
+            for (const std::shared_ptr<ResumableSearch> &search :
+                    resumableSearches) {
+                total += search->keptMemory;
+            }
+            while (total > budget) {
+                total -= resumableSearches.front()->keptMemory;
+                resumableSearches.erase(resumableSearches.begin());
+            }
+        } else {
+            ResumableSearch search{*this, goal, version, index, component,
+                                   settings,
+                                   &SearchWorkspace::get_thread_workspace()};
+            found = search.find(map, start, path, token, MAX_SEARCH_NODES,
+                                expandedNodes);
+        }
+        if (!found) {
+            return false;
+        }
+        smooth_path(map, path, start);
+        return true;
+    }
+
+}
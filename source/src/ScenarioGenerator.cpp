@@ -0,0 +1,416 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ScenarioGenerator.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Seeded procedural maps for performance testing
+//!
+//! Generates maps of several kinds from a seed, the same on every machine
+//! and for any amount of threads, with solvable queries and their costs.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/ScenarioGenerator.hpp"
+#include "../include/ParallelFor.hpp"
+#include <cmath>
+#include <queue>
+#include <unordered_map>
+
+namespace r2d2 {
+
+    namespace {
+
+        const int ROOM_SIZE = 16, DOOR_SIZE = 3;
+        const int MAZE_PERIOD = 4;
+        const int CORRIDOR_PERIOD = 8, CORRIDOR_WIDTH = 2;
+        //! the chance that a corridor that is not needed is still there
+        const double CORRIDOR_LOOPS = .2;
+        const int RACK_PERIOD_X = 15, RACK_LENGTH = 12,
+                RACK_PERIOD_Y = 4, RACK_DEPTH = 2;
+        const double RACK_PRESENT = .9;
+
+        //! the salts of the decisions made from the hash
+        enum Salt : uint64_t {
+            CELL = 1, VERTICAL_DOOR, HORIZONTAL_DOOR, OPENING, EAST_LOOP,
+            NORTH_LOOP, COARSE_NOISE, FINE_NOISE, RACK, QUERY_START,
+            QUERY_GOAL
+        };
+
+        const double SQRT_2 = 1.4142135623730951;
+
+        uint64_t mix(uint64_t z) {
+            // the finalizer of splitmix64
+            z += 0x9E3779B97F4A7C15ull;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        double smooth(double t) {
+            return t * t * (3 - 2 * t);
+        }
+
+    }
+
+    const char *get_scenario_kind_name(ScenarioKind kind) {
+        switch (kind) {
+            case ScenarioKind::RANDOM:
+                return "random";
+            case ScenarioKind::ROOMS:
+                return "rooms";
+            case ScenarioKind::MAZE:
+                return "maze";
+            case ScenarioKind::CAVES:
+                return "caves";
+            case ScenarioKind::WAREHOUSE:
+                return "warehouse";
+            default:
+                return "corridors";
+        }
+    }
+
+    bool parse_scenario_kind(const std::string &name, ScenarioKind &kind) {
+        for (ScenarioKind candidate : {ScenarioKind::RANDOM,
+                                       ScenarioKind::ROOMS, ScenarioKind::MAZE,
+                                       ScenarioKind::CAVES,
+                                       ScenarioKind::WAREHOUSE,
+                                       ScenarioKind::CORRIDORS}) {
+            if (name == get_scenario_kind_name(candidate)) {
+                kind = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ScenarioGenerator::ScenarioGenerator(ScenarioKind kind, int width,
+                                         int height, uint64_t seed,
+                                         double density) :
+            kind{kind},
+            width{width},
+            height{height},
+            seed{seed},
+            density{density} {
+    }
+
+    uint64_t ScenarioGenerator::hash(int64_t x, int64_t y,
+                                     uint64_t salt) const {
+        return mix(mix(mix(seed ^ (salt * 0xD6E8FEB86659FD93ull)) +
+                       uint64_t(x)) + uint64_t(y));
+    }
+
+    int ScenarioGenerator::get_opening(int blockX, int blockY, int blocksX,
+                                       int blocksY) const {
+        // a binary tree maze: every block opens to the east or the north,
+        // so all blocks are connected without any search
+        if (blockY == blocksY - 1) {
+            return blockX == blocksX - 1 ? 0 : 1;
+        }
+        if (blockX == blocksX - 1) {
+            return 2;
+        }
+        return (hash(blockX, blockY, OPENING) & 1) != 0 ? 1 : 2;
+    }
+
+    double ScenarioGenerator::get_noise(int x, int y) const {
+        // two octaves of value noise, interpolated between lattice points
+        double noise = 0;
+        const struct {
+            int scale;
+            double weight;
+            Salt salt;
+        } octaves[] = {{8, .65, COARSE_NOISE}, {3, .35, FINE_NOISE}};
+        for (const auto &octave : octaves) {
+            int cellX = x / octave.scale, cellY = y / octave.scale;
+            double fx = smooth((x % octave.scale + .5) / octave.scale),
+                    fy = smooth((y % octave.scale + .5) / octave.scale);
+            double bottom = random(cellX, cellY, octave.salt) * (1 - fx) +
+                            random(cellX + 1, cellY, octave.salt) * fx,
+                    top = random(cellX, cellY + 1, octave.salt) * (1 - fx) +
+                          random(cellX + 1, cellY + 1, octave.salt) * fx;
+            noise += octave.weight * (bottom * (1 - fy) + top * fy);
+        }
+        return noise;
+    }
+
+    uint8_t ScenarioGenerator::get_cell(int x, int y) const {
+        if (x < 0 || y < 0 || x >= width || y >= height) {
+            return GridMap::OBSTACLE;
+        }
+        bool obstacle = false;
+        switch (kind) {
+            case ScenarioKind::RANDOM:
+                obstacle = random(x, y, CELL) < density;
+                break;
+            case ScenarioKind::ROOMS: {
+                int u = x % ROOM_SIZE, v = y % ROOM_SIZE,
+                        roomX = x / ROOM_SIZE, roomY = y / ROOM_SIZE;
+                if (u == 0 && v == 0) {
+                    obstacle = true;
+                } else if (u == 0) {
+                    // the wall west of a room, the door is never at a corner
+                    int door = 2 + int(hash(roomX, roomY, VERTICAL_DOOR) %
+                                       (ROOM_SIZE - DOOR_SIZE - 3));
+                    obstacle = roomX == 0 || v < door || v >= door + DOOR_SIZE;
+                } else if (v == 0) {
+                    int door = 2 + int(hash(roomX, roomY, HORIZONTAL_DOOR) %
+                                       (ROOM_SIZE - DOOR_SIZE - 3));
+                    obstacle = roomY == 0 || u < door || u >= door + DOOR_SIZE;
+                }
+                break;
+            }
+            case ScenarioKind::MAZE: {
+                int blocksX = width / MAZE_PERIOD,
+                        blocksY = height / MAZE_PERIOD,
+                        blockX = x / MAZE_PERIOD, blockY = y / MAZE_PERIOD,
+                        u = x % MAZE_PERIOD, v = y % MAZE_PERIOD;
+                if (blockX >= blocksX || blockY >= blocksY) {
+                    obstacle = true;
+                } else if (u == MAZE_PERIOD - 1 || v == MAZE_PERIOD - 1) {
+                    int opening = get_opening(blockX, blockY, blocksX, blocksY);
+                    obstacle = (u == MAZE_PERIOD - 1 && v == MAZE_PERIOD - 1) ||
+                               (u == MAZE_PERIOD - 1 && opening != 1) ||
+                               (v == MAZE_PERIOD - 1 && opening != 2);
+                }
+                break;
+            }
+            case ScenarioKind::CAVES:
+                obstacle = get_noise(x, y) < density;
+                break;
+            case ScenarioKind::WAREHOUSE: {
+                int u = x % RACK_PERIOD_X, v = y % RACK_PERIOD_Y;
+                obstacle = u >= 1 && u < 1 + RACK_LENGTH && v < RACK_DEPTH &&
+                           random(x / RACK_PERIOD_X, y / RACK_PERIOD_Y, RACK) <
+                           RACK_PRESENT;
+                break;
+            }
+            case ScenarioKind::CORRIDORS: {
+                int blocksX = width / CORRIDOR_PERIOD,
+                        blocksY = height / CORRIDOR_PERIOD,
+                        blockX = x / CORRIDOR_PERIOD,
+                        blockY = y / CORRIDOR_PERIOD,
+                        u = x % CORRIDOR_PERIOD, v = y % CORRIDOR_PERIOD;
+                if (blockX >= blocksX || blockY >= blocksY) {
+                    obstacle = true;
+                } else if (u >= CORRIDOR_WIDTH || v >= CORRIDOR_WIDTH) {
+                    // a corridor to the next junction, east or north
+                    int opening = get_opening(blockX, blockY, blocksX, blocksY);
+                    if (u >= CORRIDOR_WIDTH && v >= CORRIDOR_WIDTH) {
+                        obstacle = true;
+                    } else if (v < CORRIDOR_WIDTH) {
+                        obstacle = opening != 1 &&
+                                   !(blockX < blocksX - 1 &&
+                                     random(blockX, blockY, EAST_LOOP) <
+                                     CORRIDOR_LOOPS);
+                    } else {
+                        obstacle = opening != 2 &&
+                                   !(blockY < blocksY - 1 &&
+                                     random(blockX, blockY, NORTH_LOOP) <
+                                     CORRIDOR_LOOPS);
+                    }
+                }
+                break;
+            }
+        }
+        return obstacle ? GridMap::OBSTACLE : GridMap::FREE;
+    }
+
+    void ScenarioGenerator::generate_rows(int firstRow, int rowCount,
+                                          uint8_t *cells,
+                                          int threadCount) const {
+        parallel_for(get_thread_count(threadCount), rowCount,
+                     [&](int, int begin, int end) {
+                         for (int row = begin; row < end; row++) {
+                             uint8_t *out = cells + std::size_t(row) *
+                                                    std::size_t(width);
+                             for (int x = 0; x < width; x++) {
+                                 out[x] = get_cell(x, firstRow + row);
+                             }
+                         }
+                     }, 16);
+    }
+
+    GridMap ScenarioGenerator::generate(int threadCount) const {
+        std::vector<uint8_t> cells(std::size_t(width) * std::size_t(height));
+        generate_rows(0, height, cells.data(), threadCount);
+        GridMap map;
+        map.assign(Coordinate{}, Length::METER, width, height,
+                   std::move(cells));
+        return map;
+    }
+
+    std::vector<ScenarioQuery> ScenarioGenerator::make_queries(
+            const GridMap &map, int count, int threadCount,
+            int maxExpansions) const {
+        struct Candidate {
+            int startX, startY, goalX, goalY;
+            double cost;
+        };
+        int threads = get_thread_count(threadCount);
+        int minDistance = std::min(map.get_width(), map.get_height()) / 4;
+        uint64_t cellCount = uint64_t(map.get_width()) *
+                             uint64_t(map.get_height());
+        std::vector<ScenarioQuery> queries;
+        if (cellCount == 0) {
+            return queries;
+        }
+        // picks a free cell, or gives up after a few tries
+        auto pick = [&](int candidate, Salt salt, int &x, int &y,
+                        const Candidate *from) {
+            for (int attempt = 0; attempt < 64; attempt++) {
+                uint64_t cell = hash(candidate, attempt, salt) % cellCount;
+                x = int(cell % uint64_t(map.get_width()));
+                y = int(cell / uint64_t(map.get_width()));
+                if (map.get_cell(x, y) == GridMap::FREE &&
+                    (from == nullptr ||
+                     std::max(std::abs(x - from->startX),
+                              std::abs(y - from->startY)) >= minDistance)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        std::vector<Candidate> batch(std::size_t(threads) * 4);
+        // give up when most candidates are not solvable
+        for (int first = 0; int(queries.size()) < count &&
+                            first < std::max(count, 1) * 16;
+             first += int(batch.size())) {
+            parallel_for(threads, int(batch.size()),
+                         [&](int, int begin, int end) {
+                             for (int i = begin; i < end; i++) {
+                                 Candidate &candidate = batch[i];
+                                 candidate.cost = -1;
+                                 if (pick(first + i, QUERY_START,
+                                          candidate.startX, candidate.startY,
+                                          nullptr) &&
+                                     pick(first + i, QUERY_GOAL,
+                                          candidate.goalX, candidate.goalY,
+                                          &candidate)) {
+                                     candidate.cost = find_reference_cost(
+                                             map, candidate.startX,
+                                             candidate.startY, candidate.goalX,
+                                             candidate.goalY, maxExpansions);
+                                 }
+                             }
+                         });
+            for (const Candidate &candidate : batch) {
+                if (candidate.cost >= 0 && int(queries.size()) < count) {
+                    Coordinate origin{map.get_origin()};
+                    Length cell{map.get_cell_size()};
+                    queries.push_back(ScenarioQuery{
+                            origin + Translation{(candidate.startX + .5) * cell,
+                                                 (candidate.startY + .5) * cell,
+                                                 0 * Length::METER},
+                            origin + Translation{(candidate.goalX + .5) * cell,
+                                                 (candidate.goalY + .5) * cell,
+                                                 0 * Length::METER},
+                            candidate.cost * cell});
+                }
+            }
+        }
+        return queries;
+    }
+
+    Scenario ScenarioGenerator::make_scenario(int queryCount,
+                                              int threadCount) const {
+        Scenario scenario{generate(threadCount), {}};
+        scenario.queries = make_queries(scenario.map, queryCount, threadCount);
+        return scenario;
+    }
+
+    double ScenarioGenerator::find_reference_cost(const GridMap &map,
+                                                  int startX, int startY,
+                                                  int goalX, int goalY,
+                                                  int maxExpansions) {
+        struct OpenCell {
+            double f, g;
+            int x, y;
+
+            bool operator<(const OpenCell &rhs) const {
+                return f > rhs.f || (f == rhs.f && g < rhs.g);
+            }
+        };
+        int width = map.get_width(), height = map.get_height();
+        auto is_free = [&](int x, int y) {
+            return x >= 0 && y >= 0 && x < width && y < height &&
+                   map.get_cell(x, y) == GridMap::FREE;
+        };
+        auto heuristic = [&](int x, int y) {
+            int dx = std::abs(x - goalX), dy = std::abs(y - goalY);
+            return std::max(dx, dy) + (SQRT_2 - 1) * std::min(dx, dy);
+        };
+        if (!is_free(startX, startY) || !is_free(goalX, goalY)) {
+            return -1;
+        }
+
+        std::unordered_map<int64_t, double> costs;
+        std::priority_queue<OpenCell> open;
+        costs[int64_t(startY) * width + startX] = 0;
+        open.push({heuristic(startX, startY), 0, startX, startY});
+        while (!open.empty() && --maxExpansions >= 0) {
+            OpenCell current{open.top()};
+            open.pop();
+            if (current.x == goalX && current.y == goalY) {
+                return current.g;
+            }
+            if (current.g > costs[int64_t(current.y) * width + current.x]) {
+                continue;
+            }
+            for (int dx = -1; dx <= 1; dx++) {
+                for (int dy = -1; dy <= 1; dy++) {
+                    int x = current.x + dx, y = current.y + dy;
+                    if ((dx == 0 && dy == 0) || !is_free(x, y) ||
+                        (dx != 0 && dy != 0 &&
+                         (!is_free(current.x + dx, current.y) ||
+                          !is_free(current.x, current.y + dy)))) {
+                        continue;
+                    }
+                    double g = current.g + (dx != 0 && dy != 0 ? SQRT_2 : 1);
+                    auto result = costs.emplace(int64_t(y) * width + x, g);
+                    if (result.second || g < result.first->second) {
+                        result.first->second = g;
+                        open.push({g + heuristic(x, y), g, x, y});
+                    }
+                }
+            }
+        }
+        return -1;
+    }
+
+}
@@ -0,0 +1,149 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   SearchWorkspace.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Reusable search memory
+//!
+//! The hash table and open list of a lattice search, kept between queries so a
+//! search does not allocate memory once the buffers are large enough.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/SearchWorkspace.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace r2d2 {
+
+    const SearchWorkspace::Key SearchWorkspace::NO_KEY,
+            SearchWorkspace::START_KEY;
+
+    SearchWorkspace::SearchWorkspace() :
+            table(1024, Visited{0, NO_KEY, 0, 0, false}),
+            count{0},
+            generation{1},
+            open{} {
+    }
+
+    SearchWorkspace &SearchWorkspace::get_thread_workspace() {
+        thread_local SearchWorkspace workspace;
+        return workspace;
+    }
+
+    void SearchWorkspace::reset() {
+        open.clear();
+        count = 0;
+        if (++generation == 0) {
+            // after four billion searches the old generations are cleared
+            for (Visited &visited : table) {
+                visited.generation = 0;
+            }
+            generation = 1;
+        }
+    }
+
+    SearchWorkspace::Visited *SearchWorkspace::find(Key key) {
+        for (std::size_t slot = get_slot(key);;
+             slot = (slot + 1) & (table.size() - 1)) {
+            Visited &visited = table[slot];
+            if (visited.generation != generation) {
+                return nullptr;
+            }
+            if (visited.key == key) {
+                return &visited;
+            }
+        }
+    }
+
+    SearchWorkspace::Visited &SearchWorkspace::insert(Key key) {
+        // the table is kept at most half full, so probes stay short
+        if ((count + 1) * 2 > table.size()) {
+            grow();
+        }
+        for (std::size_t slot = get_slot(key);;
+             slot = (slot + 1) & (table.size() - 1)) {
+            Visited &visited = table[slot];
+            if (visited.generation != generation) {
+                visited = Visited{key, NO_KEY,
+                                  std::numeric_limits<double>::infinity(),
+                                  generation, false};
+                count++;
+                return visited;
+            }
+            if (visited.key == key) {
+                return visited;
+            }
+        }
+    }
+
+    void SearchWorkspace::grow() {
+        std::vector<Visited> old{std::move(table)};
+        table.assign(old.size() * 2, Visited{0, NO_KEY, 0, 0, false});
+        for (const Visited &visited : old) {
+            if (visited.generation == generation) {
+                std::size_t slot = get_slot(visited.key);
+                while (table[slot].generation == generation) {
+                    slot = (slot + 1) & (table.size() - 1);
+                }
+                table[slot] = visited;
+            }
+        }
+    }
+
+    void SearchWorkspace::push(const OpenNode &node) {
+        open.push_back(node);
+        std::push_heap(open.begin(), open.end());
+    }
+
+    bool SearchWorkspace::pop(OpenNode &node) {
+        if (open.empty()) {
+            return false;
+        }
+        std::pop_heap(open.begin(), open.end());
+        node = open.back();
+        open.pop_back();
+        return true;
+    }
+
+    std::size_t SearchWorkspace::get_memory_usage() const {
+        return sizeof(*this) + table.capacity() * sizeof(Visited) +
+               open.capacity() * sizeof(OpenNode);
+    }
+
+}
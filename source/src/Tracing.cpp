@@ -0,0 +1,284 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   Tracing.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Timeline tracing of the planner
+//!
+//! Per-thread ring buffers of trace events and their export as Chrome trace
+//! event JSON.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/Tracing.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace r2d2 {
+
+    const std::size_t TraceBuffer::CAPACITY;
+    const int TraceScope::CHUNK;
+    const uint64_t TraceBoxQuery::MAX_GAP;
+
+    namespace {
+
+        struct Registry {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<TraceBuffer>> buffers;
+            //! the buffers of threads that ended, for new threads to take
+            std::vector<TraceBuffer *> retired;
+        };
+
+        Registry &get_registry() {
+            // never destroyed, threads might still record while the program
+            // exits
+            static Registry *registry = new Registry{};
+            return *registry;
+        }
+
+        struct Burst {
+            uint64_t begin, end, count;
+        };
+
+        thread_local Burst burst{0, 0, 0};
+
+        /**
+         * the buffer of a thread, which records the last burst and hands
+         * the buffer on when the thread ends
+         */
+        struct ThreadBuffer {
+            TraceBuffer *buffer;
+
+            ~ThreadBuffer() {
+                if (buffer != nullptr) {
+                    TraceBoxQuery::flush();
+                    Registry &registry = get_registry();
+                    std::lock_guard<std::mutex> lock{registry.mutex};
+                    registry.retired.push_back(buffer);
+                    buffer = nullptr;
+                }
+            }
+        };
+
+        thread_local ThreadBuffer threadBuffer{nullptr};
+
+        struct Event {
+            const char *name;
+            uint64_t begin, duration, count;
+        };
+
+    }
+
+    TraceBuffer::TraceBuffer(int threadId) :
+            threadId{threadId},
+            slots{new Slot[CAPACITY]},
+            head{0},
+            writing{0},
+            tail{0} {
+    }
+
+    void TraceBuffer::record(const char *name, uint64_t begin,
+                             uint64_t duration, uint64_t count) {
+        uint64_t index = head.load(std::memory_order_relaxed);
+        // tell readers the slot is being overwritten before touching it
+        writing.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        Slot &slot = slots[index & (CAPACITY - 1)];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.begin.store(begin, std::memory_order_relaxed);
+        slot.duration.store(duration, std::memory_order_relaxed);
+        slot.count.store(count, std::memory_order_relaxed);
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    bool TraceBuffer::write(std::ostream &out, bool first) const {
+        uint64_t end = head.load(std::memory_order_acquire),
+                begin = std::max(tail.load(std::memory_order_relaxed),
+                                 end > CAPACITY ? end - CAPACITY : 0);
+        std::vector<Event> events;
+        for (uint64_t i = begin; i < end; i++) {
+            const Slot &slot = slots[i & (CAPACITY - 1)];
+            events.push_back({slot.name.load(std::memory_order_relaxed),
+                              slot.begin.load(std::memory_order_relaxed),
+                              slot.duration.load(std::memory_order_relaxed),
+                              slot.count.load(std::memory_order_relaxed)});
+        }
+        // skip the events that were overwritten while they were copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t written = writing.load(std::memory_order_relaxed);
+        std::size_t skip = written > begin + CAPACITY ?
+                           std::size_t(written - begin - CAPACITY) : 0;
+
+        char text[64];
+        for (std::size_t i = std::min(skip, events.size());
+             i < events.size(); i++) {
+            const Event &event = events[i];
+            out << (first ? "\n" : ",\n") << "{\"name\":\"" << event.name
+                << "\",\"cat\":\"pathfinding\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                << threadId;
+            // the trace format uses microseconds
+            std::snprintf(text, sizeof(text), ",\"ts\":%.3f,\"dur\":%.3f",
+                          event.begin / 1000.0, event.duration / 1000.0);
+            out << text;
+            if (event.count > 0) {
+                out << ",\"args\":{\"count\":" << event.count << "}";
+            }
+            out << "}";
+            first = false;
+        }
+        return first;
+    }
+
+    void TraceBuffer::clear() {
+        tail.store(head.load(std::memory_order_acquire),
+                   std::memory_order_relaxed);
+    }
+
+    TraceBuffer &TraceLog::get_thread_buffer() {
+        if (threadBuffer.buffer == nullptr) {
+            Registry &registry = get_registry();
+            std::lock_guard<std::mutex> lock{registry.mutex};
+            if (!registry.retired.empty()) {
+                threadBuffer.buffer = registry.retired.back();
+                registry.retired.pop_back();
+            } else {
+                registry.buffers.emplace_back(new TraceBuffer{
+                        int(registry.buffers.size()) + 1});
+                threadBuffer.buffer = registry.buffers.back().get();
+            }
+        }
+        return *threadBuffer.buffer;
+    }
+
+    uint64_t TraceLog::now() {
+        static const std::chrono::steady_clock::time_point epoch{
+                std::chrono::steady_clock::now()};
+        return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - epoch).count());
+    }
+
+    void TraceLog::write_chrome_trace(std::ostream &out) {
+        Registry &registry = get_registry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        out << "{\"traceEvents\":[";
+        bool first = true;
+        for (const std::unique_ptr<TraceBuffer> &buffer : registry.buffers) {
+            first = buffer->write(out, first);
+        }
+        // name the threads after their buffer
+        for (const std::unique_ptr<TraceBuffer> &buffer : registry.buffers) {
+            out << (first ? "\n" : ",\n")
+                << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                << buffer->get_thread_id() << ",\"args\":{\"name\":\"thread "
+                << buffer->get_thread_id() << "\"}}";
+            first = false;
+        }
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    void TraceLog::clear() {
+        Registry &registry = get_registry();
+        std::lock_guard<std::mutex> lock{registry.mutex};
+        for (const std::unique_ptr<TraceBuffer> &buffer : registry.buffers) {
+            buffer->clear();
+        }
+    }
+
+    TraceScope::TraceScope(const char *name) :
+            name{name},
+            begin{TraceLog::now()},
+            steps{0},
+            ended{false} {
+    }
+
+    TraceScope::~TraceScope() {
+        end();
+    }
+
+    void TraceScope::end() {
+        if (!ended) {
+            uint64_t time = TraceLog::now();
+            TraceBoxQuery::flush();
+            TraceLog::get_thread_buffer().record(name, begin, time - begin,
+                                                 uint64_t(steps));
+            ended = true;
+        }
+    }
+
+    void TraceScope::chunk() {
+        if (++steps == CHUNK && !ended) {
+            uint64_t time = TraceLog::now();
+            TraceBoxQuery::flush();
+            TraceLog::get_thread_buffer().record(name, begin, time - begin,
+                                                 uint64_t(steps));
+            begin = time;
+            steps = 0;
+        }
+    }
+
+    TraceBoxQuery::TraceBoxQuery() {
+        uint64_t time = TraceLog::now();
+        if (burst.count > 0 && time - burst.end > MAX_GAP) {
+            flush();
+        }
+        if (burst.count == 0) {
+            burst.begin = time;
+            // take the buffer now, so a thread that ends during a burst
+            // still records it
+            TraceLog::get_thread_buffer();
+        }
+    }
+
+    TraceBoxQuery::~TraceBoxQuery() {
+        burst.end = TraceLog::now();
+        burst.count++;
+    }
+
+    void TraceBoxQuery::flush() {
+        if (burst.count > 0) {
+            TraceLog::get_thread_buffer().record(
+                    "get_box_info", burst.begin, burst.end - burst.begin,
+                    burst.count);
+            burst.count = 0;
+        }
+    }
+
+}
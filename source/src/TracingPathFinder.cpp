@@ -0,0 +1,93 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   TracingPathFinder.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Query trace recording pathfinder
+//!
+//! A pathfinder that records the queries of another pathfinder.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/TracingPathFinder.hpp"
+
+namespace r2d2 {
+
+    TracingPathFinder::TracingPathFinder(SharedObject<ReadOnlyMap> &map,
+                                         Box robotBox, PathFinder &pathFinder,
+                                         QueryTraceWriter &writer,
+                                         Length cellSize) :
+            PathFinder{map, robotBox},
+            map(map),
+            robotBox{robotBox.get_axis_size()},
+            pathFinder(pathFinder),
+            writer(writer),
+            cellSize{cellSize},
+            mutex{},
+            mapWritten{false},
+            writtenVersion{0} {
+    }
+
+    bool TracingPathFinder::get_path_to_coordinate(
+            Coordinate start, Coordinate goal, std::vector<Coordinate> &path) {
+        {
+            // the accessor is released before the query, which takes its own
+            SharedObject<ReadOnlyMap>::Accessor accessor{map};
+            uint64_t version = VersionedMap::get_version_of(accessor.access());
+            std::lock_guard<std::mutex> lock{mutex};
+            if (!mapWritten || version != writtenVersion) {
+                writer.write_map(GridMap::sample(accessor.access(), cellSize));
+                mapWritten = true;
+                writtenVersion = version;
+            }
+        }
+
+        uint64_t timestamp = writer.get_timestamp();
+        auto begin = std::chrono::steady_clock::now();
+        bool found = pathFinder.get_path_to_coordinate(start, goal, path);
+        uint64_t duration = uint64_t(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - begin).count());
+
+        writer.write_query({start, goal, robotBox, found,
+                            found ? uint32_t(path.size()) : 0,
+                            duration, timestamp});
+        return found;
+    }
+
+}
@@ -0,0 +1,455 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   VisibilityGraph.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Visibility graph of the free space
+//!
+//! A graph between the corners of the obstacles of a map, inflated by the robot
+//! size, used for finding shortest any-angle paths.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/VisibilityGraph.hpp"
+#include "../include/ParallelFor.hpp"
+#include "../include/VersionedMap.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace r2d2 {
+
+    namespace {
+
+        // how close a coordinate in grid units has to be to a grid line to
+        // be considered on it
+        const double EPSILON = 1e-9;
+
+    }
+
+    VisibilityGraph::VisibilityGraph(ReadOnlyMap &map, Translation robotBox,
+                                     Length cellSize, int threadCount) :
+            origin{},
+            cellSize(cellSize),
+            width{0},
+            height{0},
+            blocked{},
+            vertices{},
+            firstEdge{},
+            targets{},
+            lengths{},
+            mapVersion{VersionedMap::get_version_of(map)} {
+        Box bounds{map.get_map_bounding_box()};
+        Translation size{bounds.get_axis_size()};
+        origin = bounds.get_bottom_left();
+        width = int(std::ceil(size.get_x() / cellSize));
+        height = int(std::ceil(size.get_y() / cellSize));
+        int threads = get_thread_count(threadCount);
+
+        // a cell is free when the robot fits on all of its positions, so the
+        // robot box is added around the cell
+        blocked.resize(std::size_t(width) * std::size_t(height));
+        Translation cell{cellSize, cellSize, 0 * Length::METER};
+        parallel_for(threads, height, [&](int, int begin, int end) {
+            for (int y = begin; y < end; y++) {
+                for (int x = 0; x < width; x++) {
+                    Coordinate corner{origin + Translation{
+                            x * cellSize, y * cellSize, 0 * Length::METER}};
+                    BoxInfo info{map.get_box_info(Box{
+                            corner - robotBox / 2,
+                            corner + cell + robotBox / 2})};
+                    blocked[std::size_t(y) * std::size_t(width) +
+                            std::size_t(x)] =
+                            info.get_has_obstacle() || info.get_has_unknown();
+                }
+            }
+        });
+
+        // a convex corner is a grid point with a single blocked cell around it
+        for (int y = 0; y <= height; y++) {
+            for (int x = 0; x <= width; x++) {
+                int count = 0, dirX = 0, dirY = 0;
+                for (int dy = -1; dy <= 0; dy++) {
+                    for (int dx = -1; dx <= 0; dx++) {
+                        if (is_blocked(x + dx, y + dy)) {
+                            count++;
+                            dirX = dx * 2 + 1;
+                            dirY = dy * 2 + 1;
+                        }
+                    }
+                }
+                if (count == 1) {
+                    vertices.push_back({x, y, dirX, dirY});
+                }
+            }
+        }
+
+        // every item handles a vertex from the front and one from the back,
+        // as the first vertices test more pairs than the last ones
+        int count = int(vertices.size());
+        std::vector<std::vector<std::pair<int, int>>> found(
+                static_cast<std::size_t>(threads));
+        parallel_for(threads, (count + 1) / 2, [&](int worker, int begin, int end) {
+            std::vector<std::pair<int, int>> &out = found[worker];
+            for (int i = begin; i < end; i++) {
+                for (int from : {i, count - 1 - i}) {
+                    const Vertex &a = vertices[from];
+                    for (int to = from + 1; to < count; to++) {
+                        const Vertex &b = vertices[to];
+                        double dx = b.x - a.x, dy = b.y - a.y;
+                        if (is_taut(a, dx, dy) && is_taut(b, dx, dy) &&
+                            is_visible(a.x, a.y, b.x, b.y)) {
+                            out.emplace_back(from, to);
+                        }
+                    }
+                    if (from == count - 1 - i) {
+                        break;
+                    }
+                }
+            }
+        }, 16);
+
+        // store the edges in both directions, sorted by vertex
+        firstEdge.assign(std::size_t(count) + 1, 0);
+        for (const std::vector<std::pair<int, int>> &part : found) {
+            for (const std::pair<int, int> &edge : part) {
+                firstEdge[edge.first + 1]++;
+                firstEdge[edge.second + 1]++;
+            }
+        }
+        for (int i = 0; i < count; i++) {
+            firstEdge[i + 1] += firstEdge[i];
+        }
+        targets.resize(std::size_t(firstEdge[count]));
+        std::vector<int> next(firstEdge.begin(), firstEdge.end() - 1);
+        for (const std::vector<std::pair<int, int>> &part : found) {
+            for (const std::pair<int, int> &edge : part) {
+                targets[next[edge.first]++] = edge.second;
+                targets[next[edge.second]++] = edge.first;
+            }
+        }
+        lengths.resize(targets.size());
+        for (int i = 0; i < count; i++) {
+            std::sort(targets.begin() + firstEdge[i],
+                      targets.begin() + firstEdge[i + 1]);
+            for (int e = firstEdge[i]; e < firstEdge[i + 1]; e++) {
+                const Vertex &a = vertices[i], &b = vertices[targets[e]];
+                lengths[e] = std::hypot(double(b.x - a.x), double(b.y - a.y));
+            }
+        }
+    }
+
+    VisibilityGraph::VisibilityGraph(PrecomputationBundle::Reader &in,
+                                     uint64_t mapVersion) :
+            origin{},
+            cellSize{in.get_length()},
+            width{0},
+            height{0},
+            blocked{},
+            vertices{},
+            firstEdge{},
+            targets{},
+            lengths{},
+            mapVersion{mapVersion} {
+        Length originX{in.get_length()}, originY{in.get_length()};
+        origin = Coordinate{originX, originY, 0 * Length::METER};
+        width = in.get<int32_t>();
+        height = in.get<int32_t>();
+        in.get_vector(blocked);
+        in.get_vector(vertices);
+        in.get_vector(firstEdge);
+        in.get_vector(targets);
+        in.get_vector(lengths);
+
+        // the searches index with all of these, so they are checked once here
+        if (!(cellSize > 0 * Length::METER) || width < 0 || height < 0 ||
+            blocked.size() != std::size_t(width) * std::size_t(height) ||
+            firstEdge.size() != vertices.size() + 1 ||
+            lengths.size() != targets.size() || firstEdge.front() != 0 ||
+            firstEdge.back() != int(targets.size())) {
+            throw std::runtime_error("visibility graph has a wrong size");
+        }
+        for (std::size_t i = 1; i < firstEdge.size(); i++) {
+            if (firstEdge[i] < firstEdge[i - 1]) {
+                throw std::runtime_error("visibility graph is corrupt");
+            }
+        }
+        for (int target : targets) {
+            if (target < 0 || target >= int(vertices.size())) {
+                throw std::runtime_error("visibility graph is corrupt");
+            }
+        }
+    }
+
+    void VisibilityGraph::serialize(PrecomputationBundle::Writer &out) const {
+        out.put_length(cellSize);
+        out.put_length(origin.get_x());
+        out.put_length(origin.get_y());
+        out.put(int32_t(width));
+        out.put(int32_t(height));
+        out.put_vector(blocked);
+        out.put_vector(vertices);
+        out.put_vector(firstEdge);
+        out.put_vector(targets);
+        out.put_vector(lengths);
+    }
+
+    bool VisibilityGraph::is_taut(const Vertex &vertex, double dx, double dy) {
+        double x = dx * vertex.dirX, y = dy * vertex.dirY;
+        return !(x > 0 && y > 0) && !(x < 0 && y < 0);
+    }
+
+    bool VisibilityGraph::is_covered(double x, double y) const {
+        double roundX = std::floor(x + .5), roundY = std::floor(y + .5);
+        // a point on a grid line is on the cells at both sides of it
+        int minX = int(std::floor(x)), maxX = minX,
+                minY = int(std::floor(y)), maxY = minY;
+        if (std::abs(x - roundX) < EPSILON) {
+            minX = int(roundX) - 1;
+            maxX = int(roundX);
+        }
+        if (std::abs(y - roundY) < EPSILON) {
+            minY = int(roundY) - 1;
+            maxY = int(roundY);
+        }
+        for (int cellY = minY; cellY <= maxY; cellY++) {
+            for (int cellX = minX; cellX <= maxX; cellX++) {
+                if (!is_blocked(cellX, cellY)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool VisibilityGraph::is_visible(double fromX, double fromY, double toX,
+                                     double toY) const {
+        if (!is_covered(fromX, fromY) || !is_covered(toX, toY)) {
+            return false;
+        }
+        double dx = toX - fromX, dy = toY - fromY;
+        // a line along a grid line may use the cells on either side of it
+        if (std::abs(dx) < EPSILON &&
+            std::abs(fromX - std::floor(fromX + .5)) < EPSILON) {
+            int x = int(std::floor(fromX + .5));
+            for (int y = int(std::floor(std::min(fromY, toY)));
+                 y < std::max(fromY, toY); y++) {
+                if (is_blocked(x - 1, y) && is_blocked(x, y)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (std::abs(dy) < EPSILON &&
+            std::abs(fromY - std::floor(fromY + .5)) < EPSILON) {
+            int y = int(std::floor(fromY + .5));
+            for (int x = int(std::floor(std::min(fromX, toX)));
+                 x < std::max(fromX, toX); x++) {
+                if (is_blocked(x, y - 1) && is_blocked(x, y)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // walk the cells the line passes, from the cell it leaves the start
+        // through to the cell it enters the goal from. where the line
+        // passes a grid point exactly, the cells that only touch the point
+        // are skipped, as the point is on a free cell already
+        auto first_cell = [](double from, double delta) {
+            return int(delta < 0 ? std::ceil(from) - 1 : std::floor(from));
+        };
+        auto last_cell = [](double to, double delta) {
+            return int(delta > 0 ? std::ceil(to) - 1 : std::floor(to));
+        };
+        int x = first_cell(fromX, dx), y = first_cell(fromY, dy),
+                endX = last_cell(toX, dx), endY = last_cell(toY, dy);
+        int stepX = dx > 0 ? 1 : -1, stepY = dy > 0 ? 1 : -1;
+        double infinity = std::numeric_limits<double>::infinity();
+        double deltaX = dx == 0 ? infinity : 1 / std::abs(dx),
+                deltaY = dy == 0 ? infinity : 1 / std::abs(dy);
+        double nextX = dx > 0 ? (x + 1 - fromX) / dx :
+                       dx < 0 ? (fromX - x) / -dx : infinity,
+                nextY = dy > 0 ? (y + 1 - fromY) / dy :
+                        dy < 0 ? (fromY - y) / -dy : infinity;
+        for (int steps = std::abs(endX - x) + std::abs(endY - y);
+             steps >= 0; steps--) {
+            if (is_blocked(x, y)) {
+                return false;
+            }
+            if (x == endX && y == endY) {
+                break;
+            }
+            if (nextX < nextY - EPSILON) {
+                x += stepX;
+                nextX += deltaX;
+            } else if (nextY < nextX - EPSILON) {
+                y += stepY;
+                nextY += deltaY;
+            } else {
+                x += stepX;
+                y += stepY;
+                nextX += deltaX;
+                nextY += deltaY;
+                steps--;
+            }
+        }
+        return true;
+    }
+
+    bool VisibilityGraph::is_free(const Coordinate &coord) const {
+        return is_covered((coord.get_x() - origin.get_x()) / cellSize,
+                          (coord.get_y() - origin.get_y()) / cellSize);
+    }
+
+    bool VisibilityGraph::is_visible(const Coordinate &from,
+                                     const Coordinate &to) const {
+        return is_visible((from.get_x() - origin.get_x()) / cellSize,
+                          (from.get_y() - origin.get_y()) / cellSize,
+                          (to.get_x() - origin.get_x()) / cellSize,
+                          (to.get_y() - origin.get_y()) / cellSize);
+    }
+
+    Coordinate VisibilityGraph::get_vertex(int vertex) const {
+        return origin + Translation{vertices[vertex].x * cellSize,
+                                    vertices[vertex].y * cellSize,
+                                    0 * Length::METER};
+    }
+
+    void VisibilityGraph::get_neighbours(int vertex,
+                                         std::vector<int> &neighbours) const {
+        neighbours.assign(targets.begin() + firstEdge[vertex],
+                          targets.begin() + firstEdge[vertex + 1]);
+    }
+
+    bool VisibilityGraph::find_path(const Coordinate &start,
+                                    const Coordinate &goal,
+                                    std::vector<Coordinate> &path,
+                                    Length *pathCost) const {
+        double startX = (start.get_x() - origin.get_x()) / cellSize,
+                startY = (start.get_y() - origin.get_y()) / cellSize,
+                goalX = (goal.get_x() - origin.get_x()) / cellSize,
+                goalY = (goal.get_y() - origin.get_y()) / cellSize;
+        if (!is_covered(startX, startY) || !is_covered(goalX, goalY)) {
+            return false;
+        }
+        if (is_visible(startX, startY, goalX, goalY)) {
+            path.assign(1, goal);
+            if (pathCost != nullptr) {
+                *pathCost = (goal - start).get_length();
+            }
+            return true;
+        }
+
+        // the goal is node count, connected to the vertices that see it.
+        // whether a vertex sees the goal is only checked once it is expanded
+        int count = get_vertex_count();
+        double infinity = std::numeric_limits<double>::infinity();
+        std::vector<double> g(std::size_t(count) + 1, infinity);
+        std::vector<int> parent(std::size_t(count) + 1, -1);
+        typedef std::pair<double, int> Open;
+        std::priority_queue<Open, std::vector<Open>, std::greater<Open>> open;
+        auto heuristic = [&](int vertex) {
+            return vertex == count ? 0 :
+                   std::hypot(goalX - vertices[vertex].x,
+                              goalY - vertices[vertex].y);
+        };
+        for (int i = 0; i < count; i++) {
+            const Vertex &vertex = vertices[i];
+            if (is_taut(vertex, vertex.x - startX, vertex.y - startY) &&
+                is_visible(startX, startY, vertex.x, vertex.y)) {
+                g[i] = std::hypot(vertex.x - startX, vertex.y - startY);
+                open.push({g[i] + heuristic(i), i});
+            }
+        }
+
+        while (!open.empty()) {
+            Open current = open.top();
+            open.pop();
+            int vertex = current.second;
+            if (vertex == count) {
+                break;
+            }
+            // skip vertices that were reached cheaper after being opened
+            if (current.first > g[vertex] + heuristic(vertex)) {
+                continue;
+            }
+            auto relax = [&](int next, double length) {
+                double cost = g[vertex] + length;
+                if (cost < g[next]) {
+                    g[next] = cost;
+                    parent[next] = vertex;
+                    open.push({cost + heuristic(next), next});
+                }
+            };
+            for (int e = firstEdge[vertex]; e < firstEdge[vertex + 1]; e++) {
+                relax(targets[e], lengths[e]);
+            }
+            const Vertex &position = vertices[vertex];
+            if (is_taut(position, goalX - position.x, goalY - position.y) &&
+                is_visible(goalX, goalY, position.x, position.y)) {
+                relax(count, std::hypot(goalX - position.x,
+                                        goalY - position.y));
+            }
+        }
+        if (g[count] == infinity) {
+            return false;
+        }
+
+        path.clear();
+        path.push_back(goal);
+        for (int vertex = parent[count]; vertex >= 0; vertex = parent[vertex]) {
+            path.push_back(get_vertex(vertex));
+        }
+        std::reverse(path.begin(), path.end());
+        if (pathCost != nullptr) {
+            *pathCost = g[count] * cellSize;
+        }
+        return true;
+    }
+
+    std::size_t VisibilityGraph::get_memory_usage() const {
+        return sizeof(*this) + blocked.capacity() +
+               vertices.capacity() * sizeof(Vertex) +
+               (firstEdge.capacity() + targets.capacity()) * sizeof(int) +
+               lengths.capacity() * sizeof(double);
+    }
+
+}
@@ -0,0 +1,134 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   VisibilityGraphPathFinder.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Visibility graph pathfinder
+//!
+//! A pathfinder for static maps that searches a precomputed visibility graph
+//! between the corners of the obstacles.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include "../include/VisibilityGraphPathFinder.hpp"
+#include "../include/VersionedMap.hpp"
+
+namespace r2d2 {
+
+    VisibilityGraphPathFinder::VisibilityGraphPathFinder(
+            SharedObject<ReadOnlyMap> &map, Box robotBox, Length cellSize,
+            int threadCount) :
+            PathFinder{map, robotBox},
+            mapAccess{map},
+            robotBox{robotBox.get_axis_size()},
+            cellSize{cellSize},
+            threadCount{threadCount},
+            graphMutex{},
+            graph{} {
+    }
+
+    bool VisibilityGraphPathFinder::get_path_to_coordinate(
+            Coordinate start, Coordinate goal, std::vector<Coordinate> &path) {
+        if ((start - goal).get_length() / Length::METER == 0) {
+            path.clear();
+            return true;
+        }
+        MapAccessGroup::Lease lease{mapAccess};
+        return get_graph(lease.access())->find_path(start, goal, path);
+    }
+
+    std::shared_ptr<const VisibilityGraph> VisibilityGraphPathFinder::get_graph() {
+        MapAccessGroup::Lease lease{mapAccess};
+        return get_graph(lease.access());
+    }
+
+    std::shared_ptr<const VisibilityGraph> VisibilityGraphPathFinder::get_graph(
+            ReadOnlyMap &map) {
+        std::lock_guard<std::mutex> lock{graphMutex};
+        if (graph == nullptr ||
+            graph->get_map_version() != VersionedMap::get_version_of(map)) {
+            graph = std::make_shared<const VisibilityGraph>(
+                    map, robotBox, cellSize, threadCount);
+        }
+        return graph;
+    }
+
+    void VisibilityGraphPathFinder::save_precomputation(
+            PrecomputationBundle &bundle) {
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        std::vector<uint8_t> data;
+        PrecomputationBundle::Writer out{data};
+        // the graph does not know the robot it was made for
+        out.put_length(robotBox.get_x());
+        out.put_length(robotBox.get_y());
+        get_graph(map)->serialize(out);
+        // the graph is made from cells of its cell size
+        bundle.add_section("visibility", std::move(data), map, cellSize);
+    }
+
+    bool VisibilityGraphPathFinder::load_precomputation(
+            const PrecomputationBundle &bundle) {
+        std::size_t size;
+        const uint8_t *data = bundle.get_section("visibility", size);
+        if (data == nullptr) {
+            return false;
+        }
+        MapAccessGroup::Lease lease{mapAccess};
+        ReadOnlyMap &map = lease.access();
+        if (!bundle.matches(map)) {
+            return false;
+        }
+        PrecomputationBundle::Reader in{data, size};
+        Length robotX{in.get_length()}, robotY{in.get_length()};
+        if ((robotX - robotBox.get_x()) / Length::METER != 0 ||
+            (robotY - robotBox.get_y()) / Length::METER != 0) {
+            return false;
+        }
+        std::shared_ptr<const VisibilityGraph> loaded{
+                std::make_shared<const VisibilityGraph>(
+                        in, VersionedMap::get_version_of(map))};
+        if ((loaded->get_cell_size() - cellSize) / Length::METER != 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock{graphMutex};
+        graph = loaded;
+        return true;
+    }
+
+}
@@ -0,0 +1,181 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   AdaptiveSteps_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Adaptive step tests
+//!
+//! Tests the searches that take long steps in open space.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    const r2d2::SearchSettings adaptive{r2d2::CollisionChecking::EAGER, 1, 1,
+                                        8};
+
+    /**
+     * whether the robot can drive the path without touching an obstacle
+     */
+    bool is_clear(r2d2::ReadOnlyMap &map, r2d2::Coordinate from,
+                  const std::vector<r2d2::Coordinate> &path) {
+        for (const r2d2::Coordinate &to : path) {
+            r2d2::Coordinate low{std::min(from.get_x(), to.get_x()),
+                                 std::min(from.get_y(), to.get_y()),
+                                 0 * r2d2::Length::METER},
+                    high{std::max(from.get_x(), to.get_x()),
+                         std::max(from.get_y(), to.get_y()),
+                         0 * r2d2::Length::METER};
+            r2d2::BoxInfo info{map.get_box_info(
+                    r2d2::Box{low - robotBox / 2, high + robotBox / 2})};
+            if (info.get_has_obstacle() || info.get_has_unknown()) {
+                return false;
+            }
+            from = to;
+        }
+        return true;
+    }
+
+}
+
+TEST(AdaptiveSteps, crosses_open_space_with_fewer_nodes) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 40, 40, r2d2::GridMap::FREE};
+    // a pillar keeps the search from going straight
+    for (int x = 15; x < 25; x++) {
+        for (int y = 15; y < 25; y++) {
+            grid.set_cell(x, y, r2d2::GridMap::OBSTACLE);
+        }
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+    r2d2::Coordinate start{make_coordinate(2.2, 2.7)},
+            goal{make_coordinate(37.6, 36.1)};
+
+    std::vector<r2d2::Coordinate> fixedPath, adaptivePath;
+    int fixedNodes = 0, adaptiveNodes = 0;
+    ASSERT_TRUE(pathFinder.get_path_to_coordinate(
+            start, goal, fixedPath, r2d2::CancellationToken::never(),
+            r2d2::SearchSettings{}, &fixedNodes));
+    ASSERT_TRUE(pathFinder.get_path_to_coordinate(
+            start, goal, adaptivePath, r2d2::CancellationToken::never(),
+            adaptive, &adaptiveNodes));
+    EXPECT_LT(adaptiveNodes * 2, fixedNodes);
+    EXPECT_TRUE(is_clear(grid, start, adaptivePath));
+    ASSERT_FALSE(adaptivePath.empty());
+    EXPECT_EQ(0, (adaptivePath.back() - goal).get_length() /
+                 r2d2::Length::METER);
+
+    double fixedLength = 0, adaptiveLength = 0;
+    r2d2::Coordinate from{start};
+    for (const r2d2::Coordinate &to : fixedPath) {
+        fixedLength += (to - from).get_length() / r2d2::Length::METER;
+        from = to;
+    }
+    from = start;
+    for (const r2d2::Coordinate &to : adaptivePath) {
+        adaptiveLength += (to - from).get_length() / r2d2::Length::METER;
+        from = to;
+    }
+    EXPECT_LE(adaptiveLength, fixedLength * 1.05);
+}
+
+TEST(AdaptiveSteps, finds_passages_between_long_steps) {
+    // a wall with a gap of one and a half robot, which a lattice with
+    // twice the step misses
+    r2d2::GridMap grid{{}, .25 * r2d2::Length::METER, 80, 80,
+                       r2d2::GridMap::FREE};
+    for (int y = 0; y < 80; y++) {
+        if (y < 40 || y > 42) {
+            grid.set_cell(40, y, r2d2::GridMap::OBSTACLE);
+            grid.set_cell(41, y, r2d2::GridMap::OBSTACLE);
+        }
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+    r2d2::Coordinate start{make_coordinate(2.1, 3.3)},
+            goal{make_coordinate(17.3, 15.85)};
+
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pathFinder.get_path_to_coordinate(
+            start, goal, path, r2d2::CancellationToken::never(),
+            r2d2::SearchSettings{r2d2::CollisionChecking::EAGER, 2}));
+    ASSERT_TRUE(pathFinder.get_path_to_coordinate(
+            start, goal, path, r2d2::CancellationToken::never(), adaptive));
+    EXPECT_TRUE(is_clear(grid, start, path));
+
+    // without the gap there is no path at all
+    grid.set_cell(40, 41, r2d2::GridMap::OBSTACLE);
+    LockingSharedObject<r2d2::ReadOnlyMap> closedMap{grid};
+    r2d2::AStarPathFinder closed{closedMap, {{}, robotBox}};
+    EXPECT_FALSE(closed.get_path_to_coordinate(
+            start, goal, path, r2d2::CancellationToken::never(), adaptive));
+}
+
+TEST(AdaptiveSteps, coarse_lattice_reaches_the_start) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 40, 40, r2d2::GridMap::FREE};
+    for (int x = 15; x < 25; x++) {
+        for (int y = 15; y < 25; y++) {
+            grid.set_cell(x, y, r2d2::GridMap::OBSTACLE);
+        }
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+    // the start lies between the nodes of the lattice of twice the step,
+    // without overlapping any of them
+    r2d2::Coordinate start{make_coordinate(2.2, 2.7)},
+            goal{make_coordinate(37.6, 36.1)};
+
+    for (const r2d2::SearchSettings &settings : {
+            r2d2::SearchSettings{r2d2::CollisionChecking::EAGER, 2},
+            r2d2::SearchSettings{r2d2::CollisionChecking::EAGER, 2, 1, 4}}) {
+        std::vector<r2d2::Coordinate> path;
+        ASSERT_TRUE(pathFinder.get_path_to_coordinate(
+                start, goal, path, r2d2::CancellationToken::never(),
+                settings));
+        EXPECT_TRUE(is_clear(grid, start, path));
+        ASSERT_FALSE(path.empty());
+        EXPECT_EQ(0, (path.back() - goal).get_length() /
+                     r2d2::Length::METER);
+    }
+}
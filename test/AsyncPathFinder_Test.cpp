@@ -0,0 +1,136 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   AsyncPathFinder_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the asynchronous query api
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AsyncPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+
+namespace {
+
+    r2d2::Coordinate make_coordinate(double x, double y) {
+        return {x * r2d2::Length::METER, y * r2d2::Length::METER,
+                0 * r2d2::Length::METER};
+    }
+
+    const r2d2::Translation robotBox{.5 * r2d2::Length::METER,
+                                     .5 * r2d2::Length::METER,
+                                     0 * r2d2::Length::METER};
+
+    // an open map split by a wall through the middle, with a gap at the
+    // top. a query between the bottoms of both halves floods most of the
+    // map before it goes around the wall
+    std::vector<std::vector<int>> make_split_map(int size) {
+        std::vector<std::vector<int>> map(std::size_t(size),
+                                          std::vector<int>(std::size_t(size), 0));
+        for (int y = 0; y < size - 1; y++) {
+            map[y][size / 2] = 1;
+        }
+        return map;
+    }
+
+}
+
+TEST(AsyncPathFinder, finds_path) {
+    r2d2::Dummy map(50, 50, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    r2d2::AsyncPathFinder async{pf, 2};
+
+    r2d2::PathQuery query{async.submit(make_coordinate(.5, .5),
+                                       make_coordinate(49.5, 49.5))};
+    const r2d2::PathResult &result = query.get();
+    EXPECT_EQ(r2d2::PathResult::Status::FOUND, result.status);
+    EXPECT_FALSE(result.path.empty());
+
+    r2d2::PathQuery blocked{async.submit(make_coordinate(.5, .5),
+                                         make_coordinate(50.5, 50.5))};
+    EXPECT_EQ(r2d2::PathResult::Status::NOT_FOUND, blocked.get().status);
+}
+
+TEST(AsyncPathFinder, cancel) {
+    r2d2::Dummy map(make_split_map(400));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    r2d2::AsyncPathFinder async{pf, 1};
+    // a short query first, so the connectivity index of the map is made
+    // before the timing starts
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_coordinate(make_coordinate(.5, .5),
+                                          make_coordinate(2.5, .5), path));
+
+    r2d2::PathQuery query{async.submit(make_coordinate(190.5, .5),
+                                       make_coordinate(210.5, .5))};
+    // give the search some time to get going
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(query.is_ready());
+
+    auto cancelled = std::chrono::steady_clock::now();
+    query.cancel();
+    EXPECT_EQ(r2d2::PathResult::Status::CANCELLED, query.get().status);
+    // the search stops at the next expansion, most of the time left is the
+    // cleanup of the search
+    EXPECT_LT(std::chrono::steady_clock::now() - cancelled,
+              std::chrono::milliseconds(500));
+}
+
+TEST(AsyncPathFinder, supersede) {
+    r2d2::Dummy map(make_split_map(400));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    r2d2::AsyncPathFinder async{pf, 1};
+
+    r2d2::PathQuery first{async.submit(1, make_coordinate(190.5, .5),
+                                       make_coordinate(210.5, .5))},
+            other{async.submit(2, make_coordinate(10.5, .5),
+                               make_coordinate(10.5, 10.5))},
+            second{async.submit(1, make_coordinate(.5, 10.5),
+                                make_coordinate(20.5, 20.5))};
+
+    EXPECT_EQ(r2d2::PathResult::Status::CANCELLED, first.get().status);
+    EXPECT_EQ(r2d2::PathResult::Status::FOUND, other.get().status);
+    EXPECT_EQ(r2d2::PathResult::Status::FOUND, second.get().status);
+}
@@ -0,0 +1,125 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   BatchedMap_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Tests for batched box queries
+//!
+//! Checks that batched box queries give the same answers as single queries.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <random>
+#include "../source/include/BatchedMap.hpp"
+#include "../source/include/Dummy.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/QuadTreeMap.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * compare the batched answers to single queries, for batches of close
+     * boxes like those of a search, and of boxes spread over the map
+     */
+    void expect_same_answers(r2d2::ReadOnlyMap &map, double size) {
+        std::mt19937 random{5};
+        std::uniform_real_distribution<double> position{-2, size + 2},
+                extent{0, 3}, offset{-1.5, 1.5};
+        std::vector<r2d2::Box> boxes;
+        r2d2::BoxBatch batch{map};
+        for (int round = 0; round < 200; round++) {
+            boxes.clear();
+            double x = position(random), y = position(random);
+            for (int i = 0; i < round % 12; i++) {
+                if (round % 2 == 0) {
+                    x = position(random);
+                    y = position(random);
+                }
+                r2d2::Coordinate corner{make_coordinate(x + offset(random),
+                                                        y + offset(random))};
+                boxes.push_back(r2d2::Box{corner, r2d2::Translation{
+                        extent(random) * r2d2::Length::METER,
+                        extent(random) * r2d2::Length::METER,
+                        0 * r2d2::Length::METER}});
+            }
+            batch.clear();
+            for (const r2d2::Box &box : boxes) {
+                batch.add(box);
+            }
+            batch.query();
+            ASSERT_EQ(boxes.size(), batch.size());
+            for (std::size_t i = 0; i < boxes.size(); i++) {
+                r2d2::BoxInfo expected{map.get_box_info(boxes[i])};
+                EXPECT_EQ(expected.get_has_obstacle(),
+                          batch.get_info(i).get_has_obstacle())
+                                    << round << " " << i;
+                EXPECT_EQ(expected.get_has_navigable(),
+                          batch.get_info(i).get_has_navigable())
+                                    << round << " " << i;
+                EXPECT_EQ(expected.get_has_unknown(),
+                          batch.get_info(i).get_has_unknown())
+                                    << round << " " << i;
+            }
+        }
+    }
+
+}
+
+TEST(BatchedMap, same_answers_as_single_queries) {
+    r2d2::GridMap grid{make_coordinate(-.5, .25), .5 * r2d2::Length::METER,
+                       40, 30, r2d2::GridMap::FREE};
+    std::mt19937 random{3};
+    for (int y = 0; y < 30; y++) {
+        for (int x = 0; x < 40; x++) {
+            grid.set_cell(x, y, uint8_t(random() % 5 == 0 ? random() % 3 :
+                                        r2d2::GridMap::FREE));
+        }
+    }
+    expect_same_answers(grid, 20);
+
+    r2d2::Dummy dummy{make_seeded_map(20, 20, .3f, 3)};
+    dummy.set_cell(3, 3, 2);
+    dummy.set_cell(4, 3, 2);
+    expect_same_answers(dummy, 20);
+
+    // a map without batching is queried one box at a time
+    r2d2::QuadTreeMap quadTree{grid};
+    expect_same_answers(quadTree, 20);
+}
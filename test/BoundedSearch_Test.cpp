@@ -0,0 +1,214 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   BoundedSearch_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the lattice search within a memory budget
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * a free map of 120x40 cells with a wall at x = 60 that has a gap at the
+     * top, so the search has to flood the left half before going around
+     */
+    r2d2::GridMap make_wall_map() {
+        r2d2::GridMap grid{{}, r2d2::Length::METER, 120, 40,
+                           r2d2::GridMap::FREE};
+        for (int i = 0; i < 36; i++) {
+            grid.set_cell(60, i, r2d2::GridMap::OBSTACLE);
+        }
+        return grid;
+    }
+
+    /**
+     * check that every segment of a path is clear for the whole robot
+     */
+    void expect_clear(r2d2::GridMap &grid, r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        for (const r2d2::Coordinate &to : path) {
+            r2d2::Coordinate low{std::min(from.get_x(), to.get_x()),
+                                 std::min(from.get_y(), to.get_y()),
+                                 0 * r2d2::Length::METER},
+                    high{std::max(from.get_x(), to.get_x()),
+                         std::max(from.get_y(), to.get_y()),
+                         0 * r2d2::Length::METER};
+            r2d2::BoxInfo info{grid.get_box_info(
+                    r2d2::Box{low - robotBox / 2, high + robotBox / 2})};
+            EXPECT_FALSE(info.get_has_obstacle() || info.get_has_unknown())
+                    << from << " " << to;
+            from = to;
+        }
+    }
+
+    r2d2::Length get_length(r2d2::Coordinate from,
+                            const std::vector<r2d2::Coordinate> &path) {
+        r2d2::Length length{0 * r2d2::Length::METER};
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length();
+            from = to;
+        }
+        return length;
+    }
+
+}
+
+TEST(BoundedSearch, large_budget_is_optimal) {
+    r2d2::GridMap grid{make_wall_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+    r2d2::Coordinate start{make_coordinate(10.5, 2.5)},
+            goal{make_coordinate(110.5, 2.5)};
+
+    std::vector<r2d2::Coordinate> path, expected;
+    r2d2::BoundedSearchInfo info;
+    std::size_t budget = 64 << 20;
+    ASSERT_TRUE(pf.get_path_to_coordinate_bounded(start, goal, path, budget,
+                                                  &info));
+    EXPECT_TRUE(info.optimal);
+    EXPECT_EQ(0, info.prunedNodes);
+    EXPECT_GT(info.expandedNodes, 0);
+    EXPECT_LE(info.peakMemory, budget);
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(0, (path.back() - goal).get_length() / r2d2::Length::METER);
+    expect_clear(grid, start, path);
+
+    // the unlimited search does not wait for the start to be expanded, so
+    // its path can only be as short
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, expected));
+    EXPECT_LE(get_length(start, path) / r2d2::Length::METER,
+              get_length(start, expected) / r2d2::Length::METER + 1e-6);
+}
+
+TEST(BoundedSearch, small_budget_prunes) {
+    r2d2::GridMap grid{make_wall_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+    r2d2::Coordinate start{make_coordinate(10.5, 2.5)},
+            goal{make_coordinate(110.5, 2.5)};
+
+    r2d2::BoundedSearchInfo unlimited;
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_coordinate_bounded(start, goal, path, 64 << 20,
+                                                  &unlimited));
+
+    std::size_t budget = unlimited.peakMemory / 4;
+    r2d2::BoundedSearchInfo info;
+    ASSERT_TRUE(pf.get_path_to_coordinate_bounded(start, goal, path, budget,
+                                                  &info));
+    EXPECT_GT(info.prunedNodes, 0);
+    EXPECT_LE(info.peakMemory, budget);
+    EXPECT_EQ(0, (path.back() - goal).get_length() / r2d2::Length::METER);
+    expect_clear(grid, start, path);
+
+    // a budget without room for any node
+    EXPECT_FALSE(pf.get_path_to_coordinate_bounded(start, goal, path, 64,
+                                                   &info));
+    EXPECT_FALSE(info.optimal);
+}
+
+TEST(BoundedSearch, dropped_nodes_count_as_pruned) {
+    // a corridor of a single lane, searched from its dead end, so the
+    // nodes in memory are a chain without a leaf that could be pruned
+    r2d2::GridMap grid{{}, .5 * r2d2::Length::METER, 40, 4,
+                       r2d2::GridMap::FREE};
+    for (int x = 0; x < 40; x++) {
+        grid.set_cell(x, 0, r2d2::GridMap::OBSTACLE);
+        grid.set_cell(x, 3, r2d2::GridMap::OBSTACLE);
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+    r2d2::Coordinate start{make_coordinate(19.25, .75)},
+            goal{make_coordinate(.25, .75)};
+
+    std::vector<r2d2::Coordinate> path;
+    r2d2::BoundedSearchInfo unlimited, info;
+    ASSERT_TRUE(pf.get_path_to_coordinate_bounded(start, goal, path, 64 << 20,
+                                                  &unlimited));
+    ASSERT_TRUE(unlimited.optimal);
+    EXPECT_EQ(0, unlimited.prunedNodes);
+
+    // the budgets that leave room for some nodes but not for the chain,
+    // so the next node is dropped
+    int tooSmall = 0;
+    for (std::size_t budget = 256; budget < unlimited.peakMemory;
+         budget = budget * 5 / 4) {
+        if (pf.get_path_to_coordinate_bounded(start, goal, path, budget,
+                                              &info)) {
+            break;
+        }
+        if (info.peakMemory > 0) {
+            SCOPED_TRACE(budget);
+            EXPECT_GT(info.prunedNodes, 0);
+            EXPECT_FALSE(info.optimal);
+            tooSmall++;
+        }
+    }
+    EXPECT_GT(tooSmall, 0);
+}
+
+TEST(BoundedSearch, pruning_costly_nodes_stays_optimal) {
+    // on an open map the nodes beside the path cost more than the path, and
+    // are the first to be pruned
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 200, 200, r2d2::GridMap::FREE};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+    r2d2::Coordinate start{make_coordinate(20.5, 100.5)},
+            goal{make_coordinate(180.5, 130.5)};
+
+    std::vector<r2d2::Coordinate> path;
+    r2d2::BoundedSearchInfo unlimited, info;
+    ASSERT_TRUE(pf.get_path_to_coordinate_bounded(start, goal, path, 64 << 20,
+                                                  &unlimited));
+    ASSERT_TRUE(unlimited.optimal);
+    ASSERT_TRUE(pf.get_path_to_coordinate_bounded(
+            start, goal, path, unlimited.peakMemory / 2, &info));
+    EXPECT_GT(info.prunedNodes, 0);
+    EXPECT_TRUE(info.optimal);
+    EXPECT_LE(info.peakMemory, unlimited.peakMemory / 2);
+    expect_clear(grid, start, path);
+}
@@ -0,0 +1,211 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CoalescingPathFinder_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Coalescing pathfinder tests
+//!
+//! Tests the sharing of searches between equivalent queries.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <thread>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/CoalescingPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+
+namespace {
+
+    const r2d2::Translation robotBox{.5 * r2d2::Length::METER,
+                                     .5 * r2d2::Length::METER,
+                                     0 * r2d2::Length::METER};
+
+    r2d2::Coordinate at(double x, double y) {
+        return r2d2::Coordinate{x * r2d2::Length::METER,
+                                y * r2d2::Length::METER,
+                                0 * r2d2::Length::METER};
+    }
+
+    /**
+     * pathfinder whose searches wait until they are let through, and
+     * answer with the goal
+     */
+    class GatedPathFinder : public r2d2::PathFinder {
+    public:
+        GatedPathFinder(SharedObject<r2d2::ReadOnlyMap> &map) :
+                PathFinder{map, {{}, robotBox}}, searches{0}, open{false} {
+        }
+
+        virtual bool get_path_to_coordinate(
+                r2d2::Coordinate start, r2d2::Coordinate goal,
+                std::vector<r2d2::Coordinate> &path) override {
+            std::unique_lock<std::mutex> lock{mutex};
+            searches++;
+            changed.notify_all();
+            changed.wait(lock, [this]() {
+                return open;
+            });
+            path = {goal};
+            return true;
+        }
+
+        void wait_for_searches(int count) {
+            std::unique_lock<std::mutex> lock{mutex};
+            changed.wait(lock, [this, count]() {
+                return searches >= count;
+            });
+        }
+
+        void let_through() {
+            std::lock_guard<std::mutex> lock{mutex};
+            open = true;
+            changed.notify_all();
+        }
+
+        int get_searches() {
+            std::lock_guard<std::mutex> lock{mutex};
+            return searches;
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable changed;
+        int searches;
+        bool open;
+    };
+
+}
+
+TEST(CoalescingPathFinder, equivalent_queries_share_a_search) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 10, 10, r2d2::GridMap::FREE};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::MapAccessGroup mapAccess{sharedMap};
+    GatedPathFinder gated{sharedMap};
+    r2d2::CoalescingPathFinder coalescing{sharedMap, {{}, robotBox}, gated,
+                                          mapAccess};
+
+    std::vector<std::vector<r2d2::Coordinate>> paths(5);
+    std::vector<std::thread> threads;
+    auto query = [&](int i, r2d2::Coordinate start, r2d2::Coordinate goal) {
+        threads.emplace_back([&, i, start, goal]() {
+            EXPECT_TRUE(coalescing.get_path_to_coordinate(start, goal,
+                                                          paths[i]));
+        });
+    };
+    auto wait_for_coalesced = [&](uint64_t count) {
+        while (coalescing.get_statistics().coalesced < count) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    query(0, at(1, 1), at(8, 8));
+    gated.wait_for_searches(1);
+    // within the same cells of the running query
+    query(1, at(1.001, 1), at(8, 8.002));
+    query(2, at(1, 1), at(8, 8));
+    wait_for_coalesced(2);
+    // another goal cell
+    query(3, at(1, 1), at(8.02, 8));
+    gated.wait_for_searches(2);
+    // another map version, no query holds the map while they wait
+    grid.set_cell(0, 0, r2d2::GridMap::OBSTACLE);
+    query(4, at(1, 1), at(8, 8));
+    gated.wait_for_searches(3);
+
+    gated.let_through();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(3, gated.get_searches());
+    for (int i : {1, 2, 4}) {
+        ASSERT_EQ(1u, paths[i].size());
+        EXPECT_EQ(0, (paths[i][0] - at(8, 8)).get_length() /
+                     r2d2::Length::METER);
+    }
+    r2d2::CoalescingStatistics statistics{coalescing.get_statistics()};
+    EXPECT_EQ(5u, statistics.queries);
+    EXPECT_EQ(3u, statistics.searches);
+    EXPECT_EQ(2u, statistics.coalesced);
+    EXPECT_EQ(3u, statistics.largestGroup);
+    EXPECT_DOUBLE_EQ(.4, statistics.get_dedup_rate());
+
+    // a query after the search finished runs its own
+    coalescing.reset_statistics();
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_TRUE(coalescing.get_path_to_coordinate(at(1, 1), at(8, 8), path));
+    EXPECT_EQ(4, gated.get_searches());
+    EXPECT_EQ(1u, coalescing.get_statistics().searches);
+}
+
+TEST(CoalescingPathFinder, shares_searches_of_a_pathfinder) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 40, 40, r2d2::GridMap::FREE};
+    for (int y = 5; y < 40; y++) {
+        grid.set_cell(20, y, r2d2::GridMap::OBSTACLE);
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+    r2d2::CoalescingPathFinder coalescing{sharedMap, {{}, robotBox},
+                                          pathFinder,
+                                          pathFinder.get_map_access()};
+
+    const int threadCount = 4, queryCount = 20;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < queryCount; i++) {
+                std::vector<r2d2::Coordinate> path;
+                r2d2::Coordinate goal{at(35.5, 30.5 + i % 2)};
+                EXPECT_TRUE(coalescing.get_path_to_coordinate(
+                        at(2.5, 30.5), goal, path));
+                ASSERT_FALSE(path.empty());
+                EXPECT_EQ(0, (path.back() - goal).get_length() /
+                             r2d2::Length::METER);
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    r2d2::CoalescingStatistics statistics{coalescing.get_statistics()};
+    EXPECT_EQ(uint64_t(threadCount * queryCount), statistics.queries);
+    EXPECT_EQ(statistics.queries,
+              statistics.searches + statistics.coalesced);
+}
@@ -0,0 +1,166 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CollisionChecking_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Tests for lazy collision checking
+//!
+//! Checks that lazy collision checking finds paths as short as eager checking
+//! with fewer map queries.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../source/include/VersionedMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * map that counts the box queries made on another map, and has its
+     * version
+     */
+    class CountingMap : public r2d2::ReadOnlyMap, public r2d2::VersionedMap {
+    public:
+        CountingMap(r2d2::ReadOnlyMap &map) : map(map), count{0} {
+        }
+
+        virtual const r2d2::BoxInfo get_box_info(const r2d2::Box box) override {
+            count++;
+            return map.get_box_info(box);
+        }
+
+        virtual const r2d2::Box get_map_bounding_box() override {
+            return map.get_map_bounding_box();
+        }
+
+        virtual uint64_t get_map_version() const override {
+            return r2d2::VersionedMap::get_version_of(map);
+        }
+
+        r2d2::ReadOnlyMap &map;
+        int count;
+    };
+
+    double get_length(r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length() / r2d2::Length::METER;
+            from = to;
+        }
+        return length;
+    }
+
+}
+
+TEST(CollisionChecking, lazy_is_as_short_with_fewer_queries) {
+    for (r2d2::ScenarioKind kind : {r2d2::ScenarioKind::RANDOM,
+                                    r2d2::ScenarioKind::CAVES,
+                                    r2d2::ScenarioKind::ROOMS}) {
+        r2d2::ScenarioGenerator generator{
+                kind, 64, 64, 9, kind == r2d2::ScenarioKind::CAVES ? .45 : .2};
+        r2d2::Scenario scenario{generator.make_scenario(8, 1)};
+        CountingMap counting{scenario.map};
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{counting};
+        r2d2::AStarPathFinder eager{sharedMap, {{}, robotBox}},
+                lazy{sharedMap, {{}, robotBox}};
+        lazy.set_collision_checking(r2d2::CollisionChecking::LAZY);
+        // the connectivity index is made up front, so only the searches
+        // are counted
+        r2d2::PrecomputationBundle bundle;
+        eager.save_precomputation(bundle);
+        lazy.save_precomputation(bundle);
+
+        int eagerQueries = 0, lazyQueries = 0;
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            std::vector<r2d2::Coordinate> eagerPath, lazyPath;
+            counting.count = 0;
+            ASSERT_TRUE(eager.get_path_to_coordinate(query.start, query.goal,
+                                                     eagerPath));
+            eagerQueries += counting.count;
+            counting.count = 0;
+            ASSERT_TRUE(lazy.get_path_to_coordinate(query.start, query.goal,
+                                                    lazyPath));
+            lazyQueries += counting.count;
+
+            // both are shortest on the lattice, which contains the reference
+            EXPECT_LE(get_length(query.start, lazyPath),
+                      query.referenceCost / r2d2::Length::METER + 1e-6);
+            r2d2::Coordinate from{query.start};
+            for (const r2d2::Coordinate &to : lazyPath) {
+                r2d2::Coordinate low{std::min(from.get_x(), to.get_x()),
+                                     std::min(from.get_y(), to.get_y()),
+                                     0 * r2d2::Length::METER},
+                        high{std::max(from.get_x(), to.get_x()),
+                             std::max(from.get_y(), to.get_y()),
+                             0 * r2d2::Length::METER};
+                r2d2::BoxInfo info{scenario.map.get_box_info(
+                        r2d2::Box{low - robotBox / 2, high + robotBox / 2})};
+                EXPECT_FALSE(info.get_has_obstacle() ||
+                             info.get_has_unknown()) << from << " " << to;
+                from = to;
+            }
+        }
+        EXPECT_LT(lazyQueries, eagerQueries) << int(kind);
+    }
+}
+
+TEST(CollisionChecking, lazy_reports_unreachable_goals) {
+    // a wall splits the map, the pocket behind it is unreachable
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 20, 20, r2d2::GridMap::FREE};
+    for (int i = 0; i < 20; i++) {
+        grid.set_cell(10, i, r2d2::GridMap::OBSTACLE);
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder lazy{sharedMap, {{}, robotBox}};
+    lazy.set_collision_checking(r2d2::CollisionChecking::LAZY);
+    std::vector<r2d2::Coordinate> path;
+    r2d2::Coordinate start{2.5 * r2d2::Length::METER,
+                           2.5 * r2d2::Length::METER, 0 * r2d2::Length::METER};
+    EXPECT_FALSE(lazy.get_path_to_coordinate(
+            start, {15.5 * r2d2::Length::METER, 2.5 * r2d2::Length::METER,
+                    0 * r2d2::Length::METER}, path));
+    EXPECT_TRUE(lazy.get_path_to_coordinate(
+            start, {7.5 * r2d2::Length::METER, 17.5 * r2d2::Length::METER,
+                    0 * r2d2::Length::METER}, path));
+}
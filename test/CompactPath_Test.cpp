@@ -0,0 +1,164 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CompactPath_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Tests for the compact path
+//!
+//! Checks the rounding, the views and the pathfinder functions of compact
+//! paths.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/CompactPath.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+
+TEST(CompactPath, rounding_errors_do_not_add_up) {
+    std::mt19937 random{11};
+    std::uniform_real_distribution<double> step{-3, 3};
+    r2d2::Coordinate origin{make_coordinate(1000.123, -42.987)};
+    std::vector<r2d2::Coordinate> points;
+    double x = 1000, y = -40;
+    for (int i = 0; i < 10000; i++) {
+        x += step(random);
+        y += step(random);
+        points.push_back(make_coordinate(x, y));
+    }
+    r2d2::CompactPath path{origin, points};
+    ASSERT_EQ(points.size(), path.size());
+    std::size_t i = 0;
+    for (r2d2::Coordinate point : path) {
+        EXPECT_LE((point - points[i]).get_length() / r2d2::Length::METER,
+                  .0005 * std::sqrt(2) + 1e-9) << i;
+        i++;
+    }
+    EXPECT_EQ(points.size(), i);
+    // steps of at most three meters take at most three bytes per axis
+    EXPECT_LE(path.get_bytes().size(),
+              r2d2::CompactPathView::HEADER_SIZE + 6 * points.size());
+
+    // a coarser resolution rounds the waypoints further
+    path.assign(origin, points, .25 * r2d2::Length::METER);
+    std::vector<r2d2::Coordinate> decoded;
+    path.decode(decoded);
+    ASSERT_EQ(points.size(), decoded.size());
+    for (i = 0; i < points.size(); i++) {
+        EXPECT_LE(std::abs((decoded[i] - points[i]).get_x() /
+                           r2d2::Length::METER), .125 + 1e-9);
+    }
+}
+
+TEST(CompactPath, views_read_received_memory) {
+    std::vector<r2d2::Coordinate> points{make_coordinate(1, 2),
+                                         make_coordinate(-3.5, 2),
+                                         make_coordinate(-3.5, 7.25)};
+    r2d2::CompactPath path{make_coordinate(.5, .5), points};
+    // the bytes are used as they arrive, after the header of a message
+    std::vector<uint8_t> message{1, 2, 3};
+    message.insert(message.end(), path.get_bytes().begin(),
+                   path.get_bytes().end());
+    r2d2::CompactPathView view{message.data() + 3, message.size() - 3};
+    EXPECT_EQ(message.data() + 3, view.data());
+    ASSERT_EQ(3u, view.size());
+    std::size_t i = 0;
+    for (r2d2::Coordinate point : view) {
+        EXPECT_EQ(0, (point - points[i++]).get_length() /
+                     r2d2::Length::METER);
+    }
+    EXPECT_EQ(0, (view.get_origin() - make_coordinate(.5, .5)).get_length() /
+                 r2d2::Length::METER);
+    r2d2::CompactPath copy{view};
+    EXPECT_EQ(path.get_bytes(), copy.get_bytes());
+
+    // a path that ends early or has trailing data is rejected
+    EXPECT_THROW((r2d2::CompactPathView{message.data() + 3, 20}),
+                 std::runtime_error);
+    EXPECT_THROW((r2d2::CompactPathView{message.data() + 3,
+                                        message.size() - 4}),
+                 std::runtime_error);
+    message.push_back(0);
+    EXPECT_THROW((r2d2::CompactPathView{message.data() + 3,
+                                        message.size() - 3}),
+                 std::runtime_error);
+    EXPECT_TRUE(r2d2::CompactPath{}.empty());
+}
+
+TEST(CompactPath, made_and_repaired_by_the_pathfinder) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 30, 30, r2d2::GridMap::FREE};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+    r2d2::Coordinate start{make_coordinate(2.5, 2.5)},
+            goal{make_coordinate(27.5, 20.5)};
+    std::vector<r2d2::Coordinate> expected;
+    ASSERT_TRUE(pathFinder.get_path_to_coordinate(start, goal, expected));
+    r2d2::CompactPath path;
+    ASSERT_TRUE(pathFinder.get_compact_path(start, goal, path));
+    EXPECT_EQ(0, (path.get_origin() - start).get_length() /
+                 r2d2::Length::METER);
+    std::vector<r2d2::Coordinate> decoded;
+    path.decode(decoded);
+    ASSERT_EQ(expected.size(), decoded.size());
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        EXPECT_LT((expected[i] - decoded[i]).get_length() /
+                  r2d2::Length::METER, .001);
+    }
+
+    EXPECT_EQ(r2d2::PathRepair::Status::VALID,
+              pathFinder.repair_path(start, path).status);
+    // a wall across the straight line forces a detour
+    for (int y = 0; y < 25; y++) {
+        grid.set_cell(15, y, r2d2::GridMap::OBSTACLE);
+    }
+    EXPECT_NE(r2d2::PathRepair::Status::VALID,
+              pathFinder.repair_path(start, path).status);
+    EXPECT_EQ(r2d2::PathRepair::Status::VALID,
+              pathFinder.repair_path(start, path).status);
+    EXPECT_EQ(0, (path.get_origin() - start).get_length() /
+                 r2d2::Length::METER);
+    path.decode(decoded);
+    ASSERT_FALSE(decoded.empty());
+    EXPECT_LT((decoded.back() - goal).get_length() / r2d2::Length::METER,
+              .001);
+}
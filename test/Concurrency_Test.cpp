@@ -0,0 +1,226 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   Concurrency_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! stress tests for running queries on a single pathfinder from multiple
+//! threads. build with R2D2_PATHFINDING_TSAN enabled to check them with
+//! ThreadSanitizer.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/MapAccessGroup.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    struct Query {
+        r2d2::Coordinate start, goal;
+    };
+
+    std::vector<Query> make_queries(int count, int x, int y, unsigned seed) {
+        std::mt19937_64 random{seed};
+        std::uniform_int_distribution<int> xDist{0, x - 1}, yDist{0, y - 1};
+        std::vector<Query> queries;
+        for (int i = 0; i < count; i++) {
+            queries.push_back({{(xDist(random) + .5) * r2d2::Length::METER,
+                                (yDist(random) + .5) * r2d2::Length::METER,
+                                0 * r2d2::Length::METER},
+                               {(xDist(random) + .5) * r2d2::Length::METER,
+                                (yDist(random) + .5) * r2d2::Length::METER,
+                                0 * r2d2::Length::METER}});
+        }
+        return queries;
+    }
+
+    //! a lattice step, the most the paths of two searches may differ in length
+    const double LENGTH_TOLERANCE = .5;
+
+    double get_length(r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length() / r2d2::Length::METER;
+            from = to;
+        }
+        return length;
+    }
+
+}
+
+TEST(Concurrency, shared_instance) {
+    r2d2::Dummy map(make_seeded_map(40, 40, .2f, 7));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    std::vector<Query> queries{make_queries(40, 40, 40, 11)};
+
+    // without and with kept searches
+    for (std::size_t budget : {std::size_t(0), std::size_t(64) << 20}) {
+        r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+        pf.set_kept_search_budget(budget);
+
+        // the answers of a single thread are the reference
+        std::vector<bool> found;
+        std::vector<double> lengths;
+        for (Query &query : queries) {
+            std::vector<r2d2::Coordinate> path;
+            found.push_back(pf.get_path_to_coordinate(query.start, query.goal,
+                                                      path));
+            lengths.push_back(get_length(query.start, path));
+        }
+
+        const int threadCount = 8;
+        std::vector<int> mismatches(threadCount, 0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([&, t]() {
+                // every thread walks the queries in a different order
+                for (std::size_t i = 0; i < queries.size(); i++) {
+                    std::size_t q = (i * 7 + std::size_t(t) * 5) %
+                                    queries.size();
+                    std::vector<r2d2::Coordinate> path;
+                    bool result = pf.get_path_to_coordinate(queries[q].start,
+                                                            queries[q].goal,
+                                                            path);
+                    // a kept search can reach the start through another
+                    // node around it than a new search, so the paths can
+                    // differ, but not by more than a lattice step
+                    if (result != found[q] ||
+                        (result && std::abs(get_length(queries[q].start, path) -
+                                            lengths[q]) > LENGTH_TOLERANCE)) {
+                        mismatches[t]++;
+                    }
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        for (int t = 0; t < threadCount; t++) {
+            EXPECT_EQ(0, mismatches[t]) << "thread " << t << " " << budget;
+        }
+    }
+}
+
+TEST(Concurrency, shared_distance_field) {
+    r2d2::Dummy map(make_seeded_map(40, 40, .1f, 3));
+    map.set_cell(20, 20, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    r2d2::Coordinate goal{20.5 * r2d2::Length::METER,
+                          20.5 * r2d2::Length::METER,
+                          0 * r2d2::Length::METER};
+    std::vector<Query> queries{make_queries(20, 40, 40, 5)};
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t]() {
+            std::shared_ptr<const r2d2::DistanceField> field{
+                    pf.get_distance_field(goal, 2)};
+            if (field == nullptr) {
+                failures[t]++;
+                return;
+            }
+            for (Query &query : queries) {
+                std::vector<r2d2::Coordinate> path;
+                if (pf.get_path_from_field(*field, query.start, path) &&
+                    (path.back() - goal).get_length() / r2d2::Length::METER != 0) {
+                    failures[t]++;
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (int t = 0; t < 4; t++) {
+        EXPECT_EQ(0, failures[t]) << "thread " << t;
+    }
+}
+
+TEST(Concurrency, map_access_does_not_wait_for_joiners) {
+    r2d2::Dummy map(4, 4, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::MapAccessGroup mapAccess{sharedMap};
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool joined = false, released = false;
+
+    std::unique_ptr<r2d2::MapAccessGroup::Lease> opener{
+            new r2d2::MapAccessGroup::Lease{mapAccess}};
+    std::thread joiner{[&]() {
+        r2d2::MapAccessGroup::Lease lease{mapAccess};
+        std::unique_lock<std::mutex> lock{mutex};
+        joined = true;
+        changed.notify_all();
+        changed.wait(lock, [&]() {
+            return released;
+        });
+    }};
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        changed.wait(lock, [&]() {
+            return joined;
+        });
+    }
+    // the opener leaves while the joiner still reads the map, which would
+    // block forever if it waited for the joiner
+    opener.reset();
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        released = true;
+    }
+    changed.notify_all();
+    joiner.join();
+
+    // the last lease closed the accessor, so the map can be locked again
+    SharedObject<r2d2::ReadOnlyMap>::Accessor accessor{sharedMap};
+    r2d2::BoxInfo info{accessor.access().get_box_info(
+            r2d2::Box{make_coordinate(1, 1), make_coordinate(2, 2)})};
+    EXPECT_FALSE(info.get_has_obstacle());
+}
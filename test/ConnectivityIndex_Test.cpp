@@ -0,0 +1,329 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ConnectivityIndex_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Connectivity index tests
+//!
+//! Tests for the connected components of the free space and the rejection of
+//! queries between them.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/VersionedMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * map that counts the box queries made on another map, and has its
+     * version
+     */
+    class CountingMap : public r2d2::ReadOnlyMap, public r2d2::VersionedMap {
+    public:
+        CountingMap(r2d2::ReadOnlyMap &map) : map(map), count{0} {
+        }
+
+        virtual const r2d2::BoxInfo get_box_info(const r2d2::Box box) override {
+            count++;
+            return map.get_box_info(box);
+        }
+
+        virtual const r2d2::Box get_map_bounding_box() override {
+            return map.get_map_bounding_box();
+        }
+
+        virtual uint64_t get_map_version() const override {
+            return r2d2::VersionedMap::get_version_of(map);
+        }
+
+        r2d2::ReadOnlyMap &map;
+        int count;
+    };
+
+    /**
+     * check that two indices divide the positions of a map the same way
+     */
+    void expect_same_components(const r2d2::ConnectivityIndex &expected,
+                                const r2d2::ConnectivityIndex &actual,
+                                double width, double height,
+                                double minX = 0, double minY = 0) {
+        EXPECT_EQ(expected.get_component_count(), actual.get_component_count());
+        // the labels may differ, but have to map one to one
+        std::map<int, int> forward, backward;
+        for (double y = minY - 1.1; y < height + 1; y += .25) {
+            for (double x = minX - 1.1; x < width + 1; x += .25) {
+                r2d2::Coordinate coord{make_coordinate(x, y)};
+                int a = expected.get_component(coord),
+                        b = actual.get_component(coord);
+                ASSERT_EQ(a < 0, b < 0) << coord;
+                if (a >= 0) {
+                    ASSERT_EQ(b, forward.insert({a, b}).first->second) << coord;
+                    ASSERT_EQ(a, backward.insert({b, a}).first->second) << coord;
+                }
+            }
+        }
+    }
+
+}
+
+TEST(ConnectivityIndex, components) {
+    // two rooms with a wall in between
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 20, 10, r2d2::GridMap::FREE};
+    for (int y = 0; y < 10; y++) {
+        grid.set_cell(10, y, r2d2::GridMap::OBSTACLE);
+    }
+    r2d2::ConnectivityIndex index{grid, robotBox};
+    EXPECT_EQ(grid.get_map_version(), index.get_map_version());
+    EXPECT_EQ(2, index.get_component_count());
+
+    int left = index.get_component(make_coordinate(2.5, 3.5)),
+            right = index.get_component(make_coordinate(17.5, 8.5));
+    ASSERT_GE(left, 0);
+    ASSERT_GE(right, 0);
+    EXPECT_NE(left, right);
+    EXPECT_EQ(left, index.get_component(make_coordinate(9.6, .3)));
+    EXPECT_EQ(-1, index.get_component(make_coordinate(10.5, 5)));
+    EXPECT_EQ(-1, index.get_component(make_coordinate(-30, 5)));
+    EXPECT_LE(index.get_component_bounds(left).get_top_right().get_x(),
+              10 * r2d2::Length::METER);
+    EXPECT_GE(index.get_component_bounds(right).get_bottom_left().get_x(),
+              11 * r2d2::Length::METER);
+
+    // a door joins the rooms
+    grid.set_cell(10, 4, r2d2::GridMap::FREE);
+    index.update(grid, r2d2::Box{make_coordinate(10, 4), make_coordinate(11, 5)});
+    EXPECT_EQ(grid.get_map_version(), index.get_map_version());
+    EXPECT_EQ(1, index.get_component_count());
+    EXPECT_EQ(index.get_component(make_coordinate(2.5, 3.5)),
+              index.get_component(make_coordinate(17.5, 8.5)));
+    EXPECT_GT(index.get_memory_usage(), 0u);
+}
+
+TEST(ConnectivityIndex, rejects_without_search) {
+    r2d2::Dummy map(200, 200, 0);
+    for (int y = 0; y < 200; y++) {
+        map.set_cell(100, y, 1);
+    }
+    CountingMap counting{map};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{counting};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    // the first query starts making the index in the background
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_coordinate(make_coordinate(10.5, 10.5),
+                                          make_coordinate(12.5, 10.5), path));
+    pf.wait_for_connectivity();
+
+    // without the index, this query would search half of the map
+    counting.count = 0;
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(10.5, 10.5),
+                                           make_coordinate(190.5, 190.5), path));
+    EXPECT_GT(5, counting.count);
+}
+
+TEST(ConnectivityIndex, stale_index_does_not_reject) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 20, 10, r2d2::GridMap::FREE};
+    for (int y = 0; y < 10; y++) {
+        grid.set_cell(10, y, r2d2::GridMap::OBSTACLE);
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(2.5, 3.5),
+                                           make_coordinate(17.5, 8.5), path));
+
+    // a door is opened without updating the index, which is now out of
+    // date and may not be used to reject the query
+    grid.set_cell(10, 4, r2d2::GridMap::FREE);
+    EXPECT_TRUE(pf.get_path_to_coordinate(make_coordinate(2.5, 3.5),
+                                          make_coordinate(17.5, 8.5), path));
+
+
+    // once updated, the index rejects queries again
+    grid.set_cell(10, 4, r2d2::GridMap::OBSTACLE);
+    pf.update_connectivity(r2d2::Box{make_coordinate(10, 4),
+                                     make_coordinate(11, 5)});
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(2.5, 3.5),
+                                           make_coordinate(17.5, 8.5), path));
+}
+
+TEST(ConnectivityIndex, copies_are_independent) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 20, 10, r2d2::GridMap::FREE};
+    for (int y = 0; y < 10; y++) {
+        grid.set_cell(10, y, r2d2::GridMap::OBSTACLE);
+    }
+    r2d2::ConnectivityIndex index{grid, robotBox};
+    uint64_t version = index.get_map_version();
+
+    // the copy shares the labels until it is updated
+    r2d2::ConnectivityIndex copy{index};
+    grid.set_cell(10, 4, r2d2::GridMap::FREE);
+    copy.update(grid, r2d2::Box{make_coordinate(10, 4), make_coordinate(11, 5)});
+    EXPECT_EQ(1, copy.get_component_count());
+    EXPECT_EQ(2, index.get_component_count());
+    EXPECT_EQ(version, index.get_map_version());
+    EXPECT_EQ(-1, index.get_component(make_coordinate(10.5, 4.5)));
+    EXPECT_GE(copy.get_component(make_coordinate(10.5, 4.5)), 0);
+    EXPECT_NE(index.get_component(make_coordinate(2.5, 3.5)),
+              index.get_component(make_coordinate(17.5, 8.5)));
+}
+
+TEST(ConnectivityIndex, update_matches_rebuild) {
+    std::mt19937 random{11};
+    r2d2::GridMap grid{make_coordinate(-2, 3), r2d2::Length::METER, 40, 30,
+                       r2d2::GridMap::FREE};
+    for (int i = 0; i < 300; i++) {
+        grid.set_cell(int(random() % 40), int(random() % 30),
+                      r2d2::GridMap::OBSTACLE);
+    }
+    r2d2::ConnectivityIndex index{grid, robotBox};
+
+    // add and remove blocks of obstacles, splitting and joining components
+    for (int i = 0; i < 60; i++) {
+        int x = int(random() % 40), y = int(random() % 30),
+                size = int(random() % 4) + 1;
+        uint8_t value = random() % 2 ? r2d2::GridMap::OBSTACLE :
+                        r2d2::GridMap::FREE;
+        for (int dy = 0; dy < size && y + dy < 30; dy++) {
+            for (int dx = 0; dx < size && x + dx < 40; dx++) {
+                grid.set_cell(x + dx, y + dy, value);
+            }
+        }
+        index.update(grid, r2d2::Box{
+                make_coordinate(x - 2, y + 3),
+                make_coordinate(x - 2 + size, y + 3 + size)});
+        r2d2::ConnectivityIndex rebuilt{grid, robotBox};
+        SCOPED_TRACE(i);
+        expect_same_components(rebuilt, index, 38, 33);
+    }
+}
+
+TEST(ConnectivityIndex, sound_for_searches) {
+    r2d2::Dummy map(make_seeded_map(50, 50, .35f, 5));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    r2d2::ConnectivityIndex index{map, robotBox};
+
+    // the parallel search does not use the index, so every path it finds
+    // has to be between positions of the same component
+    std::mt19937 random{5};
+    int found = 0;
+    for (int i = 0; i < 60; i++) {
+        r2d2::Coordinate start{make_coordinate(random() % 50 + .5,
+                                               random() % 50 + .5)},
+                goal{make_coordinate(random() % 50 + .5, random() % 50 + .5)};
+        std::vector<r2d2::Coordinate> expected, actual;
+        bool reachable = pf.get_path_to_coordinate_parallel(start, goal,
+                                                            expected, 1);
+        EXPECT_EQ(reachable, pf.get_path_to_coordinate(start, goal, actual))
+            << start << " " << goal;
+        if (reachable && !expected.empty()) {
+            found++;
+            EXPECT_GE(index.get_component(start), 0) << start;
+            EXPECT_EQ(index.get_component(start), index.get_component(goal))
+                << start << " " << goal;
+        }
+    }
+    EXPECT_GT(found, 0);
+}
+
+TEST(ConnectivityIndex, grows_with_the_map) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 20, 10, r2d2::GridMap::FREE};
+    for (int y = 0; y < 10; y++) {
+        grid.set_cell(10, y, r2d2::GridMap::OBSTACLE);
+    }
+    r2d2::ConnectivityIndex index{grid, robotBox};
+
+    // the map grows on every side, so the rooms connect around the wall
+    std::vector<uint8_t> cells(std::size_t(40 * 30), r2d2::GridMap::FREE);
+    for (int y = 10; y < 20; y++) {
+        cells[std::size_t(y * 40 + 20)] = r2d2::GridMap::OBSTACLE;
+    }
+    grid.assign(make_coordinate(-10, -10), r2d2::Length::METER, 40, 30,
+                std::move(cells));
+    index.update(grid, r2d2::Box{make_coordinate(-10, -10),
+                                 make_coordinate(30, 20)});
+    r2d2::ConnectivityIndex rebuilt{grid, robotBox};
+    expect_same_components(rebuilt, index, 30, 20, -10, -10);
+    EXPECT_EQ(index.get_component(make_coordinate(2.5, 3.5)),
+              index.get_component(make_coordinate(17.5, 8.5)));
+    EXPECT_GE(index.get_component(make_coordinate(25.5, 15.5)), 0);
+}
+
+TEST(ConnectivityIndex, updated_after_version_change) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 20, 10, r2d2::GridMap::FREE};
+    for (int y = 0; y < 10; y++) {
+        grid.set_cell(10, y, r2d2::GridMap::OBSTACLE);
+    }
+    grid.set_cell(10, 4, r2d2::GridMap::FREE);
+    CountingMap counting{grid};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{counting};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_TRUE(pf.get_path_to_coordinate(make_coordinate(2.5, 3.5),
+                                          make_coordinate(17.5, 8.5), path));
+    pf.wait_for_connectivity();
+
+    // the door closes, and the map grows beyond the index, without any
+    // call to update_connectivity
+    std::vector<uint8_t> cells{grid.get_cells()};
+    cells[4 * 20 + 10] = r2d2::GridMap::OBSTACLE;
+    std::vector<uint8_t> wider(std::size_t(30 * 10), r2d2::GridMap::FREE);
+    for (int y = 0; y < 10; y++) {
+        std::copy(cells.begin() + y * 20, cells.begin() + (y + 1) * 20,
+                  wider.begin() + y * 30);
+    }
+    grid.assign({}, r2d2::Length::METER, 30, 10, std::move(wider));
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(2.5, 3.5),
+                                           make_coordinate(27.5, 8.5), path));
+    pf.wait_for_connectivity();
+
+    // the updated index covers the new part of the map
+    counting.count = 0;
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(2.5, 3.5),
+                                           make_coordinate(27.5, 8.5), path));
+    EXPECT_GT(5, counting.count);
+}
@@ -0,0 +1,172 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   CooperativePlanner_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Cooperative planner tests
+//!
+//! Tests that the fleets planned by CooperativePlanner arrive without
+//! collisions.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include "../source/include/CooperativePlanner.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    bool is_same(r2d2::Coordinate a, r2d2::Coordinate b) {
+        return (a - b).get_length() / r2d2::Length::METER < 1e-6;
+    }
+
+    /**
+     * check that no two robots share a cell, and that a robot only enters
+     * a cell that is being left when both move the same way
+     */
+    void expect_no_collisions(const r2d2::FleetPlan &plan) {
+        for (std::size_t a = 0; a < plan.paths.size(); a++) {
+            ASSERT_EQ(plan.paths[0].size(), plan.paths[a].size());
+            for (std::size_t t = 1; t < plan.paths[a].size(); t++) {
+                // a single step of the lattice, or a wait
+                EXPECT_LE((plan.paths[a][t] - plan.paths[a][t - 1])
+                                  .get_length() / r2d2::Length::METER, .5001);
+            }
+            for (std::size_t b = 0; b < plan.paths.size(); b++) {
+                if (a == b) {
+                    continue;
+                }
+                for (std::size_t t = 0; t < plan.paths[a].size(); t++) {
+                    EXPECT_FALSE(is_same(plan.paths[a][t], plan.paths[b][t]));
+                    if (t > 0 && is_same(plan.paths[a][t],
+                                         plan.paths[b][t - 1])) {
+                        r2d2::Translation moveA{plan.paths[a][t] -
+                                                plan.paths[a][t - 1]},
+                                moveB{plan.paths[b][t] - plan.paths[b][t - 1]};
+                        EXPECT_LT((moveA - moveB).get_length() /
+                                  r2d2::Length::METER, 1e-6);
+                    }
+                }
+            }
+        }
+    }
+
+}
+
+TEST(CooperativePlanner, crossing_robots_arrive_without_collisions) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 6, 6, r2d2::GridMap::FREE};
+    // a wall with a gap of two lanes every robot has to pass through
+    for (int y = 0; y < 6; y++) {
+        if (y != 2 && y != 3) {
+            grid.set_cell(3, y, r2d2::GridMap::OBSTACLE);
+        }
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::CooperativePlanner planner{sharedMap, {{}, robotBox}, 8, 1};
+
+    std::vector<r2d2::RobotTask> tasks{
+            {make_coordinate(.25, 2.75), make_coordinate(5.25, 2.75)},
+            {make_coordinate(5.25, 3.25), make_coordinate(.25, 3.25)},
+            {make_coordinate(1.25, .25), make_coordinate(4.75, 5.25)},
+            {make_coordinate(4.75, .25), make_coordinate(1.25, 5.25)}};
+    r2d2::FleetPlan plan;
+    ASSERT_TRUE(planner.plan(tasks, plan));
+    for (std::size_t i = 0; i < tasks.size(); i++) {
+        EXPECT_TRUE(plan.arrived[i]);
+        EXPECT_TRUE(is_same(tasks[i].start, plan.paths[i].front()));
+        EXPECT_TRUE(is_same(tasks[i].goal, plan.paths[i].back()));
+    }
+    expect_no_collisions(plan);
+
+    // the fields are reused, so planning again gives the same plan
+    r2d2::FleetPlan again;
+    ASSERT_TRUE(planner.plan(tasks, again));
+    EXPECT_EQ(plan.paths.size(), again.paths.size());
+    EXPECT_EQ(plan.paths[0].size(), again.paths[0].size());
+}
+
+TEST(CooperativePlanner, unreachable_robot_stays_put) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 6, 6, r2d2::GridMap::FREE};
+    grid.set_cell(5, 5, r2d2::GridMap::OBSTACLE);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::CooperativePlanner planner{sharedMap, {{}, robotBox}, 8, 1};
+
+    // the first robot stands on the straight path of the second
+    std::vector<r2d2::RobotTask> tasks{
+            {make_coordinate(2.75, 1.25), make_coordinate(5.5, 5.5)},
+            {make_coordinate(.25, 1.25), make_coordinate(5.25, 1.25)}};
+    r2d2::FleetPlan plan;
+    EXPECT_FALSE(planner.plan(tasks, plan));
+    EXPECT_FALSE(plan.arrived[0]);
+    EXPECT_TRUE(plan.arrived[1]);
+    for (const r2d2::Coordinate &position : plan.paths[0]) {
+        EXPECT_TRUE(is_same(tasks[0].start, position));
+    }
+    expect_no_collisions(plan);
+
+    // two robots cannot start in the same cell
+    tasks[0].start = tasks[1].start;
+    tasks[0].goal = make_coordinate(3.25, 3.25);
+    EXPECT_FALSE(planner.plan(tasks, plan));
+}
+
+TEST(CooperativePlanner, stops_when_robots_block_a_corridor) {
+    // a corridor of a single lane, with two robots at its ends driving at
+    // each other, so neither can make way
+    r2d2::GridMap grid{{}, .5 * r2d2::Length::METER, 8, 4,
+                       r2d2::GridMap::FREE};
+    for (int x = 0; x < 8; x++) {
+        grid.set_cell(x, 0, r2d2::GridMap::OBSTACLE);
+        grid.set_cell(x, 3, r2d2::GridMap::OBSTACLE);
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::CooperativePlanner planner{sharedMap, {{}, robotBox}, 8, 1};
+
+    std::vector<r2d2::RobotTask> tasks{
+            {make_coordinate(.25, .75), make_coordinate(3.25, .75)},
+            {make_coordinate(3.25, .75), make_coordinate(.25, .75)}};
+    r2d2::FleetPlan plan;
+    EXPECT_FALSE(planner.plan(tasks, plan, 200));
+    // both robots were searched first in a round, without a way through
+    EXPECT_GE(plan.restarts, 2);
+    EXPECT_FALSE(plan.arrived[0]);
+    EXPECT_FALSE(plan.arrived[1]);
+    expect_no_collisions(plan);
+}
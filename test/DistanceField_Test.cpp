@@ -0,0 +1,183 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   DistanceField_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the distance field
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+
+TEST(DistanceField, paths_lead_to_goal) {
+    r2d2::Dummy map(50, 50, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate goal{make_coordinate(25.5, 25.5)};
+    std::shared_ptr<const r2d2::DistanceField> field{
+            pf.get_distance_field(goal)};
+    ASSERT_NE(nullptr, field);
+
+    for (r2d2::Coordinate start : {make_coordinate(.5, .5),
+                                   make_coordinate(49.2, 3.7),
+                                   make_coordinate(10.3, 48.9)}) {
+        std::vector<r2d2::Coordinate> path;
+        ASSERT_TRUE(pf.get_path_from_field(*field, start, path)) << start;
+        ASSERT_FALSE(path.empty());
+        EXPECT_EQ(0, (path.back() - goal).get_length() / r2d2::Length::METER);
+    }
+}
+
+TEST(DistanceField, costs_without_obstacles) {
+    r2d2::Dummy map(30, 30, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    std::shared_ptr<const r2d2::DistanceField> field{
+            pf.get_distance_field(make_coordinate(15, 15))};
+    ASSERT_NE(nullptr, field);
+    EXPECT_EQ(0, field->get_cost(0, 0));
+    // without obstacles the cost is the diagonal distance
+    EXPECT_NEAR(10 * .5, field->get_cost(10, 0), 1e-4);
+    EXPECT_NEAR(10 * .5 * std::sqrt(2.0), field->get_cost(-10, 10), 1e-4);
+    EXPECT_NEAR(4 * .5 * std::sqrt(2.0) + 6 * .5, field->get_cost(-4, -10),
+                1e-4);
+}
+
+TEST(DistanceField, thread_count_independent) {
+    r2d2::Dummy map(make_seeded_map(60, 60, .3f, 2));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder single(sharedMap, {{}, robotBox}),
+            multi(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate goal{make_coordinate(30.5, 30.5)};
+    map.set_cell(30, 30, 0);
+    std::shared_ptr<const r2d2::DistanceField> a{
+            single.get_distance_field(goal, 1)},
+            b{multi.get_distance_field(goal, 4)};
+    ASSERT_NE(nullptr, a);
+    ASSERT_NE(nullptr, b);
+    for (int y = a->get_min_y(); y < a->get_min_y() + a->get_height(); y++) {
+        for (int x = a->get_min_x(); x < a->get_min_x() + a->get_width(); x++) {
+            if (std::isinf(a->get_cost(x, y))) {
+                ASSERT_TRUE(std::isinf(b->get_cost(x, y)));
+            } else {
+                ASSERT_NEAR(a->get_cost(x, y), b->get_cost(x, y), 1e-3);
+            }
+        }
+    }
+}
+
+TEST(DistanceField, unreachable_start) {
+    // a wall splits the map in two halves
+    std::vector<std::vector<int>> vector(20, std::vector<int>(20, 0));
+    for (int y = 0; y < 20; y++) {
+        vector[y][10] = 1;
+    }
+    r2d2::Dummy map(vector);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    std::shared_ptr<const r2d2::DistanceField> field{
+            pf.get_distance_field(make_coordinate(15.5, 10.5))};
+    ASSERT_NE(nullptr, field);
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pf.get_path_from_field(*field, make_coordinate(2.5, 10.5),
+                                        path));
+    EXPECT_TRUE(pf.get_path_from_field(*field, make_coordinate(18.5, 1.5),
+                                       path));
+}
+
+TEST(DistanceField, invalidated_on_map_change) {
+    r2d2::Dummy map(20, 20, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate goal{make_coordinate(15.5, 10.5)};
+    std::shared_ptr<const r2d2::DistanceField> field{
+            pf.get_distance_field(goal)};
+    ASSERT_NE(nullptr, field);
+    EXPECT_EQ(field, pf.get_distance_field(goal));
+
+    map.set_cell(5, 5, 1);
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pf.get_path_from_field(*field, make_coordinate(1.5, 1.5),
+                                        path));
+
+    std::shared_ptr<const r2d2::DistanceField> updated{
+            pf.get_distance_field(goal)};
+    ASSERT_NE(nullptr, updated);
+    EXPECT_NE(field, updated);
+    EXPECT_TRUE(pf.get_path_from_field(*updated, make_coordinate(1.5, 1.5),
+                                       path));
+}
+
+TEST(DistanceField, cache_is_bounded) {
+    r2d2::Dummy map(20, 20, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate first{make_coordinate(1.5, 1.5)},
+            recent{make_coordinate(2.5, 1.5)};
+    std::weak_ptr<const r2d2::DistanceField> firstField{
+            pf.get_distance_field(first)};
+    std::shared_ptr<const r2d2::DistanceField> recentField{
+            pf.get_distance_field(recent)};
+    // many more goals, while the second one stays in use
+    for (int i = 0; i < 20; i++) {
+        ASSERT_NE(nullptr, pf.get_distance_field(
+                make_coordinate(1.5 + i % 10, 5.5 + i / 10)));
+        EXPECT_EQ(recentField, pf.get_distance_field(recent));
+    }
+    EXPECT_TRUE(firstField.expired());
+
+    // a field of an older map version is dropped at the next query
+    std::weak_ptr<const r2d2::DistanceField> stale{recentField};
+    recentField.reset();
+    map.set_cell(10, 10, 1);
+    ASSERT_NE(nullptr, pf.get_distance_field(first));
+    EXPECT_TRUE(stale.expired());
+}
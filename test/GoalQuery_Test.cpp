@@ -0,0 +1,153 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   GoalQuery_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Goal predicate query tests
+//!
+//! Tests for the queries that search for the closest position satisfying a
+//! predicate, such as the closest frontier.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * a free map surrounded by a wall of two cells, so the unknown space
+     * outside of the map is not a frontier
+     */
+    std::vector<std::vector<int>> make_walled_map(int size) {
+        std::vector<std::vector<int>> map(std::size_t(size),
+                                          std::vector<int>(std::size_t(size), 0));
+        for (int i = 0; i < size; i++) {
+            for (int wall : {0, 1, size - 2, size - 1}) {
+                map[wall][i] = 1;
+                map[i][wall] = 1;
+            }
+        }
+        return map;
+    }
+
+    double get_length(r2d2::Coordinate start,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &coord : path) {
+            length += (coord - start).get_length() / r2d2::Length::METER;
+            start = coord;
+        }
+        return length;
+    }
+
+}
+
+TEST(GoalQuery, nearest_frontier) {
+    std::vector<std::vector<int>> grid{make_walled_map(40)};
+    // a large unknown area far away, and a single unknown cell nearby
+    // behind a wall, so the closest frontier is reached around it
+    for (int y = 2; y < 38; y++) {
+        for (int x = 30; x < 38; x++) {
+            grid[y][x] = 2;
+        }
+    }
+    grid[14][5] = 2;
+    for (int x = 2; x < 10; x++) {
+        grid[12][x] = 1;
+    }
+    r2d2::Dummy map(grid);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate start{make_coordinate(5.25, 5.25)};
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_frontier(start, path));
+    ASSERT_FALSE(path.empty());
+    r2d2::Coordinate frontier{path.back()};
+    EXPECT_TRUE(pf.get_frontier_predicate()(map, frontier)) << frontier;
+    EXPECT_GT(frontier.get_y(), 12 * r2d2::Length::METER) << frontier;
+    EXPECT_LT(frontier.get_x(), 20 * r2d2::Length::METER) << frontier;
+
+    // the found frontier is not further away than a search to it
+    std::vector<r2d2::Coordinate> direct;
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, frontier, direct));
+    EXPECT_NEAR(get_length(start, direct), get_length(start, path), 1.5);
+}
+
+TEST(GoalQuery, custom_predicate) {
+    std::vector<std::vector<int>> grid{make_walled_map(30)};
+    for (int y = 2; y < 25; y++) {
+        grid[y][15] = 1;
+    }
+    r2d2::Dummy map(grid);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate start{make_coordinate(5.25, 5.25)};
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_goal(
+            start, [](r2d2::ReadOnlyMap &, const r2d2::Coordinate &position) {
+                return position.get_x() > 20 * r2d2::Length::METER;
+            }, path));
+    ASSERT_FALSE(path.empty());
+    EXPECT_GT(path.back().get_x(), 20 * r2d2::Length::METER);
+    // around the wall
+    EXPECT_GT(get_length(start, path), 25);
+
+    // the start itself satisfies the predicate
+    ASSERT_TRUE(pf.get_path_to_goal(
+            start, [](r2d2::ReadOnlyMap &, const r2d2::Coordinate &) {
+                return true;
+            }, path));
+    EXPECT_TRUE(path.empty());
+}
+
+TEST(GoalQuery, no_frontier) {
+    r2d2::Dummy map(make_walled_map(20));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pf.get_path_to_frontier(make_coordinate(5.25, 5.25), path));
+    // the robot cannot be on the start
+    EXPECT_FALSE(pf.get_path_to_frontier(make_coordinate(.5, .5), path));
+}
@@ -0,0 +1,219 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   MapWorkload_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the map workloads and the conformance of the map
+//! backends
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <random>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/MapWorkload.hpp"
+#include "../source/include/QuadTreeMap.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * cells of 64x48 meters with blocks of obstacles and unknown space
+     */
+    std::vector<std::vector<int>> make_cells() {
+        std::mt19937 random{3};
+        std::vector<std::vector<int>> cells(48, std::vector<int>(64, 0));
+        for (int i = 0; i < 60; i++) {
+            int x = int(random() % 64), y = int(random() % 48),
+                    size = int(random() % 5) + 1, value = int(random() % 2) + 1;
+            for (int dy = 0; dy < size && y + dy < 48; dy++) {
+                for (int dx = 0; dx < size && x + dx < 64; dx++) {
+                    cells[y + dy][x + dx] = value;
+                }
+            }
+        }
+        return cells;
+    }
+
+    r2d2::GridMap make_grid(const std::vector<std::vector<int>> &cells) {
+        r2d2::GridMap grid{{}, r2d2::Length::METER, 64, 48};
+        for (int y = 0; y < 48; y++) {
+            for (int x = 0; x < 64; x++) {
+                grid.set_cell(x, y, uint8_t(cells[y][x]));
+            }
+        }
+        return grid;
+    }
+
+    /**
+     * a grid that loses the obstacles of its rightmost column
+     */
+    class BrokenMap : public r2d2::ReadOnlyMap {
+    public:
+        BrokenMap(r2d2::GridMap &grid) : grid(grid) {
+        }
+
+        virtual const r2d2::BoxInfo get_box_info(const r2d2::Box box) override {
+            r2d2::BoxInfo info{grid.get_box_info(box)};
+            if (box.get_top_right().get_x() >= 63 * r2d2::Length::METER) {
+                return {false, info.get_has_navigable(), info.get_has_unknown()};
+            }
+            return info;
+        }
+
+        virtual const r2d2::Box get_map_bounding_box() override {
+            return grid.get_map_bounding_box();
+        }
+
+    private:
+        r2d2::GridMap &grid;
+    };
+
+    bool is_inside(const r2d2::Box &box) {
+        return box.get_bottom_left().get_x() >= 0 * r2d2::Length::METER &&
+               box.get_bottom_left().get_y() >= 0 * r2d2::Length::METER &&
+               box.get_top_right().get_x() <= 64 * r2d2::Length::METER &&
+               box.get_top_right().get_y() <= 48 * r2d2::Length::METER;
+    }
+
+}
+
+TEST(MapWorkload, generated_queries) {
+    r2d2::Dummy dummy{make_cells()};
+    r2d2::Box bounds{dummy.get_map_bounding_box()};
+    for (r2d2::BoxQueryKind kind : {r2d2::BoxQueryKind::SUCCESSOR,
+                                    r2d2::BoxQueryKind::SEGMENT,
+                                    r2d2::BoxQueryKind::OUT_OF_BOUNDS}) {
+        std::vector<r2d2::BoxQuery> queries{r2d2::generate_box_queries(
+                bounds, robotBox, r2d2::Length::METER, kind, 500, 1)};
+        ASSERT_EQ(500u, queries.size());
+        int long_boxes = 0, outside = 0;
+        for (const r2d2::BoxQuery &query : queries) {
+            EXPECT_EQ(kind, query.kind);
+            EXPECT_GE(query.cells, 1u);
+            r2d2::Translation size{query.box.get_axis_size()};
+            if (std::max(size.get_x(), size.get_y()) > 1.1 * r2d2::Length::METER) {
+                long_boxes++;
+            }
+            outside += is_inside(query.box) ? 0 : 1;
+        }
+        if (kind == r2d2::BoxQueryKind::SUCCESSOR) {
+            // a step of the robot size plus the robot
+            EXPECT_EQ(0, long_boxes);
+        } else if (kind == r2d2::BoxQueryKind::SEGMENT) {
+            EXPECT_EQ(500, long_boxes);
+        } else {
+            EXPECT_EQ(500, outside);
+        }
+    }
+
+    // the same seed gives the same workload
+    std::vector<r2d2::BoxQuery> first{r2d2::generate_box_queries(
+            bounds, robotBox, r2d2::Length::METER,
+            r2d2::BoxQueryKind::SEGMENT, 10, 9)},
+            second{r2d2::generate_box_queries(
+            bounds, robotBox, r2d2::Length::METER,
+            r2d2::BoxQueryKind::SEGMENT, 10, 9)};
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(0, (first[i].box.get_bottom_left() -
+                      second[i].box.get_bottom_left()).get_length() /
+                     r2d2::Length::METER);
+    }
+}
+
+TEST(MapWorkload, backends_conform_to_dummy) {
+    std::vector<std::vector<int>> cells{make_cells()};
+    r2d2::Dummy dummy{cells};
+    r2d2::GridMap grid{make_grid(cells)};
+    r2d2::QuadTreeMap tree{grid};
+    r2d2::Box bounds{dummy.get_map_bounding_box()};
+
+    for (r2d2::BoxQueryKind kind : {r2d2::BoxQueryKind::SUCCESSOR,
+                                    r2d2::BoxQueryKind::SEGMENT,
+                                    r2d2::BoxQueryKind::OUT_OF_BOUNDS}) {
+        std::vector<r2d2::BoxQuery> queries{r2d2::generate_box_queries(
+                bounds, robotBox, r2d2::Length::METER, kind, 2000, 5)},
+                inside;
+        for (const r2d2::BoxQuery &query : queries) {
+            if (is_inside(query.box)) {
+                inside.push_back(query);
+            }
+        }
+        for (r2d2::ReadOnlyMap *map : {static_cast<r2d2::ReadOnlyMap *>(&grid),
+                                       static_cast<r2d2::ReadOnlyMap *>(&tree)}) {
+            // Dummy truncates coordinates towards zero, so boxes less than a
+            // cell left of or below the map get the content of the first
+            // cells instead of only unknown space. the answers outside of
+            // the map differ, but block the robot all the same
+            r2d2::MapConformance all{
+                    r2d2::check_map_conformance(dummy, *map, queries)};
+            EXPECT_EQ(0, all.unsafe) << all.firstMismatch;
+            r2d2::MapConformance exact{
+                    r2d2::check_map_conformance(dummy, *map, inside)};
+            EXPECT_EQ(0, exact.mismatches) << exact.firstMismatch;
+        }
+    }
+}
+
+TEST(MapWorkload, detects_unsafe_backends) {
+    std::vector<std::vector<int>> cells{make_cells()};
+    for (int y = 0; y < 48; y++) {
+        cells[y][63] = 1;
+    }
+    r2d2::Dummy dummy{cells};
+    r2d2::GridMap grid{make_grid(cells)};
+    BrokenMap broken{grid};
+    std::vector<r2d2::BoxQuery> queries{r2d2::generate_box_queries(
+            dummy.get_map_bounding_box(), robotBox, r2d2::Length::METER,
+            r2d2::BoxQueryKind::SEGMENT, 1000, 2)};
+
+    r2d2::MapConformance conformance{
+            r2d2::check_map_conformance(dummy, broken, queries)};
+    EXPECT_GT(conformance.unsafe, 0);
+    ASSERT_GE(conformance.firstMismatch, 0);
+    EXPECT_GE(queries[conformance.firstMismatch].box.get_top_right().get_x(),
+              63 * r2d2::Length::METER);
+
+    r2d2::MapThroughput throughput{
+            r2d2::measure_map_throughput(grid, queries, 2)};
+    EXPECT_GT(throughput.queriesPerSecond, 0);
+    EXPECT_GT(throughput.nsPerCell, 0);
+}
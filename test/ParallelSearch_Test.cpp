@@ -0,0 +1,156 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ParallelSearch_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the hash distributed search
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    double get_length(r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length() / r2d2::Length::METER;
+            from = to;
+        }
+        return length;
+    }
+
+}
+
+TEST(ParallelSearch, optimal_cost) {
+    r2d2::Dummy map(make_seeded_map(60, 60, .3f, 2));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate goal{make_coordinate(30.5, 30.5)};
+    map.set_cell(30, 30, 0);
+    std::shared_ptr<const r2d2::DistanceField> field{pf.get_distance_field(goal)};
+    ASSERT_NE(nullptr, field);
+
+    // starts on the lattice, so the distance field holds the optimal cost
+    for (int x : {-50, -12, 7, 55}) {
+        for (int y : {-48, 3, 40}) {
+            r2d2::Coordinate start{field->get_coordinate(x, y)};
+            for (int threads : {1, 2, 4}) {
+                std::vector<r2d2::Coordinate> path;
+                r2d2::Length cost;
+                bool found = pf.get_path_to_coordinate_parallel(
+                        start, goal, path, threads, &cost);
+                if (std::isinf(field->get_cost(x, y))) {
+                    EXPECT_FALSE(found) << start;
+                } else {
+                    ASSERT_TRUE(found) << start;
+                    EXPECT_NEAR(field->get_cost(x, y),
+                                cost / r2d2::Length::METER, 1e-3) << start;
+                    ASSERT_FALSE(path.empty());
+                    EXPECT_EQ(0, (path.back() - goal).get_length() /
+                                 r2d2::Length::METER);
+                }
+            }
+        }
+    }
+}
+
+TEST(ParallelSearch, not_worse_than_sequential) {
+    r2d2::Coordinate start{make_coordinate(2.3, 3.9)},
+            goal{make_coordinate(47.5, 45.5)};
+    int compared = 0;
+    for (unsigned seed = 0; seed < 10; seed++) {
+        r2d2::Dummy map(make_seeded_map(50, 50, .2f, seed));
+        map.set_cell(2, 3, 0);
+        map.set_cell(47, 45, 0);
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+        r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+        std::vector<r2d2::Coordinate> sequential, parallel;
+        bool found = pf.get_path_to_coordinate(start, goal, sequential);
+        r2d2::Length cost;
+        ASSERT_EQ(found, pf.get_path_to_coordinate_parallel(
+                start, goal, parallel, 4, &cost)) << seed;
+        if (!found) {
+            continue;
+        }
+        compared++;
+        ASSERT_FALSE(parallel.empty());
+        EXPECT_EQ(0, (parallel.back() - goal).get_length() /
+                     r2d2::Length::METER);
+        // smoothing only shortens the path of the lattice
+        double parallelLength = get_length(start, parallel);
+        EXPECT_LE(parallelLength, cost / r2d2::Length::METER + 1e-6) << seed;
+        EXPECT_GE(cost / r2d2::Length::METER,
+                  (goal - start).get_length() / r2d2::Length::METER) << seed;
+        // the sequential search stops at the first path it generates, the
+        // parallel one at the cheapest path on the lattice. the smoothed
+        // paths can still differ a little either way
+        EXPECT_LE(parallelLength, get_length(start, sequential) * 1.01)
+                            << seed;
+    }
+    EXPECT_LE(5, compared);
+}
+
+TEST(ParallelSearch, no_path) {
+    // a wall splits the map in two halves
+    std::vector<std::vector<int>> vector(20, std::vector<int>(20, 0));
+    for (int y = 0; y < 20; y++) {
+        vector[y][10] = 1;
+    }
+    r2d2::Dummy map(vector);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pf.get_path_to_coordinate_parallel(
+            make_coordinate(2.5, 10.5), make_coordinate(15.5, 10.5), path, 4));
+    EXPECT_TRUE(pf.get_path_to_coordinate_parallel(
+            make_coordinate(12.5, 1.5), make_coordinate(15.5, 10.5), path, 4));
+    EXPECT_TRUE(pf.get_path_to_coordinate_parallel(
+            make_coordinate(15.5, 10.5), make_coordinate(15.6, 10.4), path, 4));
+    EXPECT_TRUE(path.empty());
+}
@@ -52,6 +52,7 @@
 #include <fstream>
 #include "../source/include/Dummy.hpp"
 #include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
 #include "../../sharedobjects/source/include/LockingSharedObject.hpp"
 
 bool equal(const std::vector<r2d2::Coordinate> &lhs,
@@ -98,8 +99,17 @@ std::tuple<bool, r2d2::Dummy> test_until_true(int mapX, int mapY,
                                             r2d2::Coordinate start,
                                             r2d2::Coordinate goal,
                                             std::vector<r2d2::Coordinate> &path) {
+    // the seeds are tried in order, so a failure can be reproduced
     for (int i = 0; i < MAX_TRIES; i++) {
-        r2d2::Dummy map(mapX, mapY);
+        r2d2::ScenarioGenerator generator{r2d2::ScenarioKind::RANDOM, mapX,
+                                          mapY, uint64_t(i), .25};
+        std::vector<std::vector<int>> cells(mapY, std::vector<int>(mapX));
+        for (int y = 0; y < mapY; y++) {
+            for (int x = 0; x < mapX; x++) {
+                cells[y][x] = generator.get_cell(x, y);
+            }
+        }
+        r2d2::Dummy map(cells);
         LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
         r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
 
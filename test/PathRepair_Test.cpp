@@ -0,0 +1,204 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PathRepair_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Path repair tests
+//!
+//! Tests for the validation of existing paths and their repair after the map
+//! changed.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/BatchedMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    bool same(const r2d2::Coordinate &a, const r2d2::Coordinate &b) {
+        return (a - b).get_length() / r2d2::Length::METER == 0;
+    }
+
+    bool same(const std::vector<r2d2::Coordinate> &a,
+              const std::vector<r2d2::Coordinate> &b) {
+        return a.size() == b.size() &&
+               std::equal(a.begin(), a.end(), b.begin(),
+                          [](const r2d2::Coordinate &lhs,
+                             const r2d2::Coordinate &rhs) {
+                              return same(lhs, rhs);
+                          });
+    }
+
+    /**
+     * map that counts the single and batched queries made on a Dummy
+     */
+    class CountingMap : public r2d2::ReadOnlyMap, public r2d2::BatchedMap {
+    public:
+        CountingMap(r2d2::Dummy &map) : map(map), singles{0}, batches{0} {
+        }
+
+        virtual const r2d2::BoxInfo get_box_info(const r2d2::Box box) override {
+            singles++;
+            return map.get_box_info(box);
+        }
+
+        virtual void get_box_infos(const std::vector<r2d2::Box> &boxes,
+                                   std::vector<r2d2::BoxInfo> &infos) override {
+            batches++;
+            map.get_box_infos(boxes, infos);
+        }
+
+        virtual const r2d2::Box get_map_bounding_box() override {
+            return map.get_map_bounding_box();
+        }
+
+        r2d2::Dummy &map;
+        int singles, batches;
+    };
+
+    /**
+     * a straight path through the middle of the map with a waypoint every
+     * two meters
+     */
+    std::vector<r2d2::Coordinate> make_straight_path() {
+        std::vector<r2d2::Coordinate> path;
+        for (double x = 4.5; x < 37; x += 2) {
+            path.push_back(make_coordinate(x, 20.5));
+        }
+        return path;
+    }
+
+}
+
+TEST(PathRepair, valid_path) {
+    r2d2::Dummy map(40, 40, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    std::vector<r2d2::Coordinate> path{make_straight_path()},
+            original{path};
+    r2d2::PathRepair result{pf.repair_path(make_coordinate(2.5, 20.5), path)};
+    EXPECT_EQ(r2d2::PathRepair::Status::VALID, result.status);
+    EXPECT_EQ(-1, result.blockedSegment);
+    EXPECT_TRUE(same(original, path));
+    EXPECT_EQ(0, result.repairTime.count());
+}
+
+TEST(PathRepair, validates_in_batches) {
+    r2d2::Dummy map(40, 40, 0);
+    CountingMap counting{map};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{counting};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+
+    // the 17 segments are checked in batches of 4, 8 and the last 5
+    std::vector<r2d2::Coordinate> path{make_straight_path()};
+    ASSERT_EQ(17u, path.size());
+    EXPECT_EQ(r2d2::PathRepair::Status::VALID,
+              pf.repair_path(make_coordinate(2.5, 20.5), path).status);
+    EXPECT_EQ(0, counting.singles);
+    EXPECT_EQ(3, counting.batches);
+
+    // the batches stop at the first blocked segment
+    map.set_cell(19, 20, 1);
+    r2d2::PathRepair result{pf.repair_path(make_coordinate(2.5, 20.5), path)};
+    EXPECT_EQ(8, result.blockedSegment);
+    EXPECT_EQ(r2d2::PathRepair::Status::REPAIRED, result.status);
+}
+
+TEST(PathRepair, local_repair) {
+    r2d2::Dummy map(40, 40, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    r2d2::Coordinate start{make_coordinate(2.5, 20.5)};
+
+    // an obstacle across the segment from 18.5 to 20.5
+    for (int y = 19; y <= 21; y++) {
+        map.set_cell(19, y, 1);
+    }
+    std::vector<r2d2::Coordinate> path{make_straight_path()},
+            original{path};
+    r2d2::PathRepair result{pf.repair_path(start, path)};
+    ASSERT_EQ(r2d2::PathRepair::Status::REPAIRED, result.status);
+    EXPECT_EQ(8, result.blockedSegment);
+    EXPECT_GT(result.repairTime.count(), 0);
+    EXPECT_EQ(0, result.replanTime.count());
+
+    // the path outside of the window is kept
+    ASSERT_GT(path.size(), 12u);
+    for (int i = 0; i <= 5; i++) {
+        EXPECT_TRUE(same(original[i], path[i])) << i;
+    }
+    for (int i = 1; i <= 6; i++) {
+        EXPECT_TRUE(same(original[original.size() - i],
+                         path[path.size() - i])) << i;
+    }
+    EXPECT_EQ(r2d2::PathRepair::Status::VALID,
+              pf.repair_path(start, path).status);
+}
+
+TEST(PathRepair, replan) {
+    r2d2::Dummy map(40, 40, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    r2d2::Coordinate start{make_coordinate(2.5, 20.5)};
+
+    // a wall with the only gap far away from the path
+    for (int y = 0; y < 37; y++) {
+        map.set_cell(19, y, 1);
+    }
+    std::vector<r2d2::Coordinate> path{make_straight_path()};
+    r2d2::PathRepair result{pf.repair_path(start, path, 2, 200)};
+    ASSERT_EQ(r2d2::PathRepair::Status::REPLANNED, result.status);
+    EXPECT_GT(result.replanTime.count(), 0);
+    EXPECT_TRUE(same(make_straight_path().back(), path.back()));
+    EXPECT_EQ(r2d2::PathRepair::Status::VALID,
+              pf.repair_path(start, path).status);
+
+    // closing the gap leaves no path at all
+    for (int y = 37; y < 40; y++) {
+        map.set_cell(19, y, 1);
+    }
+    path = make_straight_path();
+    EXPECT_EQ(r2d2::PathRepair::Status::NOT_FOUND,
+              pf.repair_path(start, path).status);
+}
@@ -0,0 +1,221 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningServer_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Tests for the planning daemon
+//!
+//! Runs a PlanningServer in the test process and checks its replies, its
+//! pipelining and its handling of invalid frames.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/PlanningClient.hpp"
+#include "../source/include/PlanningServer.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    std::string get_socket_path(const char *name) {
+        return "/tmp/r2d2_planning_" + std::to_string(getpid()) + "_" + name;
+    }
+
+    /**
+     * a server on a rooms scenario, running on its own thread
+     */
+    class RunningServer {
+    public:
+        RunningServer(const char *name, int maxInFlight) :
+                scenario{r2d2::ScenarioGenerator{r2d2::ScenarioKind::ROOMS, 64,
+                                                 64, 5}.make_scenario(12)},
+                sharedMap{scenario.map},
+                pathFinder{sharedMap, {{}, robotBox}},
+                server{pathFinder, get_socket_path(name), 2, maxInFlight},
+                thread{&r2d2::PlanningServer::run, &server} {
+        }
+
+        ~RunningServer() {
+            server.stop();
+            thread.join();
+        }
+
+        std::vector<r2d2::PlanningQuery> get_queries() const {
+            std::vector<r2d2::PlanningQuery> queries;
+            for (const r2d2::ScenarioQuery &query : scenario.queries) {
+                queries.push_back(r2d2::PlanningQuery{query.start, query.goal});
+            }
+            return queries;
+        }
+
+        r2d2::Scenario scenario;
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap;
+        r2d2::AStarPathFinder pathFinder;
+        r2d2::PlanningServer server;
+        std::thread thread;
+    };
+
+}
+
+TEST(PlanningServer, answers_like_the_pathfinder) {
+    RunningServer running{"answers", 256};
+    std::vector<r2d2::PlanningQuery> queries{running.get_queries()};
+    ASSERT_EQ(12, queries.size());
+    // a query without a path, from inside a wall
+    queries.push_back(r2d2::PlanningQuery{
+            queries[0].start,
+            {.5 * r2d2::Length::METER, .5 * r2d2::Length::METER,
+             0 * r2d2::Length::METER}});
+
+    r2d2::PlanningClient client{running.server.get_socket_path()};
+    std::vector<r2d2::PathResult> results{client.plan(queries)};
+    ASSERT_EQ(queries.size(), results.size());
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        std::vector<r2d2::Coordinate> expected;
+        bool found = running.pathFinder.get_path_to_coordinate(
+                queries[i].start, queries[i].goal, expected);
+        EXPECT_EQ(found, results[i].status == r2d2::PathResult::Status::FOUND);
+        ASSERT_EQ(expected.size(), results[i].path.size());
+        for (std::size_t j = 0; j < expected.size(); j++) {
+            EXPECT_EQ(0, (expected[j] - results[i].path[j]).get_length() /
+                         r2d2::Length::METER);
+        }
+    }
+    EXPECT_FALSE(results.back().status == r2d2::PathResult::Status::FOUND);
+    EXPECT_TRUE(client.plan({}).empty());
+}
+
+TEST(PlanningServer, pipelines_under_backpressure) {
+    // fewer queries in flight than in a single batch
+    RunningServer running{"pipelines", 5};
+    std::vector<r2d2::PlanningQuery> queries{running.get_queries()};
+    const int batchCount = 40;
+    r2d2::PlanningClient client{running.server.get_socket_path()};
+
+    std::vector<int> replies(batchCount, 0);
+    std::thread receiver{[&]() {
+        std::vector<r2d2::PathResult> results;
+        for (int i = 0; i < batchCount; i++) {
+            uint32_t batchId = client.receive(results);
+            ASSERT_LT(batchId, uint32_t(batchCount));
+            replies[batchId]++;
+            EXPECT_EQ(batchId % 2 == 0 ? queries.size() : 3, results.size());
+            for (const r2d2::PathResult &result : results) {
+                EXPECT_TRUE(result.status == r2d2::PathResult::Status::FOUND);
+            }
+        }
+    }};
+    std::vector<r2d2::PlanningQuery> small{queries.begin(),
+                                           queries.begin() + 3};
+    for (int i = 0; i < batchCount; i++) {
+        EXPECT_EQ(uint32_t(i), client.send(i % 2 == 0 ? queries : small));
+    }
+    receiver.join();
+    for (int count : replies) {
+        EXPECT_EQ(1, count);
+    }
+    EXPECT_EQ(uint64_t(batchCount / 2 * (queries.size() + 3)),
+              running.server.get_query_count());
+}
+
+TEST(PlanningServer, closes_invalid_connections) {
+    RunningServer running{"invalid", 256};
+    {
+        r2d2::PlanningClient client{running.server.get_socket_path()};
+        // a reply is not a valid request
+        std::vector<uint8_t> frame;
+        r2d2::encode_planning_reply(0, {}, frame);
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::string path{running.server.get_socket_path()};
+        std::copy(path.begin(), path.end(), address.sun_path);
+        int raw = socket(AF_UNIX, SOCK_STREAM, 0);
+        ASSERT_EQ(0, connect(raw, reinterpret_cast<sockaddr *>(&address),
+                             sizeof(address)));
+        ASSERT_TRUE(r2d2::write_planning_frame(raw, frame));
+        EXPECT_FALSE(r2d2::read_planning_frame(raw, frame));
+        close(raw);
+
+        // other connections are not affected
+        EXPECT_EQ(12, client.plan(running.get_queries()).size());
+    }
+    r2d2::PlanningClient client{running.server.get_socket_path()};
+    EXPECT_EQ(12, client.plan(running.get_queries()).size());
+}
+
+TEST(PlanningServer, stalled_client_does_not_block_others) {
+    std::unique_ptr<RunningServer> running{new RunningServer{"stalled", 64}};
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::string path{running->server.get_socket_path()};
+    std::copy(path.begin(), path.end(), address.sun_path);
+    int stalled = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(0, connect(stalled, reinterpret_cast<sockaddr *>(&address),
+                         sizeof(address)));
+
+    // a client that sends batches but never reads the replies, until the
+    // socket buffers of both directions are full
+    std::vector<r2d2::PlanningQuery> queries{running->get_queries()};
+    std::vector<uint8_t> frame;
+    int sent = 0;
+    for (uint32_t id = 0; id < 2000; id++) {
+        r2d2::encode_planning_request(id, queries, frame);
+        if (send(stalled, frame.data(), frame.size(), MSG_DONTWAIT) !=
+            ssize_t(frame.size())) {
+            break;
+        }
+        sent++;
+    }
+    ASSERT_GT(sent, 0);
+
+    // the workers still answer other clients
+    r2d2::PlanningClient client{running->server.get_socket_path()};
+    EXPECT_EQ(12, client.plan(queries).size());
+
+    // and the server stops while the stalled client still has replies
+    running.reset();
+    close(stalled);
+}
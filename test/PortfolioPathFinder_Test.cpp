@@ -0,0 +1,211 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PortfolioPathFinder_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Portfolio pathfinder tests
+//!
+//! Tests the race of planner configurations of the portfolio pathfinder.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "../source/include/PortfolioPathFinder.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+
+namespace {
+
+    const r2d2::Translation robotBox{.5 * r2d2::Length::METER,
+                                     .5 * r2d2::Length::METER,
+                                     0 * r2d2::Length::METER};
+
+    /**
+     * planner that answers after a delay, or gives up when cancelled
+     */
+    r2d2::PortfolioPlanner make_delayed(std::chrono::milliseconds delay,
+                                        std::vector<r2d2::Coordinate> answer) {
+        return [delay, answer](r2d2::Coordinate, r2d2::Coordinate,
+                               std::vector<r2d2::Coordinate> &path,
+                               const r2d2::CancellationToken &token) {
+            std::chrono::steady_clock::time_point until{
+                    std::chrono::steady_clock::now() + delay};
+            while (std::chrono::steady_clock::now() < until) {
+                if (token.is_cancelled()) {
+                    return false;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            path = answer;
+            return !answer.empty();
+        };
+    }
+
+    r2d2::PortfolioStatistics get_statistics(
+            const r2d2::PortfolioPathFinder &portfolio,
+            const std::string &name) {
+        for (const r2d2::PortfolioStatistics &statistics :
+                portfolio.get_statistics()) {
+            if (statistics.name == name) {
+                return statistics;
+            }
+        }
+        return r2d2::PortfolioStatistics{};
+    }
+
+}
+
+TEST(PortfolioPathFinder, first_path_wins_and_cancels_the_rest) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 10, 10, r2d2::GridMap::FREE};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::PortfolioPathFinder portfolio{sharedMap, {{}, robotBox}, 3};
+    r2d2::Coordinate goal{5 * r2d2::Length::METER, 5 * r2d2::Length::METER,
+                          0 * r2d2::Length::METER};
+    portfolio.add_configuration(
+            "fails", make_delayed(std::chrono::milliseconds(0), {}));
+    portfolio.add_configuration(
+            "fast", make_delayed(std::chrono::milliseconds(10), {goal}));
+    portfolio.add_configuration(
+            "slow", make_delayed(std::chrono::seconds(10), {goal}));
+
+    std::vector<r2d2::Coordinate> path;
+    std::string winner;
+    std::chrono::steady_clock::time_point begin{
+            std::chrono::steady_clock::now()};
+    ASSERT_TRUE(portfolio.get_path_to_coordinate(
+            {}, goal, path, r2d2::CancellationToken::never(), &winner));
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::seconds(5));
+    EXPECT_EQ("fast", winner);
+    ASSERT_EQ(1u, path.size());
+    EXPECT_EQ(0, (path[0] - goal).get_length() / r2d2::Length::METER);
+
+    EXPECT_EQ(1, get_statistics(portfolio, "fast").wins);
+    EXPECT_EQ(1, get_statistics(portfolio, "fast").found);
+    EXPECT_EQ(1, get_statistics(portfolio, "fails").notFound);
+    // the slow run notices the cancellation on its own thread
+    for (int i = 0; i < 1000 &&
+                    get_statistics(portfolio, "slow").cancelled == 0; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(1, get_statistics(portfolio, "slow").cancelled);
+
+    // a cancelled query waits for none of its runs
+    r2d2::CancellationToken token;
+    token.cancel();
+    portfolio.remove_configuration("fast");
+    EXPECT_FALSE(portfolio.get_path_to_coordinate({}, goal, path, token));
+}
+
+TEST(PortfolioPathFinder, deadline_prefers_shorter_paths) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 10, 10, r2d2::GridMap::FREE};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::PortfolioPathFinder portfolio{sharedMap, {{}, robotBox}, 2};
+    r2d2::Coordinate goal{5 * r2d2::Length::METER, 0 * r2d2::Length::METER,
+                          0 * r2d2::Length::METER},
+            detour{0 * r2d2::Length::METER, 5 * r2d2::Length::METER,
+                   0 * r2d2::Length::METER};
+    portfolio.add_configuration(
+            "detour", make_delayed(std::chrono::milliseconds(0),
+                                   {detour, goal}));
+    portfolio.add_configuration(
+            "direct", make_delayed(std::chrono::milliseconds(20), {goal}));
+    portfolio.set_deadline(std::chrono::seconds(5));
+
+    std::vector<r2d2::Coordinate> path;
+    std::string winner;
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(portfolio.get_path_to_coordinate(
+                {}, goal, path, r2d2::CancellationToken::never(), &winner));
+        EXPECT_EQ("direct", winner);
+        EXPECT_EQ(1u, path.size());
+    }
+
+    // past the deadline the first path found is used
+    portfolio.set_deadline(std::chrono::milliseconds(1));
+    ASSERT_TRUE(portfolio.get_path_to_coordinate(
+            {}, goal, path, r2d2::CancellationToken::never(), &winner));
+    EXPECT_EQ("detour", winner);
+
+    portfolio.prune(1);
+    std::vector<r2d2::PortfolioStatistics> statistics{
+            portfolio.get_statistics()};
+    ASSERT_EQ(1u, statistics.size());
+    EXPECT_EQ("direct", statistics[0].name);
+    EXPECT_EQ(2, statistics[0].wins);
+    EXPECT_FALSE(portfolio.remove_configuration("detour"));
+}
+
+TEST(PortfolioPathFinder, races_search_settings) {
+    r2d2::ScenarioGenerator generator{r2d2::ScenarioKind::ROOMS, 48, 48, 5, 0};
+    r2d2::Scenario scenario{generator.make_scenario(8, 1)};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{scenario.map};
+    r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+    r2d2::PortfolioPathFinder portfolio{sharedMap, {{}, robotBox}, 3};
+    portfolio.add_configuration("exact", r2d2::PortfolioPathFinder::make_planner(
+            pathFinder, r2d2::SearchSettings{}));
+    portfolio.add_configuration("weighted", r2d2::PortfolioPathFinder::make_planner(
+            pathFinder, r2d2::SearchSettings{r2d2::CollisionChecking::EAGER, 1, 2}));
+    portfolio.add_configuration("coarse", r2d2::PortfolioPathFinder::make_planner(
+            pathFinder, r2d2::SearchSettings{r2d2::CollisionChecking::EAGER, 2}));
+    portfolio.set_deadline(std::chrono::seconds(30));
+
+    int wins = 0;
+    for (const r2d2::ScenarioQuery &query : scenario.queries) {
+        std::vector<r2d2::Coordinate> path;
+        ASSERT_TRUE(portfolio.get_path_to_coordinate(query.start, query.goal,
+                                                     path));
+        // every run finishes before the deadline, so the exact search is
+        // among the paths, and it is no longer than the reference
+        double length = 0;
+        r2d2::Coordinate from{query.start};
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length() / r2d2::Length::METER;
+            from = to;
+        }
+        EXPECT_LE(length, query.referenceCost / r2d2::Length::METER + 1e-6);
+        wins++;
+    }
+    int counted = 0;
+    for (const r2d2::PortfolioStatistics &statistics :
+            portfolio.get_statistics()) {
+        counted += statistics.wins;
+        EXPECT_EQ(0, statistics.cancelled) << statistics.name;
+    }
+    EXPECT_EQ(wins, counted);
+}
@@ -0,0 +1,224 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PrecomputationBundle_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the precomputation bundles
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/QuadTreeMap.hpp"
+#include "../source/include/VisibilityGraphPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    const r2d2::Box robot{{}, robotBox};
+
+    const char *const BUNDLE_FILE = "PrecomputationBundle_Test.bundle";
+
+    /**
+     * a free map of 40x40 cells with a wall at x = 20 that has a door at the
+     * top, and a closed room in the bottom right corner
+     */
+    r2d2::GridMap make_map() {
+        r2d2::GridMap grid{{}, r2d2::Length::METER, 40, 40,
+                           r2d2::GridMap::FREE};
+        for (int i = 0; i < 36; i++) {
+            grid.set_cell(20, i, r2d2::GridMap::OBSTACLE);
+        }
+        for (int i = 30; i < 40; i++) {
+            grid.set_cell(i, 10, r2d2::GridMap::OBSTACLE);
+            grid.set_cell(30, i - 30, r2d2::GridMap::OBSTACLE);
+        }
+        return grid;
+    }
+
+    std::vector<char> read_file(const char *path) {
+        std::ifstream in{path, std::ios::binary};
+        return {std::istreambuf_iterator<char>{in},
+                std::istreambuf_iterator<char>{}};
+    }
+
+    void write_file(const char *path, const std::vector<char> &data) {
+        std::ofstream out{path, std::ios::binary | std::ios::trunc};
+        out.write(data.data(), std::streamsize(data.size()));
+    }
+
+}
+
+TEST(PrecomputationBundle, round_trip) {
+    r2d2::GridMap grid{make_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    {
+        r2d2::AStarPathFinder lattice{sharedMap, robot};
+        r2d2::VisibilityGraphPathFinder visibility{sharedMap, robot};
+        r2d2::PrecomputationBundle bundle;
+        lattice.save_precomputation(bundle);
+        visibility.save_precomputation(bundle);
+        bundle.save(BUNDLE_FILE);
+    }
+
+    std::shared_ptr<const r2d2::PrecomputationBundle> bundle{
+            r2d2::PrecomputationBundle::open(BUNDLE_FILE)};
+    std::remove(BUNDLE_FILE);
+    EXPECT_TRUE(bundle->matches(grid));
+    std::size_t size;
+    EXPECT_NE(nullptr, bundle->get_section("connectivity", size));
+    EXPECT_EQ(nullptr, bundle->get_section("distance", size));
+
+    r2d2::AStarPathFinder lattice{sharedMap, robot};
+    r2d2::VisibilityGraphPathFinder visibility{sharedMap, robot};
+    ASSERT_TRUE(lattice.load_precomputation(*bundle));
+    ASSERT_TRUE(visibility.load_precomputation(*bundle));
+    r2d2::VisibilityGraph built{grid, robot.get_axis_size()};
+    EXPECT_EQ(built.get_vertex_count(),
+              visibility.get_graph()->get_vertex_count());
+    EXPECT_EQ(built.get_edge_count(),
+              visibility.get_graph()->get_edge_count());
+
+    // the loaded indices give the same answers as freshly made ones
+    std::vector<r2d2::Coordinate> path, expected;
+    r2d2::Coordinate start{make_coordinate(5.5, 5.5)},
+            goal{make_coordinate(25.5, 5.5)},
+            closed{make_coordinate(35.5, 5.5)};
+    EXPECT_TRUE(lattice.get_path_to_coordinate(start, goal, path));
+    EXPECT_FALSE(lattice.get_path_to_coordinate(start, closed, path));
+    ASSERT_TRUE(visibility.get_path_to_coordinate(start, goal, path));
+    ASSERT_TRUE(built.find_path(start, goal, expected));
+    ASSERT_EQ(expected.size(), path.size());
+    for (std::size_t i = 0; i < path.size(); i++) {
+        EXPECT_EQ(0, (path[i] - expected[i]).get_length() /
+                     r2d2::Length::METER);
+    }
+}
+
+TEST(PrecomputationBundle, rejects_stale_bundles) {
+    r2d2::GridMap grid{make_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::PrecomputationBundle bundle;
+    r2d2::AStarPathFinder{sharedMap, robot}.save_precomputation(bundle);
+
+    // another robot size needs another index
+    r2d2::Box larger{{}, r2d2::Translation{1.5 * r2d2::Length::METER,
+                                           1.5 * r2d2::Length::METER,
+                                           0 * r2d2::Length::METER}};
+    r2d2::AStarPathFinder other{sharedMap, larger};
+    EXPECT_FALSE(other.load_precomputation(bundle));
+
+    // opening the door of the closed room makes the bundle stale
+    grid.set_cell(35, 10, r2d2::GridMap::FREE);
+    EXPECT_FALSE(bundle.matches(grid));
+    r2d2::AStarPathFinder lattice{sharedMap, robot};
+    EXPECT_FALSE(lattice.load_precomputation(bundle));
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_TRUE(lattice.get_path_to_coordinate(
+            make_coordinate(5.5, 5.5), make_coordinate(35.5, 5.5), path));
+
+    // maps that are not a grid are hashed by their box info
+    r2d2::GridMap original{make_map()};
+    r2d2::QuadTreeMap tree{original};
+    uint64_t hash{r2d2::PrecomputationBundle::compute_map_hash(tree)};
+    EXPECT_EQ(hash, r2d2::PrecomputationBundle::compute_map_hash(tree));
+    tree.assign(grid);
+    EXPECT_NE(hash, r2d2::PrecomputationBundle::compute_map_hash(tree));
+}
+
+TEST(PrecomputationBundle, hashes_at_the_resolution_of_the_index) {
+    // a map that is not a grid, with an obstacle smaller than a meter
+    r2d2::GridMap fine{{}, .25 * r2d2::Length::METER, 80, 80,
+                       r2d2::GridMap::FREE};
+    fine.set_cell(40, 40, r2d2::GridMap::OBSTACLE);
+    r2d2::QuadTreeMap tree{fine};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{tree};
+    r2d2::PrecomputationBundle bundle;
+    r2d2::AStarPathFinder{sharedMap, robot}.save_precomputation(bundle);
+    EXPECT_TRUE(bundle.matches(tree));
+
+    // a second obstacle in the same square meter, which a hash of whole
+    // meters would not see, but the index of half a robot does
+    fine.set_cell(42, 42, r2d2::GridMap::OBSTACLE);
+    tree.assign(fine);
+    EXPECT_FALSE(bundle.matches(tree));
+}
+
+TEST(PrecomputationBundle, rejects_damaged_files) {
+    r2d2::GridMap grid{make_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::PrecomputationBundle bundle;
+    r2d2::AStarPathFinder{sharedMap, robot}.save_precomputation(bundle);
+    bundle.save(BUNDLE_FILE);
+    std::vector<char> data{read_file(BUNDLE_FILE)};
+    ASSERT_GT(data.size(), 200u);
+
+    std::vector<char> corrupt{data};
+    corrupt[corrupt.size() - 100] ^= 1;
+    write_file(BUNDLE_FILE, corrupt);
+    EXPECT_THROW(r2d2::PrecomputationBundle::open(BUNDLE_FILE),
+                 std::runtime_error);
+
+    write_file(BUNDLE_FILE, {data.begin(), data.end() - 8});
+    EXPECT_THROW(r2d2::PrecomputationBundle::open(BUNDLE_FILE),
+                 std::runtime_error);
+
+    std::vector<char> otherVersion{data};
+    otherVersion[4] ^= 2;
+    write_file(BUNDLE_FILE, otherVersion);
+    EXPECT_THROW(r2d2::PrecomputationBundle::open(BUNDLE_FILE),
+                 std::runtime_error);
+
+    std::vector<char> notABundle{data};
+    notABundle[0] = 'X';
+    write_file(BUNDLE_FILE, notABundle);
+    EXPECT_THROW(r2d2::PrecomputationBundle::open(BUNDLE_FILE),
+                 std::runtime_error);
+
+    std::remove(BUNDLE_FILE);
+    EXPECT_THROW(r2d2::PrecomputationBundle::open(BUNDLE_FILE),
+                 std::runtime_error);
+}
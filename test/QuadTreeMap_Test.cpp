@@ -0,0 +1,189 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QuadTreeMap_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the quadtree map and the quadtree pathfinder
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <random>
+#include "../source/include/QuadTreeMap.hpp"
+#include "../source/include/QuadTreePathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * a free map of 64x64 cells divided into four rooms, each wall having a
+     * door of three cells
+     */
+    r2d2::GridMap make_rooms() {
+        r2d2::GridMap grid{{}, r2d2::Length::METER, 64, 64,
+                           r2d2::GridMap::FREE};
+        for (int i = 0; i < 64; i++) {
+            grid.set_cell(32, i, r2d2::GridMap::OBSTACLE);
+            grid.set_cell(i, 32, r2d2::GridMap::OBSTACLE);
+        }
+        for (int i = 14; i < 17; i++) {
+            grid.set_cell(32, i, r2d2::GridMap::FREE);
+            grid.set_cell(32, i + 30, r2d2::GridMap::FREE);
+            grid.set_cell(i, 32, r2d2::GridMap::FREE);
+        }
+        return grid;
+    }
+
+}
+
+TEST(QuadTreeMap, box_info_matches_grid) {
+    std::mt19937 random{7};
+    r2d2::GridMap grid{make_coordinate(-3.25, 1.5), .5 * r2d2::Length::METER,
+                       37, 29, r2d2::GridMap::FREE};
+    // blocks of equal cells, so the tree has leaves of different sizes
+    for (int i = 0; i < 40; i++) {
+        int x = int(random() % 37), y = int(random() % 29),
+                size = int(random() % 6) + 1;
+        uint8_t value = uint8_t(random() % 3);
+        for (int dy = 0; dy < size && y + dy < 29; dy++) {
+            for (int dx = 0; dx < size && x + dx < 37; dx++) {
+                grid.set_cell(x + dx, y + dy, value);
+            }
+        }
+    }
+    r2d2::QuadTreeMap tree{grid};
+    EXPECT_LT(tree.get_leaf_count(), 37 * 29);
+
+    std::uniform_real_distribution<double> x{-5, 16}, y{0, 17}, size{0, 6};
+    for (int i = 0; i < 2000; i++) {
+        r2d2::Box box{make_coordinate(x(random), y(random)),
+                      r2d2::Translation{size(random) * r2d2::Length::METER,
+                                        size(random) * r2d2::Length::METER,
+                                        0 * r2d2::Length::METER}};
+        r2d2::BoxInfo expected{grid.get_box_info(box)},
+                actual{tree.get_box_info(box)};
+        ASSERT_EQ(expected.get_has_obstacle(), actual.get_has_obstacle()) << i;
+        ASSERT_EQ(expected.get_has_navigable(), actual.get_has_navigable()) << i;
+        ASSERT_EQ(expected.get_has_unknown(), actual.get_has_unknown()) << i;
+    }
+}
+
+TEST(QuadTreeMap, merges_uniform_regions) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 64, 64, r2d2::GridMap::FREE};
+    r2d2::QuadTreeMap tree{grid};
+    EXPECT_EQ(1, tree.get_leaf_count());
+    EXPECT_EQ(r2d2::GridMap::FREE, tree.get_leaf_value(0));
+
+    // a single cell splits one square on every level
+    uint64_t version = tree.get_map_version();
+    grid.set_cell(5, 9, r2d2::GridMap::OBSTACLE);
+    tree.assign(grid);
+    EXPECT_NE(version, tree.get_map_version());
+    EXPECT_EQ(1 + 3 * 6, tree.get_leaf_count());
+    int leaf = tree.find_leaf(make_coordinate(5.5, 9.5));
+    ASSERT_GE(leaf, 0);
+    EXPECT_EQ(r2d2::GridMap::OBSTACLE, tree.get_leaf_value(leaf));
+    EXPECT_EQ(-1, tree.find_leaf(make_coordinate(-.5, 3)));
+
+    // the three other cells of its square and three larger squares
+    std::vector<int> adjacent;
+    tree.get_adjacent_leaves(leaf, adjacent);
+    EXPECT_EQ(6u, adjacent.size());
+    for (int other : adjacent) {
+        std::vector<int> back;
+        tree.get_adjacent_leaves(other, back);
+        EXPECT_NE(back.end(), std::find(back.begin(), back.end(), leaf));
+    }
+}
+
+TEST(QuadTreePathFinder, path_through_doors) {
+    r2d2::GridMap grid{make_rooms()};
+    r2d2::QuadTreeMap tree{grid};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{tree};
+    r2d2::QuadTreePathFinder pf(sharedMap, {{}, robotBox});
+
+    r2d2::Coordinate start{make_coordinate(5.5, 5.5)},
+            goal{make_coordinate(50.5, 58.5)};
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path));
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(0, (path.back() - goal).get_length() / r2d2::Length::METER);
+
+    // every segment is clear of the walls for the whole robot
+    r2d2::Coordinate from = start;
+    for (const r2d2::Coordinate &to : path) {
+        r2d2::Coordinate low{std::min(from.get_x(), to.get_x()),
+                             std::min(from.get_y(), to.get_y()),
+                             0 * r2d2::Length::METER},
+                high{std::max(from.get_x(), to.get_x()),
+                     std::max(from.get_y(), to.get_y()),
+                     0 * r2d2::Length::METER};
+        r2d2::BoxInfo info{grid.get_box_info(
+                r2d2::Box{low - robotBox / 2, high + robotBox / 2})};
+        EXPECT_FALSE(info.get_has_obstacle()) << from << " " << to;
+        from = to;
+    }
+}
+
+TEST(QuadTreePathFinder, no_path) {
+    r2d2::GridMap grid{make_rooms()};
+    // close the doors of the bottom left room
+    for (int i = 14; i < 17; i++) {
+        grid.set_cell(32, i, r2d2::GridMap::OBSTACLE);
+        grid.set_cell(i, 32, r2d2::GridMap::OBSTACLE);
+    }
+    r2d2::QuadTreeMap tree{grid};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{tree};
+    r2d2::QuadTreePathFinder pf(sharedMap, {{}, robotBox});
+
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(5.5, 5.5),
+                                           make_coordinate(50.5, 58.5), path));
+    EXPECT_TRUE(pf.get_path_to_coordinate(make_coordinate(5.5, 40.5),
+                                          make_coordinate(50.5, 58.5), path));
+
+    // other maps are copied into a quadtree as well
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedGrid{grid};
+    r2d2::QuadTreePathFinder gridPf(sharedGrid, {{}, robotBox});
+    EXPECT_TRUE(gridPf.get_path_to_coordinate(make_coordinate(5.5, 40.5),
+                                              make_coordinate(50.5, 58.5),
+                                              path));
+    EXPECT_LT(gridPf.get_free_space()->get_leaf_count(), 64 * 64 / 2);
+}
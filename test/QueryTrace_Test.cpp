@@ -0,0 +1,185 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   QueryTrace_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for query trace recording
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/TracingPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+
+TEST(QueryTrace, grid_sample) {
+    r2d2::Dummy map(make_seeded_map(30, 20, .3f, 1));
+    r2d2::GridMap grid{r2d2::GridMap::sample(map)};
+    ASSERT_EQ(30, grid.get_width());
+    ASSERT_EQ(20, grid.get_height());
+    for (int y = 0; y < 20; y++) {
+        for (int x = 0; x < 30; x++) {
+            ASSERT_EQ(map.map[y][x], grid.get_cell(x, y)) << x << " " << y;
+        }
+    }
+}
+
+TEST(QueryTrace, grid_sample_covers_whole_cells) {
+    // obstacles in the corners of coarse cells, away from their centers
+    r2d2::GridMap fine{{}, .25 * r2d2::Length::METER, 12, 4,
+                       r2d2::GridMap::FREE};
+    fine.set_cell(0, 0, r2d2::GridMap::OBSTACLE);
+    fine.set_cell(7, 3, r2d2::GridMap::OBSTACLE);
+    r2d2::GridMap grid{r2d2::GridMap::sample(fine)};
+    ASSERT_EQ(3, grid.get_width());
+    ASSERT_EQ(1, grid.get_height());
+    EXPECT_EQ(r2d2::GridMap::OBSTACLE, grid.get_cell(0, 0));
+    EXPECT_EQ(r2d2::GridMap::OBSTACLE, grid.get_cell(1, 0));
+    // the obstacle only touches the border of this cell
+    EXPECT_EQ(r2d2::GridMap::FREE, grid.get_cell(2, 0));
+}
+
+TEST(QueryTrace, record_and_read) {
+    r2d2::Dummy map(make_seeded_map(40, 40, .2f, 2));
+    map.set_cell(1, 1, 0);
+    map.set_cell(38, 38, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    std::stringstream trace;
+    r2d2::QueryTraceWriter writer{trace};
+    r2d2::TracingPathFinder tracing(sharedMap, {{}, robotBox}, pf, writer);
+
+    std::vector<r2d2::Coordinate> path;
+    bool first = tracing.get_path_to_coordinate(make_coordinate(1.5, 1.5),
+                                                make_coordinate(38.5, 38.5),
+                                                path);
+    tracing.get_path_to_coordinate(make_coordinate(1.5, 1.5),
+                                   make_coordinate(20.5, 20.5), path);
+    map.set_cell(10, 10, 1);
+    bool third = tracing.get_path_to_coordinate(make_coordinate(38.5, 38.5),
+                                                make_coordinate(1.5, 1.5),
+                                                path);
+
+    r2d2::QueryTraceReader reader{trace};
+    ASSERT_EQ(r2d2::QueryTraceReader::Record::MAP, reader.next());
+    ASSERT_EQ(0, reader.get_map().get_cell(1, 1));
+    ASSERT_EQ(r2d2::QueryTraceReader::Record::QUERY, reader.next());
+    EXPECT_EQ(first, reader.get_query().found);
+    EXPECT_EQ(38.5, reader.get_query().goal.get_x() / r2d2::Length::METER);
+    EXPECT_EQ(.5, reader.get_query().robotBox.get_x() / r2d2::Length::METER);
+    ASSERT_EQ(r2d2::QueryTraceReader::Record::QUERY, reader.next());
+    // the changed cell is written as a delta
+    ASSERT_EQ(r2d2::QueryTraceReader::Record::MAP, reader.next());
+    EXPECT_EQ(1, reader.get_map().get_cell(10, 10));
+    EXPECT_EQ(r2d2::GridMap::sample(map).get_cells(),
+              reader.get_map().get_cells());
+    ASSERT_EQ(r2d2::QueryTraceReader::Record::QUERY, reader.next());
+    EXPECT_EQ(third, reader.get_query().found);
+    EXPECT_EQ(r2d2::QueryTraceReader::Record::END, reader.next());
+}
+
+TEST(QueryTrace, replay_is_deterministic) {
+    r2d2::Dummy map(make_seeded_map(40, 40, .25f, 3));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    std::stringstream trace;
+    r2d2::QueryTraceWriter writer{trace};
+    r2d2::TracingPathFinder tracing(sharedMap, {{}, robotBox}, pf, writer);
+    std::vector<r2d2::Coordinate> path;
+    for (int i = 0; i < 10; i++) {
+        tracing.get_path_to_coordinate(make_coordinate(2.5 + i, 3.5),
+                                       make_coordinate(30.5, 36.5 - i), path);
+    }
+
+    r2d2::QueryTraceReader reader{trace};
+    LockingSharedObject<r2d2::ReadOnlyMap> replayMap{reader.get_map()};
+    r2d2::AStarPathFinder replay(replayMap, {{}, robotBox});
+    int queries = 0;
+    for (r2d2::QueryTraceReader::Record record = reader.next();
+         record != r2d2::QueryTraceReader::Record::END;
+         record = reader.next()) {
+        if (record == r2d2::QueryTraceReader::Record::QUERY) {
+            const r2d2::TraceQuery &query = reader.get_query();
+            bool found = replay.get_path_to_coordinate(query.start, query.goal,
+                                                       path);
+            EXPECT_EQ(query.found, found);
+            if (found) {
+                EXPECT_EQ(query.pathLength, path.size());
+            }
+            queries++;
+        }
+    }
+    EXPECT_EQ(10, queries);
+}
+
+TEST(QueryTrace, invalid_trace) {
+    std::stringstream garbage{"this is not a trace"};
+    EXPECT_THROW(r2d2::QueryTraceReader{garbage}, std::runtime_error);
+}
+
+TEST(QueryTrace, invalid_snapshot_size) {
+    std::stringstream trace;
+    r2d2::QueryTraceWriter writer{trace};
+    writer.write_map(r2d2::GridMap{{}, 1 * r2d2::Length::METER, 1, 1,
+                                   r2d2::GridMap::FREE});
+    // the header, the record type and the origin and cell size of the map
+    std::string prefix{trace.str().substr(0, 30)};
+    for (std::string size : {std::string{"\x00\x01", 2},
+                             std::string{"\x01\x00", 2},
+                             std::string{"\x80\x80\x80\x80\x10\x01", 6}}) {
+        std::stringstream corrupt{prefix + size};
+        r2d2::QueryTraceReader reader{corrupt};
+        EXPECT_THROW(reader.next(), std::runtime_error);
+    }
+}
+
+TEST(QueryTrace, dummy_rounds_like_grid) {
+    r2d2::Dummy map(4, 4, 0);
+    r2d2::GridMap grid{r2d2::GridMap::sample(map)};
+    // a box just below zero reaches outside of both maps
+    r2d2::Box box{make_coordinate(-.25, 1.25), make_coordinate(.5, 1.75)};
+    EXPECT_TRUE(map.get_box_info(box).get_has_unknown());
+    EXPECT_EQ(grid.get_box_info(box).get_has_unknown(),
+              map.get_box_info(box).get_has_unknown());
+}
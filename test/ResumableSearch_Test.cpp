@@ -0,0 +1,232 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ResumableSearch_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Tests for the resumable search
+//!
+//! Checks that queries towards the same goal reuse the search of earlier
+//! queries, and that a changed map starts a new one.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    //! enough memory to keep every search of the tests
+    const std::size_t keptBudget = std::size_t(64) << 20;
+
+    /**
+     * a free map of 60x60 cells with a wall at x = 30 that has a gap at the
+     * top
+     */
+    r2d2::GridMap make_wall_map() {
+        r2d2::GridMap grid{{}, r2d2::Length::METER, 60, 60,
+                           r2d2::GridMap::FREE};
+        for (int i = 0; i < 50; i++) {
+            grid.set_cell(30, i, r2d2::GridMap::OBSTACLE);
+        }
+        return grid;
+    }
+
+    void expect_clear(r2d2::GridMap &grid, r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        for (const r2d2::Coordinate &to : path) {
+            r2d2::Coordinate low{std::min(from.get_x(), to.get_x()),
+                                 std::min(from.get_y(), to.get_y()),
+                                 0 * r2d2::Length::METER},
+                    high{std::max(from.get_x(), to.get_x()),
+                         std::max(from.get_y(), to.get_y()),
+                         0 * r2d2::Length::METER};
+            r2d2::BoxInfo info{grid.get_box_info(
+                    r2d2::Box{low - robotBox / 2, high + robotBox / 2})};
+            EXPECT_FALSE(info.get_has_obstacle() || info.get_has_unknown())
+                    << from << " " << to;
+            from = to;
+        }
+    }
+
+    double get_length(r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &to : path) {
+            length += (to - from).get_length() / r2d2::Length::METER;
+            from = to;
+        }
+        return length;
+    }
+
+}
+
+TEST(ResumableSearch, settled_start_is_answered_without_search) {
+    r2d2::GridMap grid{make_wall_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+    pf.set_kept_search_budget(keptBudget);
+    r2d2::Coordinate start{make_coordinate(10.5, 5.5)},
+            goal{make_coordinate(50.5, 5.5)};
+
+    std::vector<r2d2::Coordinate> first, path;
+    int expanded;
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, first,
+                                          r2d2::CancellationToken::never(),
+                                          &expanded));
+    EXPECT_GT(expanded, 100);
+    expect_clear(grid, start, first);
+
+    // the same start again
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path,
+                                          r2d2::CancellationToken::never(),
+                                          &expanded));
+    EXPECT_EQ(0, expanded);
+    EXPECT_NEAR(get_length(start, first), get_length(start, path), 1e-6);
+
+    // the robot drove to the first waypoint
+    ASSERT_GE(first.size(), 2);
+    ASSERT_TRUE(pf.get_path_to_coordinate(first[0], goal, path,
+                                          r2d2::CancellationToken::never(),
+                                          &expanded));
+    EXPECT_EQ(0, expanded);
+    expect_clear(grid, first[0], path);
+    EXPECT_NEAR(get_length(start, first) - get_length(start, {first[0]}),
+                get_length(first[0], path), 1e-6);
+}
+
+TEST(ResumableSearch, resumes_for_a_new_start) {
+    r2d2::GridMap grid{make_wall_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}},
+            fresh{sharedMap, {{}, robotBox}};
+    pf.set_kept_search_budget(keptBudget);
+    r2d2::Coordinate goal{make_coordinate(50.5, 5.5)};
+
+    std::vector<r2d2::Coordinate> path, expected;
+    int expanded, freshExpanded;
+    ASSERT_TRUE(pf.get_path_to_coordinate(make_coordinate(10.5, 5.5), goal,
+                                          path,
+                                          r2d2::CancellationToken::never(),
+                                          &expanded));
+    // a start the first search did not get to
+    r2d2::Coordinate start{make_coordinate(5.5, 20.5)};
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path,
+                                          r2d2::CancellationToken::never(),
+                                          &expanded));
+    ASSERT_TRUE(fresh.get_path_to_coordinate(start, goal, expected,
+                                             r2d2::CancellationToken::never(),
+                                             &freshExpanded));
+    EXPECT_GT(expanded, 0);
+    EXPECT_LT(expanded, freshExpanded / 2);
+    expect_clear(grid, start, path);
+    // both are shortest paths on the lattice
+    EXPECT_NEAR(get_length(start, expected), get_length(start, path), 1e-6);
+}
+
+TEST(ResumableSearch, changed_map_starts_over) {
+    r2d2::GridMap grid{make_wall_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+    pf.set_kept_search_budget(keptBudget);
+    r2d2::Coordinate start{make_coordinate(10.5, 5.5)},
+            goal{make_coordinate(50.5, 5.5)};
+
+    std::vector<r2d2::Coordinate> path;
+    int expanded;
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path));
+    // close the gap in the wall
+    for (int i = 50; i < 60; i++) {
+        grid.set_cell(30, i, r2d2::GridMap::OBSTACLE);
+    }
+    EXPECT_FALSE(pf.get_path_to_coordinate(start, goal, path));
+    for (int i = 50; i < 60; i++) {
+        grid.set_cell(30, i, r2d2::GridMap::FREE);
+    }
+    grid.set_cell(30, 55, r2d2::GridMap::OBSTACLE);
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path,
+                                          r2d2::CancellationToken::never(),
+                                          &expanded));
+    EXPECT_GT(expanded, 100);
+    expect_clear(grid, start, path);
+}
+
+TEST(ResumableSearch, unversioned_map_is_searched_anew) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 60, 60, r2d2::GridMap::FREE};
+    UnversionedMap unversioned{grid};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{unversioned};
+    r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+    pf.set_kept_search_budget(keptBudget);
+    r2d2::Coordinate start{make_coordinate(10.5, 5.5)},
+            goal{make_coordinate(50.5, 5.5)};
+
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path));
+    // the wall of make_wall_map appears, the map cannot tell
+    for (int i = 0; i < 50; i++) {
+        grid.set_cell(30, i, r2d2::GridMap::OBSTACLE);
+    }
+    int expanded;
+    ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path,
+                                          r2d2::CancellationToken::never(),
+                                          &expanded));
+    EXPECT_GT(expanded, 100);
+    expect_clear(grid, start, path);
+}
+
+TEST(ResumableSearch, not_kept_by_default_or_beyond_the_budget) {
+    r2d2::GridMap grid{make_wall_map()};
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::Coordinate start{make_coordinate(10.5, 5.5)},
+            goal{make_coordinate(50.5, 5.5)};
+
+    for (std::size_t budget : {std::size_t(0), std::size_t(1)}) {
+        r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+        pf.set_kept_search_budget(budget);
+        std::vector<r2d2::Coordinate> first, path;
+        int expanded;
+        ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, first));
+        ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path,
+                                              r2d2::CancellationToken::never(),
+                                              &expanded));
+        EXPECT_GT(expanded, 100) << budget;
+        EXPECT_NEAR(get_length(start, first), get_length(start, path), 1e-6);
+    }
+}
@@ -0,0 +1,147 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   ScenarioGenerator_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Tests for the scenario generator
+//!
+//! Checks that generated scenarios are reproducible and solvable, and that the
+//! pathfinder reaches the reference cost of their queries.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    const r2d2::ScenarioKind kinds[] = {
+            r2d2::ScenarioKind::RANDOM, r2d2::ScenarioKind::ROOMS,
+            r2d2::ScenarioKind::MAZE, r2d2::ScenarioKind::CAVES,
+            r2d2::ScenarioKind::WAREHOUSE, r2d2::ScenarioKind::CORRIDORS};
+
+    double get_density(r2d2::ScenarioKind kind) {
+        return kind == r2d2::ScenarioKind::CAVES ? .45 : .25;
+    }
+
+}
+
+TEST(ScenarioGenerator, deterministic) {
+    for (r2d2::ScenarioKind kind : kinds) {
+        r2d2::ScenarioGenerator generator{kind, 100, 90, 7,
+                                          get_density(kind)};
+        r2d2::GridMap single{generator.generate(1)},
+                multiple{generator.generate(4)};
+        EXPECT_TRUE(single.get_cells() == multiple.get_cells());
+
+        // a band of rows on its own is the same as the rows of the map
+        std::vector<uint8_t> band(100 * 20);
+        generator.generate_rows(35, 20, band.data(), 3);
+        EXPECT_TRUE(std::equal(band.begin(), band.end(),
+                               single.get_cells().begin() + 35 * 100));
+
+        r2d2::ScenarioGenerator other{kind, 100, 90, 8, get_density(kind)};
+        EXPECT_FALSE(single.get_cells() == other.generate().get_cells());
+
+        std::vector<r2d2::ScenarioQuery> first{
+                generator.make_queries(single, 6, 1)},
+                second{generator.make_queries(multiple, 6, 4)};
+        ASSERT_EQ(first.size(), second.size());
+        for (std::size_t i = 0; i < first.size(); i++) {
+            EXPECT_EQ(0, (first[i].start - second[i].start).get_length() /
+                         r2d2::Length::METER);
+            EXPECT_EQ(0, (first[i].goal - second[i].goal).get_length() /
+                         r2d2::Length::METER);
+            EXPECT_EQ(first[i].referenceCost / r2d2::Length::METER,
+                      second[i].referenceCost / r2d2::Length::METER);
+        }
+    }
+}
+
+TEST(ScenarioGenerator, every_kind_is_solvable) {
+    for (r2d2::ScenarioKind kind : kinds) {
+        r2d2::ScenarioGenerator generator{kind, 96, 96, 3, get_density(kind)};
+        r2d2::Scenario scenario{generator.make_scenario(8)};
+        const std::vector<uint8_t> &cells = scenario.map.get_cells();
+        double obstacles = double(std::count(cells.begin(), cells.end(),
+                                             r2d2::GridMap::OBSTACLE)) /
+                           cells.size();
+        EXPECT_GT(obstacles, .02) << int(kind);
+        EXPECT_LT(obstacles, .8) << int(kind);
+
+        ASSERT_EQ(8, scenario.queries.size()) << int(kind);
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            // no path is shorter than the straight line
+            EXPECT_GE(query.referenceCost / r2d2::Length::METER + 1e-9,
+                      (query.goal - query.start).get_length() /
+                      r2d2::Length::METER);
+            EXPECT_GE((query.goal - query.start).get_length() /
+                      r2d2::Length::METER, 24);
+        }
+    }
+}
+
+TEST(ScenarioGenerator, pathfinder_reaches_reference) {
+    for (r2d2::ScenarioKind kind : kinds) {
+        r2d2::ScenarioGenerator generator{kind, 64, 64, 11,
+                                          get_density(kind)};
+        r2d2::Scenario scenario{generator.make_scenario(3, 1)};
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{scenario.map};
+        r2d2::AStarPathFinder pf{sharedMap, {{}, robotBox}};
+        for (const r2d2::ScenarioQuery &query : scenario.queries) {
+            std::vector<r2d2::Coordinate> path;
+            ASSERT_TRUE(pf.get_path_to_coordinate(query.start, query.goal,
+                                                  path))
+                    << int(kind) << " " << query.start << " " << query.goal;
+            r2d2::Length length{0 * r2d2::Length::METER};
+            r2d2::Coordinate from{query.start};
+            for (const r2d2::Coordinate &to : path) {
+                length += (to - from).get_length();
+                from = to;
+            }
+            // the lattice of the robot contains every reference path
+            EXPECT_LE(length / r2d2::Length::METER,
+                      query.referenceCost / r2d2::Length::METER + 1e-6)
+                    << int(kind);
+        }
+    }
+}
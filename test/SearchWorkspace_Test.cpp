@@ -0,0 +1,147 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   SearchWorkspace_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  gtest unit tests
+//!
+//! gtest unit tests for the reusable search workspace
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    // counts the allocations of the thread that enabled counting
+    thread_local bool countAllocations = false;
+    std::atomic<int> allocations{0};
+
+}
+
+void *operator new(std::size_t size) {
+    if (countAllocations) {
+        allocations++;
+    }
+    void *memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc{};
+    }
+    return memory;
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+TEST(SearchWorkspace, reset_forgets_nodes) {
+    r2d2::SearchWorkspace workspace;
+    for (int i = 0; i < 5000; i++) {
+        workspace.insert(r2d2::SearchWorkspace::make_key(i, -i)).g = i;
+    }
+    // the table grew, and kept all nodes
+    for (int i = 0; i < 5000; i++) {
+        r2d2::SearchWorkspace::Visited *visited{
+                workspace.find(r2d2::SearchWorkspace::make_key(i, -i))};
+        ASSERT_NE(nullptr, visited);
+        EXPECT_EQ(i, visited->g);
+    }
+    EXPECT_EQ(nullptr, workspace.find(r2d2::SearchWorkspace::make_key(-1, 1)));
+
+    workspace.reset();
+    EXPECT_EQ(nullptr, workspace.find(r2d2::SearchWorkspace::make_key(7, -7)));
+    EXPECT_TRUE(std::isinf(
+            workspace.insert(r2d2::SearchWorkspace::make_key(7, -7)).g));
+
+    EXPECT_EQ(-3, r2d2::SearchWorkspace::get_key_x(
+            r2d2::SearchWorkspace::make_key(-3, 12)));
+    EXPECT_EQ(12, r2d2::SearchWorkspace::get_key_y(
+            r2d2::SearchWorkspace::make_key(-3, 12)));
+}
+
+TEST(SearchWorkspace, steady_state_without_allocations) {
+    r2d2::Dummy map(make_seeded_map(40, 40, .2f, 5));
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, robotBox});
+    std::vector<std::pair<r2d2::Coordinate, r2d2::Coordinate>> queries{
+            {make_coordinate(1.5, 1.5), make_coordinate(38.5, 38.5)},
+            {make_coordinate(20.5, 3.5), make_coordinate(4.5, 30.5)},
+            {make_coordinate(35.5, 10.5), make_coordinate(12.5, 22.5)},
+            {make_coordinate(2.5, 36.5), make_coordinate(30.5, 2.5)},
+            {make_coordinate(18.5, 18.5), make_coordinate(37.5, 20.5)},
+            {make_coordinate(8.5, 12.5), make_coordinate(26.5, 33.5)}};
+    for (std::pair<r2d2::Coordinate, r2d2::Coordinate> &query : queries) {
+        map.set_cell(int(query.first.get_x() / r2d2::Length::METER),
+                     int(query.first.get_y() / r2d2::Length::METER), 0);
+        map.set_cell(int(query.second.get_x() / r2d2::Length::METER),
+                     int(query.second.get_y() / r2d2::Length::METER), 0);
+    }
+
+    // the first round lets the buffers grow
+    std::vector<r2d2::Coordinate> path;
+    path.reserve(1024);
+    std::vector<bool> found;
+    for (std::pair<r2d2::Coordinate, r2d2::Coordinate> &query : queries) {
+        found.push_back(pf.get_path_to_coordinate(query.first, query.second,
+                                                  path));
+    }
+
+    EXPECT_LE(4, std::count(found.begin(), found.end(), true));
+
+    allocations = 0;
+    countAllocations = true;
+    for (int round = 0; round < 3; round++) {
+        for (std::size_t i = 0; i < queries.size(); i++) {
+            EXPECT_EQ(found[i], pf.get_path_to_coordinate(
+                    queries[i].first, queries[i].second, path));
+        }
+    }
+    countAllocations = false;
+    EXPECT_EQ(0, allocations.load());
+}
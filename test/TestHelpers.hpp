@@ -0,0 +1,109 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   TestHelpers.hpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Shared test helpers
+//!
+//! Helpers shared by the tests and benchmarks of the pathfinding module.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#ifndef R2D2_PATHFINDING_TESTHELPERS_HPP
+#define R2D2_PATHFINDING_TESTHELPERS_HPP
+
+#include <random>
+#include <vector>
+#include "../../adt/source/include/Coordinate.hpp"
+#include "../../adt/source/include/Translation.hpp"
+#include "../../map/source/include/MapInterface.hpp"
+
+/**
+ * make a coordinate on the floor from meters
+ */
+inline r2d2::Coordinate make_coordinate(double x, double y) {
+    return {x * r2d2::Length::METER, y * r2d2::Length::METER,
+            0 * r2d2::Length::METER};
+}
+
+//! the size of the robot the tests and benchmarks plan for
+const r2d2::Translation robotBox{.5 * r2d2::Length::METER,
+                                 .5 * r2d2::Length::METER,
+                                 0 * r2d2::Length::METER};
+
+/**
+ * make a random map of x by y cells, where each cell is an obstacle with
+ * the given chance, that is the same for every run with the same seed
+ */
+inline std::vector<std::vector<int>> make_seeded_map(int x, int y,
+                                                     float obstacles,
+                                                     unsigned seed) {
+    std::mt19937_64 random{seed};
+    std::vector<std::vector<int>> map(std::size_t(y),
+                                      std::vector<int>(std::size_t(x), 0));
+    for (std::vector<int> &row : map) {
+        for (int &cell : row) {
+            cell = std::uniform_real_distribution<float>{}(random) <
+                   obstacles ? 1 : 0;
+        }
+    }
+    return map;
+}
+
+/**
+ * map that answers from another map, without its version, so a pathfinder
+ * keeps no searches and no connectivity index for it
+ */
+class UnversionedMap : public r2d2::ReadOnlyMap {
+public:
+    UnversionedMap(r2d2::ReadOnlyMap &map) : map(map) {
+    }
+
+    virtual const r2d2::BoxInfo get_box_info(const r2d2::Box box) override {
+        return map.get_box_info(box);
+    }
+
+    virtual const r2d2::Box get_map_bounding_box() override {
+        return map.get_map_bounding_box();
+    }
+
+private:
+    r2d2::ReadOnlyMap &map;
+};
+
+#endif //R2D2_PATHFINDING_TESTHELPERS_HPP
@@ -0,0 +1,178 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   Tracing_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Timeline tracing tests
+//!
+//! Tests for the trace buffers and the Chrome trace event export.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+#include "../source/include/Tracing.hpp"
+#include "../source/include/Dummy.hpp"
+#include "../source/include/AStarPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+
+namespace {
+
+    int count_occurrences(const std::string &text, const std::string &part) {
+        int count = 0;
+        for (std::size_t i = text.find(part); i != std::string::npos;
+             i = text.find(part, i + 1)) {
+            count++;
+        }
+        return count;
+    }
+
+}
+
+TEST(Tracing, ring_buffer_keeps_latest) {
+    r2d2::TraceBuffer buffer{7};
+    for (uint64_t i = 0; i < r2d2::TraceBuffer::CAPACITY + 10; i++) {
+        buffer.record("event", i * 1000, 500);
+    }
+    std::ostringstream out;
+    EXPECT_FALSE(buffer.write(out, true));
+    std::string text{out.str()};
+    EXPECT_EQ(int(r2d2::TraceBuffer::CAPACITY),
+              count_occurrences(text, "\"ph\":\"X\""));
+    // the oldest events were overwritten
+    EXPECT_EQ(std::string::npos, text.find("\"ts\":9.000"));
+    EXPECT_NE(std::string::npos, text.find("\"ts\":10.000,\"dur\":0.500"));
+    EXPECT_NE(std::string::npos, text.find("\"tid\":7"));
+
+    buffer.clear();
+    std::ostringstream empty;
+    EXPECT_TRUE(buffer.write(empty, true));
+    EXPECT_TRUE(empty.str().empty());
+}
+
+TEST(Tracing, chrome_trace) {
+    r2d2::TraceLog::clear();
+    {
+        r2d2::TraceScope scope{"outer"};
+        for (int i = 0; i < 3; i++) {
+            r2d2::TraceBoxQuery query{};
+        }
+    }
+    std::thread other{[]() {
+        r2d2::TraceScope scope{"other thread"};
+        for (int i = 0; i < r2d2::TraceScope::CHUNK + 1; i++) {
+            scope.chunk();
+        }
+    }};
+    other.join();
+
+    std::ostringstream out;
+    r2d2::TraceLog::write_chrome_trace(out);
+    std::string text{out.str()};
+    EXPECT_EQ(0u, text.find("{\"traceEvents\":["));
+    EXPECT_EQ(1, count_occurrences(text, "\"name\":\"outer\""));
+    // the queries directly follow each other, so they form one burst
+    EXPECT_EQ(1, count_occurrences(text, "\"name\":\"get_box_info\""));
+    EXPECT_NE(std::string::npos, text.find("\"args\":{\"count\":3}"));
+    // a full chunk and the remaining step
+    EXPECT_EQ(2, count_occurrences(text, "\"name\":\"other thread\""));
+    EXPECT_NE(std::string::npos, text.find(
+            "\"args\":{\"count\":" + std::to_string(r2d2::TraceScope::CHUNK)));
+
+    r2d2::TraceLog::clear();
+    std::ostringstream cleared;
+    r2d2::TraceLog::write_chrome_trace(cleared);
+    EXPECT_EQ(0, count_occurrences(cleared.str(), "\"ph\":\"X\""));
+}
+
+TEST(Tracing, ended_threads) {
+    r2d2::TraceLog::clear();
+    // a burst that is still open when its thread ends
+    std::thread first{[]() {
+        for (int i = 0; i < 5; i++) {
+            r2d2::TraceBoxQuery query{};
+        }
+    }};
+    first.join();
+    std::ostringstream out;
+    r2d2::TraceLog::write_chrome_trace(out);
+    EXPECT_NE(std::string::npos, out.str().find("\"args\":{\"count\":5}"));
+
+    // threads that follow each other take over the same buffer
+    int buffers = count_occurrences(out.str(), "\"thread_name\"");
+    for (int t = 0; t < 8; t++) {
+        std::thread next{[]() {
+            r2d2::TraceScope scope{"next thread"};
+        }};
+        next.join();
+    }
+    std::ostringstream after;
+    r2d2::TraceLog::write_chrome_trace(after);
+    EXPECT_EQ(buffers, count_occurrences(after.str(), "\"thread_name\""));
+    EXPECT_EQ(8, count_occurrences(after.str(), "\"name\":\"next thread\""));
+}
+
+#ifdef R2D2_PATHFINDING_TRACING
+TEST(Tracing, query_phases) {
+    r2d2::Dummy map(30, 30, 0);
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+    r2d2::AStarPathFinder pf(sharedMap, {{}, r2d2::Translation{
+            .5 * r2d2::Length::METER, .5 * r2d2::Length::METER,
+            0 * r2d2::Length::METER}});
+
+    r2d2::TraceLog::clear();
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(pf.get_path_to_coordinate(
+            {.5 * r2d2::Length::METER, .5 * r2d2::Length::METER,
+             0 * r2d2::Length::METER},
+            {20.5 * r2d2::Length::METER, 25.5 * r2d2::Length::METER,
+             0 * r2d2::Length::METER}, path));
+
+    std::ostringstream out;
+    r2d2::TraceLog::write_chrome_trace(out);
+    std::string text{out.str()};
+    for (const char *name : {"get_path_to_coordinate", "acquire map",
+                             "build connectivity index", "search",
+                             "extract path", "smooth_path", "get_box_info"}) {
+        EXPECT_NE(std::string::npos,
+                  text.find(std::string{"\"name\":\""} + name + "\""))
+            << name;
+    }
+}
+#endif
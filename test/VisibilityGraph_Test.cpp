@@ -0,0 +1,215 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   VisibilityGraph_Test.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Visibility graph tests
+//!
+//! Tests for the visibility graph and the pathfinder searching it.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/GridMap.hpp"
+#include "../source/include/VisibilityGraphPathFinder.hpp"
+#include "../../sharedobjects/source/include/LockingSharedObject.hpp"
+#include "TestHelpers.hpp"
+
+namespace {
+
+    /**
+     * a free map of 40x30 cells with a single rack in the middle
+     */
+    r2d2::GridMap make_rack() {
+        r2d2::GridMap grid{{}, r2d2::Length::METER, 40, 30,
+                           r2d2::GridMap::FREE};
+        for (int y = 5; y < 25; y++) {
+            for (int x = 15; x < 25; x++) {
+                grid.set_cell(x, y, r2d2::GridMap::OBSTACLE);
+            }
+        }
+        return grid;
+    }
+
+    double get_length(r2d2::Coordinate start,
+                      const std::vector<r2d2::Coordinate> &path) {
+        double length = 0;
+        for (const r2d2::Coordinate &coord : path) {
+            length += (coord - start).get_length() / r2d2::Length::METER;
+            start = coord;
+        }
+        return length;
+    }
+
+    /**
+     * check the robot footprint along a path at small intervals
+     */
+    void expect_clear(r2d2::ReadOnlyMap &map, r2d2::Coordinate from,
+                      const std::vector<r2d2::Coordinate> &path) {
+        for (const r2d2::Coordinate &to : path) {
+            r2d2::Translation segment{to - from};
+            int steps = int(segment.get_length() / r2d2::Length::METER / .05) + 1;
+            for (int i = 0; i <= steps; i++) {
+                r2d2::Coordinate position{from + segment * (double(i) / steps)};
+                r2d2::BoxInfo info{map.get_box_info(r2d2::Box{
+                        position - robotBox / 2, position + robotBox / 2})};
+                ASSERT_FALSE(info.get_has_obstacle() || info.get_has_unknown())
+                    << position;
+            }
+            from = to;
+        }
+    }
+
+}
+
+TEST(VisibilityGraph, open_map) {
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 30, 30, r2d2::GridMap::FREE};
+    r2d2::VisibilityGraph graph{grid, robotBox, .5 * r2d2::Length::METER};
+    // the border only has inner corners
+    EXPECT_EQ(0, graph.get_vertex_count());
+
+    std::vector<r2d2::Coordinate> path;
+    ASSERT_TRUE(graph.find_path(make_coordinate(5, 5), make_coordinate(25, 20),
+                                path));
+    ASSERT_EQ(1u, path.size());
+    EXPECT_FALSE(graph.is_free(make_coordinate(.1, 5)));
+}
+
+TEST(VisibilityGraph, around_rack) {
+    r2d2::GridMap grid{make_rack()};
+    // the robot positions next to the rack are blocked up to the next half
+    // cell, so the corners are at 14.5 and 25.5 in both directions
+    r2d2::VisibilityGraph graph{grid, robotBox, .5 * r2d2::Length::METER};
+    EXPECT_EQ(4, graph.get_vertex_count());
+    // the sides of the rack, but not its diagonals
+    EXPECT_EQ(4, graph.get_edge_count());
+
+    r2d2::Coordinate start{make_coordinate(5, 15)};
+    std::vector<r2d2::Coordinate> path;
+    r2d2::Length cost;
+    ASSERT_TRUE(graph.find_path(start, make_coordinate(35, 15), path, &cost));
+    ASSERT_EQ(3u, path.size());
+    EXPECT_NEAR(2 * std::hypot(9.5, 10.5) + 11, cost / r2d2::Length::METER,
+                1e-9);
+    EXPECT_NEAR(get_length(start, path), cost / r2d2::Length::METER, 1e-9);
+    EXPECT_NEAR(14.5, path[0].get_x() / r2d2::Length::METER, 1e-9);
+    EXPECT_NEAR(25.5, path[1].get_x() / r2d2::Length::METER, 1e-9);
+    expect_clear(grid, start, path);
+}
+
+TEST(VisibilityGraph, shorter_than_grid_search) {
+    std::mt19937 random{3};
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 60, 60, r2d2::GridMap::FREE};
+    for (int rack = 0; rack < 25; rack++) {
+        int x = int(random() % 52), y = int(random() % 56);
+        for (int dy = 0; dy < 3; dy++) {
+            for (int dx = 0; dx < 8; dx++) {
+                grid.set_cell(x + dx, y + dy, r2d2::GridMap::OBSTACLE);
+            }
+        }
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::VisibilityGraphPathFinder pf(sharedMap, {{}, robotBox},
+                                       .25 * r2d2::Length::METER);
+    r2d2::AStarPathFinder astar(sharedMap, {{}, robotBox});
+
+    int found = 0;
+    for (int i = 0; i < 40; i++) {
+        r2d2::Coordinate start{make_coordinate(random() % 60 + .5,
+                                               random() % 60 + .5)},
+                goal{make_coordinate(random() % 60 + .5, random() % 60 + .5)};
+        std::vector<r2d2::Coordinate> gridPath, path;
+        if (!astar.get_path_to_coordinate(start, goal, gridPath)) {
+            continue;
+        }
+        found++;
+        ASSERT_TRUE(pf.get_path_to_coordinate(start, goal, path))
+            << start << " " << goal;
+        EXPECT_LE(get_length(start, path), get_length(start, gridPath) + 1e-9)
+            << start << " " << goal;
+        expect_clear(grid, start, path);
+    }
+    EXPECT_GT(found, 20);
+}
+
+TEST(VisibilityGraph, no_path) {
+    r2d2::GridMap grid{make_rack()};
+    for (int y = 0; y < 30; y++) {
+        grid.set_cell(20, y, r2d2::GridMap::OBSTACLE);
+    }
+    LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{grid};
+    r2d2::VisibilityGraphPathFinder pf(sharedMap, {{}, robotBox});
+
+    std::vector<r2d2::Coordinate> path;
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(5, 15),
+                                           make_coordinate(35, 15), path));
+    EXPECT_FALSE(pf.get_path_to_coordinate(make_coordinate(20.5, 15),
+                                           make_coordinate(35, 15), path));
+
+    // the graph follows changes of the map
+    uint64_t version = pf.get_graph()->get_map_version();
+    grid.set_cell(20, 2, r2d2::GridMap::FREE);
+    grid.set_cell(20, 1, r2d2::GridMap::FREE);
+    grid.set_cell(20, 3, r2d2::GridMap::FREE);
+    EXPECT_TRUE(pf.get_path_to_coordinate(make_coordinate(5, 15),
+                                          make_coordinate(35, 15), path));
+    EXPECT_NE(version, pf.get_graph()->get_map_version());
+}
+
+TEST(VisibilityGraph, thread_count_independent) {
+    std::mt19937 random{8};
+    r2d2::GridMap grid{{}, r2d2::Length::METER, 50, 50, r2d2::GridMap::FREE};
+    for (int i = 0; i < 80; i++) {
+        grid.set_cell(int(random() % 50), int(random() % 50),
+                      r2d2::GridMap::OBSTACLE);
+    }
+    r2d2::VisibilityGraph single{grid, robotBox, r2d2::Length::METER, 1},
+            multiple{grid, robotBox, r2d2::Length::METER, 3};
+    ASSERT_EQ(single.get_vertex_count(), multiple.get_vertex_count());
+    ASSERT_EQ(single.get_edge_count(), multiple.get_edge_count());
+    EXPECT_GT(single.get_edge_count(), 0);
+    std::vector<int> a, b;
+    for (int i = 0; i < single.get_vertex_count(); i++) {
+        single.get_neighbours(i, a);
+        multiple.get_neighbours(i, b);
+        EXPECT_EQ(a, b) << i;
+    }
+}
@@ -0,0 +1,246 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningLoad.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Load generator for the planning daemon
+//!
+//! Sends pipelined batches of scenario queries to a PlanningServer over several
+//! connections and reports the throughput and the tail latency.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "../source/include/PlanningClient.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+
+namespace {
+
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * the measurements of a single connection
+     */
+    struct ConnectionLoad {
+        std::vector<double> latencies;
+        long found = 0, queries = 0;
+        std::string error;
+    };
+
+    double percentile(std::vector<double> values, double fraction) {
+        if (values.empty()) {
+            return 0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[std::size_t(fraction * (values.size() - 1))];
+    }
+
+    /**
+     * keep up to depth batches outstanding on a single connection
+     */
+    void run_connection(const std::string &socketPath,
+                        const std::vector<r2d2::PlanningQuery> &queries,
+                        int first, int batchSize, int batchCount, int depth,
+                        ConnectionLoad &load) {
+        std::unique_ptr<r2d2::PlanningClient> client;
+        try {
+            client.reset(new r2d2::PlanningClient{socketPath});
+        } catch (const std::exception &error) {
+            load.error = error.what();
+            return;
+        }
+        std::mutex mutex;
+        std::condition_variable replied;
+        std::vector<Clock::time_point> sent(static_cast<std::size_t>(batchCount));
+        int outstanding = 0;
+        bool failed = false;
+
+        std::thread receiver{[&]() {
+            std::vector<r2d2::PathResult> results;
+            try {
+                for (int i = 0; i < batchCount; i++) {
+                    uint32_t batchId = client->receive(results);
+                    Clock::time_point now{Clock::now()};
+                    std::lock_guard<std::mutex> lock{mutex};
+                    load.latencies.push_back(
+                            std::chrono::duration<double, std::milli>(
+                                    now - sent.at(batchId)).count());
+                    for (const r2d2::PathResult &result : results) {
+                        load.found += result.status ==
+                                      r2d2::PathResult::Status::FOUND;
+                    }
+                    load.queries += long(results.size());
+                    outstanding--;
+                    replied.notify_one();
+                }
+            } catch (const std::exception &error) {
+                std::lock_guard<std::mutex> lock{mutex};
+                load.error = error.what();
+                failed = true;
+                replied.notify_one();
+            }
+        }};
+
+        std::vector<r2d2::PlanningQuery> batch;
+        try {
+            for (int i = 0; i < batchCount; i++) {
+                batch.clear();
+                for (int j = 0; j < batchSize; j++) {
+                    batch.push_back(queries[(first + i * batchSize + j) %
+                                            queries.size()]);
+                }
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    replied.wait(lock, [&]() {
+                        return failed || outstanding < depth;
+                    });
+                    if (failed) {
+                        break;
+                    }
+                    outstanding++;
+                    // the ids count up from zero
+                    sent[std::size_t(i)] = Clock::now();
+                }
+                client->send(batch);
+            }
+        } catch (const std::exception &error) {
+            // the receiver fails as well, as the connection is gone
+            std::lock_guard<std::mutex> lock{mutex};
+            load.error = error.what();
+        }
+        receiver.join();
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <socket> [--kind <kind>]"
+                  << " [--size <cells>] [--seed <seed>]"
+                  << " [--connections <n>] [--depth <batches>]"
+                  << " [--batch <queries>] [--batches <per connection>]"
+                  << std::endl;
+        return 2;
+    }
+    r2d2::ScenarioKind kind = r2d2::ScenarioKind::ROOMS;
+    int size = 1024, connections = 4, depth = 8, batchSize = 16,
+            batchCount = 100;
+    uint64_t seed = 1;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--kind") == 0) {
+            if (!r2d2::parse_scenario_kind(argv[i + 1], kind)) {
+                std::cerr << "unknown kind " << argv[i + 1] << std::endl;
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--size") == 0) {
+            size = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            seed = std::strtoull(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--connections") == 0) {
+            connections = std::max(1, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--depth") == 0) {
+            depth = std::max(1, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--batch") == 0) {
+            batchSize = std::max(1, std::min(std::atoi(argv[i + 1]),
+                                             int(r2d2::PLANNING_MAX_BATCH)));
+        } else if (std::strcmp(argv[i], "--batches") == 0) {
+            batchCount = std::max(1, std::atoi(argv[i + 1]));
+        }
+    }
+
+    // the same scenario as the server, so the queries are solvable
+    r2d2::ScenarioGenerator generator{
+            kind, size, size, seed,
+            kind == r2d2::ScenarioKind::CAVES ? .45 : .25};
+    std::vector<r2d2::ScenarioQuery> scenarioQueries{
+            generator.make_queries(generator.generate(), 256)};
+    if (scenarioQueries.empty()) {
+        std::cerr << "the scenario has no solvable queries" << std::endl;
+        return 1;
+    }
+    std::vector<r2d2::PlanningQuery> queries;
+    for (const r2d2::ScenarioQuery &query : scenarioQueries) {
+        queries.push_back(r2d2::PlanningQuery{query.start, query.goal});
+    }
+
+    std::vector<ConnectionLoad> loads(static_cast<std::size_t>(connections));
+    std::vector<std::thread> threads;
+    Clock::time_point start{Clock::now()};
+    for (int i = 0; i < connections; i++) {
+        threads.emplace_back(run_connection, std::string{argv[1]},
+                             std::cref(queries), i * batchCount * batchSize,
+                             batchSize, batchCount, depth,
+                             std::ref(loads[std::size_t(i)]));
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start)
+            .count();
+
+    std::vector<double> latencies;
+    long found = 0, answered = 0;
+    for (const ConnectionLoad &load : loads) {
+        if (!load.error.empty()) {
+            std::cerr << load.error << std::endl;
+            return 1;
+        }
+        latencies.insert(latencies.end(), load.latencies.begin(),
+                         load.latencies.end());
+        found += load.found;
+        answered += load.queries;
+    }
+    std::cout << std::fixed << std::setprecision(2) << answered
+              << " queries in " << seconds << " s, " << answered / seconds
+              << " queries/s, " << found << " found" << std::endl;
+    std::cout << "batch latency ms: p50 " << percentile(latencies, .5)
+              << "  p90 " << percentile(latencies, .9) << "  p99 "
+              << percentile(latencies, .99) << "  p99.9 "
+              << percentile(latencies, .999) << "  max "
+              << percentile(latencies, 1) << std::endl;
+    return 0;
+}
@@ -0,0 +1,137 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   PlanningServer.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \date   Last Modified: 19-10-2026
+//! \brief  Planning daemon
+//!
+//! Generates a scenario map and serves path queries on it over a Unix domain
+//! socket until it is interrupted.
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/PlanningServer.hpp"
+#include "../source/include/PrecomputationBundle.hpp"
+#include "../source/include/ScenarioGenerator.hpp"
+#include "LockingSharedObject.hpp"
+
+namespace {
+
+    r2d2::PlanningServer *runningServer = nullptr;
+
+    void handle_signal(int) {
+        if (runningServer != nullptr) {
+            runningServer->stop();
+        }
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <socket> [--kind <kind>]"
+                  << " [--size <cells>] [--seed <seed>] [--robot <meters>]"
+                  << " [--threads <n>] [--max-in-flight <n>]"
+                  << " [--bundle <file>]" << std::endl;
+        return 2;
+    }
+    r2d2::ScenarioKind kind = r2d2::ScenarioKind::ROOMS;
+    int size = 1024, threads = 0, maxInFlight = 256;
+    uint64_t seed = 1;
+    double robot = .5;
+    const char *bundlePath = nullptr;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--kind") == 0) {
+            if (!r2d2::parse_scenario_kind(argv[i + 1], kind)) {
+                std::cerr << "unknown kind " << argv[i + 1] << std::endl;
+                return 2;
+            }
+        } else if (std::strcmp(argv[i], "--size") == 0) {
+            size = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            seed = std::strtoull(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--robot") == 0) {
+            robot = std::atof(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--threads") == 0) {
+            threads = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--max-in-flight") == 0) {
+            maxInFlight = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--bundle") == 0) {
+            bundlePath = argv[i + 1];
+        }
+    }
+
+    try {
+        r2d2::GridMap map{r2d2::ScenarioGenerator{
+                kind, size, size, seed,
+                kind == r2d2::ScenarioKind::CAVES ? .45 : .25}.generate()};
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{map};
+        r2d2::Translation robotBox{robot * r2d2::Length::METER,
+                                   robot * r2d2::Length::METER,
+                                   0 * r2d2::Length::METER};
+        r2d2::AStarPathFinder pathFinder{sharedMap, {{}, robotBox}};
+        if (bundlePath != nullptr &&
+            !pathFinder.load_precomputation(
+                    *r2d2::PrecomputationBundle::open(bundlePath))) {
+            std::cerr << bundlePath << " does not match the map" << std::endl;
+        }
+
+        r2d2::PlanningServer server{pathFinder, argv[1], threads,
+                                    maxInFlight};
+        runningServer = &server;
+        std::signal(SIGINT, handle_signal);
+        std::signal(SIGTERM, handle_signal);
+        std::signal(SIGPIPE, SIG_IGN);
+        std::cout << "serving a " << r2d2::get_scenario_kind_name(kind)
+                  << " map of " << size << "x" << size << " on " << argv[1]
+                  << std::endl;
+        server.run();
+        runningServer = nullptr;
+        std::cout << "answered " << server.get_query_count() << " queries"
+                  << std::endl;
+    } catch (const std::exception &error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
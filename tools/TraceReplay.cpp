@@ -0,0 +1,189 @@
+//! \addtogroup 0007 Pathfinding
+//! \brief A pathfinding module
+//!
+//! A pathfinding module that can be used in the R2D2 project.
+//! The module is currently based on the A star algorithm.
+//!
+//! \file   TraceReplay.cpp
+//! \author Chiel Douwes 1666311
+//! \date   Created: 19-10-2026
+//! \brief  Query trace replay tool
+//!
+//! Replays a recorded query trace against the pathfinder of this build and
+//! reports the latency difference of every query.
+//!
+//! Usage: TraceReplay <trace file> [--repeat <n>] [--quiet]
+//!
+//! \copyright Copyright © 2016, HU University of Applied Sciences Utrecht.
+//! All rights reserved.
+//!
+//! License: newBSD
+//!
+//! Redistribution and use in source and binary forms,
+//! with or without modification, are permitted provided that
+//! the following conditions are met:
+//! - Redistributions of source code must retain the above copyright notice,
+//!   this list of conditions and the following disclaimer.
+//! - Redistributions in binary form must reproduce the above copyright notice,
+//!   this list of conditions and the following disclaimer in the documentation
+//!   and/or other materials provided with the distribution.
+//! - Neither the name of the HU University of Applied Sciences Utrecht
+//!   nor the names of its contributors may be used to endorse or promote
+//!   products derived from this software without specific prior written
+//!   permission.
+//!
+//! THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//! "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
+//! BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+//! AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+//! IN NO EVENT SHALL THE HU UNIVERSITY OF APPLIED SCIENCES UTRECHT
+//! BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+//! CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//! PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+//! OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+//! WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+//! OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//! EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// ~< HEADER_VERSION 2016 04 12 >~
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include "../source/include/AStarPathFinder.hpp"
+#include "../source/include/QueryTrace.hpp"
+#include "LockingSharedObject.hpp"
+
+namespace {
+
+    // one pathfinder per robot size in the trace
+    struct RobotPathFinder {
+        r2d2::Translation robotBox;
+        std::unique_ptr<r2d2::AStarPathFinder> pathFinder;
+    };
+
+    double percentile(std::vector<double> values, double fraction) {
+        if (values.empty()) {
+            return 0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[std::size_t(fraction * (values.size() - 1))];
+    }
+
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0]
+                  << " <trace file> [--repeat <n>] [--quiet]" << std::endl;
+        return 2;
+    }
+    int repeat = 1;
+    bool quiet = false;
+    for (int i = 2; i < argc; i++) {
+        if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--quiet") == 0) {
+            quiet = true;
+        }
+    }
+
+    std::ifstream file{argv[1], std::ios::binary};
+    if (!file) {
+        std::cerr << "cannot open " << argv[1] << std::endl;
+        return 1;
+    }
+
+    try {
+        r2d2::QueryTraceReader reader{file};
+        LockingSharedObject<r2d2::ReadOnlyMap> sharedMap{reader.get_map()};
+        // every repetition has its own pathfinders, which see the same
+        // queries, so a repetition is not answered from the search the one
+        // before it kept
+        std::vector<std::vector<RobotPathFinder>> pathFinders;
+        pathFinders.resize(std::size_t(repeat));
+        std::vector<double> ratios;
+        double recordedTotal = 0, replayTotal = 0;
+        int queries = 0, mismatches = 0, maps = 0;
+
+        if (!quiet) {
+            std::cout << std::setw(7) << "query" << std::setw(14) << "recorded us"
+                      << std::setw(12) << "replay us" << std::setw(10) << "change"
+                      << "  result" << std::endl;
+        }
+        for (r2d2::QueryTraceReader::Record record = reader.next();
+             record != r2d2::QueryTraceReader::Record::END;
+             record = reader.next()) {
+            if (record == r2d2::QueryTraceReader::Record::MAP) {
+                maps++;
+                continue;
+            }
+            const r2d2::TraceQuery &query = reader.get_query();
+
+            // the fastest of the repetitions is the least disturbed one
+            double best = 0;
+            bool found = false;
+            std::vector<r2d2::Coordinate> path;
+            for (int i = 0; i < repeat; i++) {
+                std::vector<RobotPathFinder> &own = pathFinders[std::size_t(i)];
+                auto it = std::find_if(own.begin(), own.end(),
+                                       [&query](const RobotPathFinder &entry) {
+                                           return (entry.robotBox -
+                                                   query.robotBox)
+                                                          .get_length() /
+                                                  r2d2::Length::METER == 0;
+                                       });
+                if (it == own.end()) {
+                    own.push_back({query.robotBox,
+                                   std::unique_ptr<r2d2::AStarPathFinder>{
+                                           new r2d2::AStarPathFinder{
+                                                   sharedMap,
+                                                   {{}, query.robotBox}}}});
+                    it = own.end() - 1;
+                }
+                auto begin = std::chrono::steady_clock::now();
+                found = it->pathFinder->get_path_to_coordinate(query.start,
+                                                               query.goal, path);
+                double micros = std::chrono::duration<double, std::micro>(
+                        std::chrono::steady_clock::now() - begin).count();
+                best = i == 0 ? micros : std::min(best, micros);
+            }
+
+            double recorded = query.durationNs / 1000.0;
+            bool same = found == query.found &&
+                        (!found || path.size() == query.pathLength);
+            mismatches += same ? 0 : 1;
+            recordedTotal += recorded;
+            replayTotal += best;
+            if (recorded > 0) {
+                ratios.push_back(best / recorded);
+            }
+            if (!quiet) {
+                std::cout << std::setw(7) << queries
+                          << std::setw(14) << std::fixed << std::setprecision(1)
+                          << recorded << std::setw(12) << best
+                          << std::setw(9) << std::showpos
+                          << (recorded > 0 ? (best / recorded - 1) * 100 : 0)
+                          << std::noshowpos << "%  "
+                          << (same ? "same" : "DIFFERENT") << std::endl;
+            }
+            queries++;
+        }
+
+        std::cout << queries << " queries on " << maps << " map states, "
+                  << mismatches << " with a different result" << std::endl;
+        std::cout << std::fixed << std::setprecision(3)
+                  << "total recorded " << recordedTotal / 1000 << " ms, replay "
+                  << replayTotal / 1000 << " ms" << std::endl;
+        std::cout << "replay/recorded latency: median "
+                  << percentile(ratios, .5) << ", p95 "
+                  << percentile(ratios, .95) << std::endl;
+        return mismatches == 0 ? 0 : 3;
+    } catch (std::exception &e) {
+        std::cerr << argv[1] << ": " << e.what() << std::endl;
+        return 1;
+    }
+}